@@ -1,9 +1,9 @@
 #include "CommunicateMesh.hpp"
-#include <map>
 #include <vector>
 #include "Communication.hpp"
 #include "com/SharedPointer.hpp"
 #include "mesh/Edge.hpp"
+#include "mesh/IDMap.hpp"
 #include "mesh/Mesh.hpp"
 #include "mesh/Triangle.hpp"
 #include "mesh/Vertex.hpp"
@@ -31,16 +31,16 @@ void CommunicateMesh::sendMesh(
   int numberOfVertices = mesh.vertices().size();
   _communication->send(numberOfVertices, rankReceiver);
   if (numberOfVertices > 0) {
-    double coords[numberOfVertices * dim];
-    int    globalIDs[numberOfVertices];
+    std::vector<double> coords(numberOfVertices * dim);
+    std::vector<int> globalIDs(numberOfVertices);
     for (int i = 0; i < numberOfVertices; i++) {
       for (int d = 0; d < dim; d++) {
         coords[i * dim + d] = mesh.vertices()[i].getCoords()[d];
       }
       globalIDs[i] = mesh.vertices()[i].getGlobalIndex();
     }
-    _communication->send(coords, numberOfVertices * dim, rankReceiver);
-    _communication->send(globalIDs, numberOfVertices, rankReceiver);
+    _communication->send(coords.data(), numberOfVertices * dim, rankReceiver);
+    _communication->send(globalIDs.data(), numberOfVertices, rankReceiver);
   }
 
   int numberOfEdges = mesh.edges().size();
@@ -48,18 +48,18 @@ void CommunicateMesh::sendMesh(
   if (numberOfEdges > 0) {
     //we need to send the vertexIDs first such that the right edges can be created later
     //contrary to the normal sendMesh, this variant must also work for adding delta meshes
-    int vertexIDs[numberOfVertices];
+    std::vector<int> vertexIDs(numberOfVertices);
     for (int i = 0; i < numberOfVertices; i++) {
       vertexIDs[i] = mesh.vertices()[i].getID();
     }
-    _communication->send(vertexIDs, numberOfVertices, rankReceiver);
+    _communication->send(vertexIDs.data(), numberOfVertices, rankReceiver);
 
-    int edgeIDs[numberOfEdges * 2];
+    std::vector<int> edgeIDs(numberOfEdges * 2);
     for (int i = 0; i < numberOfEdges; i++) {
       edgeIDs[i * 2]     = mesh.edges()[i].vertex(0).getID();
       edgeIDs[i * 2 + 1] = mesh.edges()[i].vertex(1).getID();
     }
-    _communication->send(edgeIDs, numberOfEdges * 2, rankReceiver);
+    _communication->send(edgeIDs.data(), numberOfEdges * 2, rankReceiver);
   }
 
   if (dim == 3) {
@@ -68,19 +68,19 @@ void CommunicateMesh::sendMesh(
     if (numberOfTriangles > 0) {
       //we need to send the edgeIDs first such that the right edges can be created later
       //contrary to the normal sendMesh, this variant must also work for adding delta meshes
-      int edgeIDs[numberOfEdges];
+      std::vector<int> edgeIDs(numberOfEdges);
       for (int i = 0; i < numberOfEdges; i++) {
         edgeIDs[i] = mesh.edges()[i].getID();
       }
-      _communication->send(edgeIDs, numberOfEdges, rankReceiver);
+      _communication->send(edgeIDs.data(), numberOfEdges, rankReceiver);
 
-      int triangleIDs[numberOfTriangles * 3];
+      std::vector<int> triangleIDs(numberOfTriangles * 3);
       for (int i = 0; i < numberOfTriangles; i++) {
         triangleIDs[i * 3]     = mesh.triangles()[i].edge(0).getID();
         triangleIDs[i * 3 + 1] = mesh.triangles()[i].edge(1).getID();
         triangleIDs[i * 3 + 2] = mesh.triangles()[i].edge(2).getID();
       }
-      _communication->send(triangleIDs, numberOfTriangles * 3, rankReceiver);
+      _communication->send(triangleIDs.data(), numberOfTriangles * 3, rankReceiver);
     }
   }
 }
@@ -93,16 +93,16 @@ void CommunicateMesh::receiveMesh(
   int dim = mesh.getDimensions();
 
   std::vector<mesh::Vertex *>   vertices;
-  std::map<int, mesh::Vertex *> vertexMap;
+  mesh::IDMap<mesh::Vertex>    vertexMap;
   int                           numberOfVertices = 0;
   _communication->receive(numberOfVertices, rankSender);
   DEBUG("Number of vertices to receive: " << numberOfVertices);
 
   if (numberOfVertices > 0) {
-    double vertexCoords[numberOfVertices * dim];
-    int    globalIDs[numberOfVertices];
-    _communication->receive(vertexCoords, numberOfVertices * dim, rankSender);
-    _communication->receive(globalIDs, numberOfVertices, rankSender);
+    std::vector<double> vertexCoords(numberOfVertices * dim);
+    std::vector<int> globalIDs(numberOfVertices);
+    _communication->receive(vertexCoords.data(), numberOfVertices * dim, rankSender);
+    _communication->receive(globalIDs.data(), numberOfVertices, rankSender);
     for (int i = 0; i < numberOfVertices; i++) {
       Eigen::VectorXd coords(dim);
       for (int d = 0; d < dim; d++) {
@@ -120,19 +120,18 @@ void CommunicateMesh::receiveMesh(
   _communication->receive(numberOfEdges, rankSender);
   DEBUG("Number of edges to receive: " << numberOfEdges);
   if (numberOfEdges > 0) {
-    int vertexIDs[numberOfVertices];
-    _communication->receive(vertexIDs, numberOfVertices, rankSender);
+    std::vector<int> vertexIDs(numberOfVertices);
+    _communication->receive(vertexIDs.data(), numberOfVertices, rankSender);
+    vertexMap.reserve(numberOfVertices);
     for (int i = 0; i < numberOfVertices; i++) {
-      vertexMap[vertexIDs[i]] = vertices[i];
+      vertexMap.insert(vertexIDs[i], vertices[i]);
     }
 
-    int edgeIDs[numberOfEdges * 2];
-    _communication->receive(edgeIDs, numberOfEdges * 2, rankSender);
+    std::vector<int> edgeIDs(numberOfEdges * 2);
+    _communication->receive(edgeIDs.data(), numberOfEdges * 2, rankSender);
     for (int i = 0; i < numberOfEdges; i++) {
-      assertion(vertexMap.find(edgeIDs[i * 2]) != vertexMap.end());
-      assertion(vertexMap.find(edgeIDs[i * 2 + 1]) != vertexMap.end());
       assertion(edgeIDs[i * 2] != edgeIDs[i * 2 + 1]);
-      mesh::Edge &e = mesh.createEdge(*vertexMap[edgeIDs[i * 2]], *vertexMap[edgeIDs[i * 2 + 1]]);
+      mesh::Edge &e = mesh.createEdge(vertexMap[edgeIDs[i * 2]], vertexMap[edgeIDs[i * 2 + 1]]);
       edges.push_back(&e);
     }
   }
@@ -144,24 +143,22 @@ void CommunicateMesh::receiveMesh(
     DEBUG("Number of Edges: " << edges.size());
     if (numberOfTriangles > 0) {
       assertion((edges.size() > 0) || (numberOfTriangles == 0));
-      int edgeIDs[numberOfEdges];
-      _communication->receive(edgeIDs, numberOfEdges, rankSender);
-      std::map<int, mesh::Edge *> edgeMap;
+      std::vector<int> edgeIDs(numberOfEdges);
+      _communication->receive(edgeIDs.data(), numberOfEdges, rankSender);
+      mesh::IDMap<mesh::Edge> edgeMap;
+      edgeMap.reserve(numberOfEdges);
       for (int i = 0; i < numberOfEdges; i++) {
-        edgeMap[edgeIDs[i]] = edges[i];
+        edgeMap.insert(edgeIDs[i], edges[i]);
       }
 
-      int triangleIDs[numberOfTriangles * 3];
-      _communication->receive(triangleIDs, numberOfTriangles * 3, rankSender);
+      std::vector<int> triangleIDs(numberOfTriangles * 3);
+      _communication->receive(triangleIDs.data(), numberOfTriangles * 3, rankSender);
 
       for (int i = 0; i < numberOfTriangles; i++) {
-        assertion(edgeMap.find(triangleIDs[i * 3]) != edgeMap.end());
-        assertion(edgeMap.find(triangleIDs[i * 3 + 1]) != edgeMap.end());
-        assertion(edgeMap.find(triangleIDs[i * 3 + 2]) != edgeMap.end());
         assertion(triangleIDs[i * 3] != triangleIDs[i * 3 + 1]);
         assertion(triangleIDs[i * 3 + 1] != triangleIDs[i * 3 + 2]);
         assertion(triangleIDs[i * 3 + 2] != triangleIDs[i * 3]);
-        mesh.createTriangle(*edgeMap[triangleIDs[i * 3]], *edgeMap[triangleIDs[i * 3 + 1]], *edgeMap[triangleIDs[i * 3 + 2]]);
+        mesh.createTriangle(edgeMap[triangleIDs[i * 3]], edgeMap[triangleIDs[i * 3 + 1]], edgeMap[triangleIDs[i * 3 + 2]]);
       }
     }
   }
@@ -176,16 +173,16 @@ void CommunicateMesh::broadcastSendMesh(
   int numberOfVertices = mesh.vertices().size();
   _communication->broadcast(numberOfVertices);
   if (numberOfVertices > 0) {
-    double coords[numberOfVertices * dim];
-    int    globalIDs[numberOfVertices];
+    std::vector<double> coords(numberOfVertices * dim);
+    std::vector<int> globalIDs(numberOfVertices);
     for (int i = 0; i < numberOfVertices; i++) {
       for (int d = 0; d < dim; d++) {
         coords[i * dim + d] = mesh.vertices()[i].getCoords()[d];
       }
       globalIDs[i] = mesh.vertices()[i].getGlobalIndex();
     }
-    _communication->broadcast(coords, numberOfVertices * dim);
-    _communication->broadcast(globalIDs, numberOfVertices);
+    _communication->broadcast(coords.data(), numberOfVertices * dim);
+    _communication->broadcast(globalIDs.data(), numberOfVertices);
   }
 
   int numberOfEdges = mesh.edges().size();
@@ -193,18 +190,18 @@ void CommunicateMesh::broadcastSendMesh(
   if (numberOfEdges > 0) {
     //we need to send the vertexIDs first such that the right edges can be created later
     //contrary to the normal sendMesh, this variant must also work for adding delta meshes
-    int vertexIDs[numberOfVertices];
+    std::vector<int> vertexIDs(numberOfVertices);
     for (int i = 0; i < numberOfVertices; i++) {
       vertexIDs[i] = mesh.vertices()[i].getID();
     }
-    _communication->broadcast(vertexIDs, numberOfVertices);
+    _communication->broadcast(vertexIDs.data(), numberOfVertices);
 
-    int edgeIDs[numberOfEdges * 2];
+    std::vector<int> edgeIDs(numberOfEdges * 2);
     for (int i = 0; i < numberOfEdges; i++) {
       edgeIDs[i * 2]     = mesh.edges()[i].vertex(0).getID();
       edgeIDs[i * 2 + 1] = mesh.edges()[i].vertex(1).getID();
     }
-    _communication->broadcast(edgeIDs, numberOfEdges * 2);
+    _communication->broadcast(edgeIDs.data(), numberOfEdges * 2);
   }
 
   if (dim == 3) {
@@ -213,19 +210,19 @@ void CommunicateMesh::broadcastSendMesh(
     if (numberOfTriangles > 0) {
       //we need to send the edgeIDs first such that the right edges can be created later
       //contrary to the normal sendMesh, this variant must also work for adding delta meshes
-      int edgeIDs[numberOfEdges];
+      std::vector<int> edgeIDs(numberOfEdges);
       for (int i = 0; i < numberOfEdges; i++) {
         edgeIDs[i] = mesh.edges()[i].getID();
       }
-      _communication->broadcast(edgeIDs, numberOfEdges);
+      _communication->broadcast(edgeIDs.data(), numberOfEdges);
 
-      int triangleIDs[numberOfTriangles * 3];
+      std::vector<int> triangleIDs(numberOfTriangles * 3);
       for (int i = 0; i < numberOfTriangles; i++) {
         triangleIDs[i * 3]     = mesh.triangles()[i].edge(0).getID();
         triangleIDs[i * 3 + 1] = mesh.triangles()[i].edge(1).getID();
         triangleIDs[i * 3 + 2] = mesh.triangles()[i].edge(2).getID();
       }
-      _communication->broadcast(triangleIDs, numberOfTriangles * 3);
+      _communication->broadcast(triangleIDs.data(), numberOfTriangles * 3);
     }
   }
 }
@@ -238,15 +235,15 @@ void CommunicateMesh::broadcastReceiveMesh(
   int rankBroadcaster = 0;
 
   std::vector<mesh::Vertex *>   vertices;
-  std::map<int, mesh::Vertex *> vertexMap;
+  mesh::IDMap<mesh::Vertex>    vertexMap;
   int                           numberOfVertices = 0;
   _communication->broadcast(numberOfVertices, rankBroadcaster);
 
   if (numberOfVertices > 0) {
-    double vertexCoords[numberOfVertices * dim];
-    int    globalIDs[numberOfVertices];
-    _communication->broadcast(vertexCoords, numberOfVertices * dim, rankBroadcaster);
-    _communication->broadcast(globalIDs, numberOfVertices, rankBroadcaster);
+    std::vector<double> vertexCoords(numberOfVertices * dim);
+    std::vector<int> globalIDs(numberOfVertices);
+    _communication->broadcast(vertexCoords.data(), numberOfVertices * dim, rankBroadcaster);
+    _communication->broadcast(globalIDs.data(), numberOfVertices, rankBroadcaster);
     for (int i = 0; i < numberOfVertices; i++) {
       Eigen::VectorXd coords(dim);
       for (int d = 0; d < dim; d++) {
@@ -263,19 +260,18 @@ void CommunicateMesh::broadcastReceiveMesh(
   std::vector<mesh::Edge *> edges;
   _communication->broadcast(numberOfEdges, rankBroadcaster);
   if (numberOfEdges > 0) {
-    int vertexIDs[numberOfVertices];
-    _communication->broadcast(vertexIDs, numberOfVertices, rankBroadcaster);
+    std::vector<int> vertexIDs(numberOfVertices);
+    _communication->broadcast(vertexIDs.data(), numberOfVertices, rankBroadcaster);
+    vertexMap.reserve(numberOfVertices);
     for (int i = 0; i < numberOfVertices; i++) {
-      vertexMap[vertexIDs[i]] = vertices[i];
+      vertexMap.insert(vertexIDs[i], vertices[i]);
     }
 
-    int edgeIDs[numberOfEdges * 2];
-    _communication->broadcast(edgeIDs, numberOfEdges * 2, rankBroadcaster);
+    std::vector<int> edgeIDs(numberOfEdges * 2);
+    _communication->broadcast(edgeIDs.data(), numberOfEdges * 2, rankBroadcaster);
     for (int i = 0; i < numberOfEdges; i++) {
-      assertion(vertexMap.find(edgeIDs[i * 2]) != vertexMap.end());
-      assertion(vertexMap.find(edgeIDs[i * 2 + 1]) != vertexMap.end());
       assertion(edgeIDs[i * 2] != edgeIDs[i * 2 + 1]);
-      mesh::Edge &e = mesh.createEdge(*vertexMap[edgeIDs[i * 2]], *vertexMap[edgeIDs[i * 2 + 1]]);
+      mesh::Edge &e = mesh.createEdge(vertexMap[edgeIDs[i * 2]], vertexMap[edgeIDs[i * 2 + 1]]);
       edges.push_back(&e);
     }
   }
@@ -285,24 +281,22 @@ void CommunicateMesh::broadcastReceiveMesh(
     _communication->broadcast(numberOfTriangles, rankBroadcaster);
     if (numberOfTriangles > 0) {
       assertion((edges.size() > 0) || (numberOfTriangles == 0));
-      int edgeIDs[numberOfEdges];
-      _communication->broadcast(edgeIDs, numberOfEdges, rankBroadcaster);
-      std::map<int, mesh::Edge *> edgeMap;
+      std::vector<int> edgeIDs(numberOfEdges);
+      _communication->broadcast(edgeIDs.data(), numberOfEdges, rankBroadcaster);
+      mesh::IDMap<mesh::Edge> edgeMap;
+      edgeMap.reserve(numberOfEdges);
       for (int i = 0; i < numberOfEdges; i++) {
-        edgeMap[edgeIDs[i]] = edges[i];
+        edgeMap.insert(edgeIDs[i], edges[i]);
       }
 
-      int triangleIDs[numberOfTriangles * 3];
-      _communication->broadcast(triangleIDs, numberOfTriangles * 3, rankBroadcaster);
+      std::vector<int> triangleIDs(numberOfTriangles * 3);
+      _communication->broadcast(triangleIDs.data(), numberOfTriangles * 3, rankBroadcaster);
 
       for (int i = 0; i < numberOfTriangles; i++) {
-        assertion(edgeMap.find(triangleIDs[i * 3]) != edgeMap.end());
-        assertion(edgeMap.find(triangleIDs[i * 3 + 1]) != edgeMap.end());
-        assertion(edgeMap.find(triangleIDs[i * 3 + 2]) != edgeMap.end());
         assertion(triangleIDs[i * 3] != triangleIDs[i * 3 + 1]);
         assertion(triangleIDs[i * 3 + 1] != triangleIDs[i * 3 + 2]);
         assertion(triangleIDs[i * 3 + 2] != triangleIDs[i * 3]);
-        mesh.createTriangle(*edgeMap[triangleIDs[i * 3]], *edgeMap[triangleIDs[i * 3 + 1]], *edgeMap[triangleIDs[i * 3 + 2]]);
+        mesh.createTriangle(edgeMap[triangleIDs[i * 3]], edgeMap[triangleIDs[i * 3 + 1]], edgeMap[triangleIDs[i * 3 + 2]]);
       }
     }
   }
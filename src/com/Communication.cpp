@@ -10,6 +10,22 @@ namespace com
 {
 logging::Logger Communication::_log("com::Communication");
 
+std::string Communication::prepareConnectionAsServer()
+{
+  ERROR("This communication does not support connections without address files");
+}
+
+int Communication::requestConnectionAsClientAt(std::string const &address)
+{
+  ERROR("This communication does not support connections without address files");
+}
+
+std::string Communication::readAddressAsClient(std::string const &nameAcceptor,
+                                               std::string const &nameRequester)
+{
+  ERROR("This communication does not support reading addresses");
+}
+
 /**
  * @attention This method modifies the input buffer.
  */
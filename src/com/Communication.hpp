@@ -95,6 +95,35 @@ public:
   virtual int requestConnectionAsClient(std::string const &nameAcceptor,
                                         std::string const &nameRequester) = 0;
 
+  /**
+   * @brief Opens the server endpoint of acceptConnectionAsServer() without
+   * publishing it and returns its address.
+   *
+   * The address has to be passed to the clients by other means, e.g. in bulk
+   * over an existing connection, which then call requestConnectionAsClientAt().
+   * The next acceptConnectionAsServer() accepts at the opened endpoint and does
+   * not write an address file.
+   */
+  virtual std::string prepareConnectionAsServer();
+
+  /**
+   * @brief Connects as client to a server at an address returned by
+   * prepareConnectionAsServer().
+   *
+   * @return The rank of the client assigned by the server.
+   */
+  virtual int requestConnectionAsClientAt(std::string const &address);
+
+  /**
+   * @brief Reads the address published by acceptConnectionAsServer() of the
+   * acceptor, waits until it is available.
+   *
+   * requestConnectionAsClient() is equivalent to requestConnectionAsClientAt()
+   * with this address.
+   */
+  virtual std::string readAddressAsClient(std::string const &nameAcceptor,
+                                          std::string const &nameRequester);
+
   /**
    * @brief Disconnects from communication space, i.e. participant.
    *
@@ -19,6 +19,12 @@ public:
   {
     throw std::runtime_error("Not available!");
   }
+
+  /// Returns true, if communications may establish connections from several threads at once.
+  virtual bool supportsConcurrentConnections()
+  {
+    return false;
+  }
 };
 }
 } // namespace precice, com
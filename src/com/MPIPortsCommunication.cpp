@@ -7,6 +7,7 @@
 #include "utils/Publisher.hpp"
 
 #include <chrono>
+#include <memory>
 #include <sstream>
 #include <thread>
 
@@ -22,7 +23,7 @@ logging::Logger MPIPortsCommunication::_log(
 
 MPIPortsCommunication::MPIPortsCommunication(
     std::string const &addressDirectory)
-    : _addressDirectory(addressDirectory), _isAcceptor(false), _isConnected(false)
+    : _addressDirectory(addressDirectory), _isAcceptor(false), _isPrepared(false), _isConnected(false)
 {
   if (_addressDirectory.empty()) {
     _addressDirectory = ".";
@@ -169,16 +170,23 @@ void MPIPortsCommunication::acceptConnectionAsServer(
   // latest Intel MPI, the program hangs. Possibly `Parallel::initialize' is
   // doing something weird inside?
 
-  MPI_Open_port(MPI_INFO_NULL, _portName);
+  std::unique_ptr<ScopedPublisher> p;
 
-  std::string address(_portName);
-  std::string addressFileName("." + nameRequester + "-" + nameAcceptor + ".address");
+  if (not _isPrepared) {
+    MPI_Open_port(MPI_INFO_NULL, _portName);
 
-  Publisher::ScopedChangePrefixDirectory scpd(_addressDirectory);
+    std::string addressFileName("." + nameRequester + "-" + nameAcceptor + ".address");
 
-  ScopedPublisher p(addressFileName);
+    Publisher::ScopedChangePrefixDirectory scpd(_addressDirectory);
 
-  p.write(address);
+    p.reset(new ScopedPublisher(addressFileName));
+
+    p->write(_portName);
+  }
+
+  _isPrepared = false;
+
+  std::string address(_portName);
 
   DEBUG("Accept connection at " << address);
 
@@ -261,9 +269,13 @@ int MPIPortsCommunication::requestConnectionAsClient(
 {
   TRACE(nameAcceptor, nameRequester);
 
-  assertion(not isConnected());
+  return requestConnectionAsClientAt(readAddressAsClient(nameAcceptor, nameRequester));
+}
 
-  _isAcceptor = false;
+std::string MPIPortsCommunication::readAddressAsClient(
+    std::string const &nameAcceptor, std::string const &nameRequester)
+{
+  TRACE(nameAcceptor, nameRequester);
 
   std::string addressFileName("." + nameRequester + "-" + nameAcceptor + ".address");
 
@@ -271,7 +283,30 @@ int MPIPortsCommunication::requestConnectionAsClient(
 
   Publisher p(addressFileName);
 
-  std::string address = p.read();
+  return p.read();
+}
+
+std::string MPIPortsCommunication::prepareConnectionAsServer()
+{
+  TRACE();
+
+  assertion(not isConnected());
+
+  MPI_Open_port(MPI_INFO_NULL, _portName);
+
+  _isAcceptor = true;
+  _isPrepared = true;
+
+  return _portName;
+}
+
+int MPIPortsCommunication::requestConnectionAsClientAt(std::string const &address)
+{
+  TRACE(address);
+
+  assertion(not isConnected());
+
+  _isAcceptor = false;
 
   DEBUG("Request connection to " << address);
 
@@ -51,6 +51,16 @@ public:
   virtual int requestConnectionAsClient(std::string const &nameAcceptor,
                                         std::string const &nameRequester);
 
+  /// See precice::com::Communication::prepareConnectionAsServer().
+  virtual std::string prepareConnectionAsServer();
+
+  /// See precice::com::Communication::requestConnectionAsClientAt().
+  virtual int requestConnectionAsClientAt(std::string const &address);
+
+  /// See precice::com::Communication::readAddressAsClient().
+  virtual std::string readAddressAsClient(std::string const &nameAcceptor,
+                                          std::string const &nameRequester);
+
   /**
    * @brief See precice::com::Communication::closeConnection().
    */
@@ -72,6 +82,9 @@ private:
 
   bool _isAcceptor;
 
+  /// Flag indicating a port opened by prepareConnectionAsServer().
+  bool _isPrepared;
+
   /// Flag indicating a connection.
   bool _isConnected;
 };
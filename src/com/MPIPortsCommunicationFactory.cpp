@@ -29,6 +29,13 @@ MPIPortsCommunicationFactory::addressDirectory()
 {
   return _addressDirectory;
 }
+
+bool MPIPortsCommunicationFactory::supportsConcurrentConnections()
+{
+  int provided = MPI_THREAD_SINGLE;
+  MPI_Query_thread(&provided);
+  return provided == MPI_THREAD_MULTIPLE;
+}
 }
 } // namespace precice, com
 
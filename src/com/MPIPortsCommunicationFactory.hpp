@@ -20,6 +20,9 @@ public:
 
   std::string addressDirectory();
 
+  /// Connecting from several threads requires MPI_THREAD_MULTIPLE.
+  bool supportsConcurrentConnections();
+
 private:
   std::string _addressDirectory;
 };
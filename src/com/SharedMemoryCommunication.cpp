@@ -0,0 +1,845 @@
+#ifndef PRECICE_NO_SHARED_MEMORY
+
+#include "SharedMemoryCommunication.hpp"
+
+#include "SharedMemoryRequest.hpp"
+#include "utils/Publisher.hpp"
+#include "utils/assertion.hpp"
+
+#include <atomic>
+#include <cerrno>
+#include <climits>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <new>
+#include <thread>
+
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+using precice::utils::Publisher;
+using precice::utils::ScopedPublisher;
+
+namespace precice
+{
+namespace com
+{
+
+namespace
+{
+
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t) && ATOMIC_INT_LOCK_FREE == 2,
+              "Futexes require lock-free 32 bit atomics");
+
+/// Number of polls of a ring before a blocked sender or receiver goes to sleep
+const int spinCount = 4096;
+
+void futexWait(std::atomic<uint32_t> &word, uint32_t expected)
+{
+  // Wakes up immediately, if the word does not contain the expected value anymore
+  syscall(SYS_futex, reinterpret_cast<uint32_t *>(&word), FUTEX_WAIT, expected, nullptr, nullptr, 0);
+}
+
+void futexWake(std::atomic<uint32_t> &word)
+{
+  syscall(SYS_futex, reinterpret_cast<uint32_t *>(&word), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+}
+
+/// Layout of the control segment created by the acceptor
+struct ControlBlock {
+  /// Next rank assigned to a requester of acceptConnectionAsServer()
+  std::atomic<uint32_t> tickets;
+
+  /// Number of requesters, whose channel is ready
+  std::atomic<uint32_t> connected;
+
+  /// Number of requesters of acceptConnection()
+  std::atomic<uint32_t> requesterSize;
+
+  int32_t acceptorRank;
+  int32_t acceptorSize;
+
+  /// Capacity of the ring buffers in bytes
+  uint32_t bufferSize;
+};
+
+/// Positions of one direction of a channel, the data follows the header of the channel
+/**
+ * The positions count the bytes in total modulo 2^32, such that the ring is
+ * empty, if they are equal. Both are written by one side only and serve as
+ * futex words, the other side sleeps on them if the ring is empty or full.
+ */
+struct RingBlock {
+  alignas(64) std::atomic<uint32_t> written;
+  std::atomic<uint32_t> readerWaiting;
+  alignas(64) std::atomic<uint32_t> read;
+  std::atomic<uint32_t> writerWaiting;
+};
+
+/// Layout of the segment of a channel created by the requester
+struct ChannelBlock {
+  /// Set by the side which closes the channel, wakes up the other side
+  std::atomic<uint32_t> closed;
+
+  RingBlock toAcceptor;
+  RingBlock toRequester;
+};
+
+/// Maps the shared memory segment with the given name, creates it if requested
+void *mapSegment(std::string const &name, size_t size, bool create)
+{
+  int fd = -1;
+  if (create) {
+    fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0 && errno == EEXIST) {
+      // Left behind by a process which has been killed during the setup
+      shm_unlink(name.c_str());
+      fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    }
+    if (fd >= 0 && ftruncate(fd, size) != 0) {
+      close(fd);
+      fd = -1;
+    }
+  } else {
+    fd = shm_open(name.c_str(), O_RDWR, 0600);
+  }
+  if (fd < 0) {
+    return nullptr;
+  }
+  void *memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  return memory == MAP_FAILED ? nullptr : memory;
+}
+
+std::string getHostName()
+{
+  char name[HOST_NAME_MAX + 1] = {0};
+  gethostname(name, HOST_NAME_MAX);
+  return name;
+}
+
+/// Executes the asynchronous operations of one direction of a channel in order
+class Worker
+{
+public:
+  ~Worker()
+  {
+    stop();
+  }
+
+  std::shared_future<void> post(std::function<void()> operation)
+  {
+    std::packaged_task<void()> task(std::move(operation));
+    std::shared_future<void>   completion = task.get_future().share();
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      if (not _thread.joinable()) {
+        _thread = std::thread([this] { run(); });
+      }
+      _tasks.push_back(std::move(task));
+    }
+    _condition.notify_one();
+    return completion;
+  }
+
+  /// Finishes all posted operations
+  void stop()
+  {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _stop = true;
+    }
+    _condition.notify_one();
+    if (_thread.joinable()) {
+      _thread.join();
+    }
+  }
+
+private:
+  std::thread                            _thread;
+  std::mutex                             _mutex;
+  std::condition_variable                _condition;
+  std::deque<std::packaged_task<void()>> _tasks;
+  bool                                   _stop = false;
+
+  void run()
+  {
+    while (true) {
+      std::packaged_task<void()> task;
+      {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _condition.wait(lock, [this] { return _stop || not _tasks.empty(); });
+        if (_tasks.empty()) {
+          return;
+        }
+        task = std::move(_tasks.front());
+        _tasks.pop_front();
+      }
+      task();
+    }
+  }
+};
+
+/// Access to one direction of a channel
+class Ring
+{
+public:
+  Ring(RingBlock &block, char *data, uint32_t capacity, std::atomic<uint32_t> &closed)
+      : _block(block), _data(data), _capacity(capacity), _closed(closed)
+  {
+  }
+
+  /// Copies the data into the ring, blocks while it is full
+  bool write(char const *data, size_t size)
+  {
+    uint32_t written = _block.written.load(std::memory_order_relaxed);
+    while (size > 0) {
+      uint32_t read = 0;
+      if (not await(_block.read, _block.writerWaiting,
+                    [&](uint32_t position) { return written - position < _capacity; }, read)) {
+        return false;
+      }
+      uint32_t chunk = std::min<size_t>(size, _capacity - (written - read));
+      uint32_t begin = written & (_capacity - 1);
+      uint32_t first = std::min(chunk, _capacity - begin);
+      std::memcpy(_data + begin, data, first);
+      std::memcpy(_data, data + first, chunk - first);
+      written += chunk;
+      data += chunk;
+      size -= chunk;
+      signal(_block.written, written, _block.readerWaiting);
+    }
+    return true;
+  }
+
+  /// Copies data out of the ring, blocks while it is empty
+  bool read(char *data, size_t size)
+  {
+    uint32_t read = _block.read.load(std::memory_order_relaxed);
+    while (size > 0) {
+      uint32_t written = 0;
+      if (not await(_block.written, _block.readerWaiting,
+                    [&](uint32_t position) { return position != read; }, written)) {
+        return false;
+      }
+      uint32_t chunk = std::min<size_t>(size, written - read);
+      uint32_t begin = read & (_capacity - 1);
+      uint32_t first = std::min(chunk, _capacity - begin);
+      std::memcpy(data, _data + begin, first);
+      std::memcpy(data + first, _data, chunk - first);
+      read += chunk;
+      data += chunk;
+      size -= chunk;
+      signal(_block.read, read, _block.writerWaiting);
+    }
+    return true;
+  }
+
+private:
+  RingBlock &            _block;
+  char *                 _data;
+  uint32_t               _capacity;
+  std::atomic<uint32_t> &_closed;
+
+  /// Waits until the position written by the other side fulfills the condition, false if the channel is closed
+  template <typename Condition>
+  bool await(std::atomic<uint32_t> &position, std::atomic<uint32_t> &waiting, Condition condition, uint32_t &value)
+  {
+    for (int i = 0; i < spinCount; i++) {
+      value = position.load(std::memory_order_acquire);
+      if (condition(value)) {
+        return true;
+      }
+    }
+    while (true) {
+      // Sequentially consistent, such that either the other side sees the flag or we see its update
+      waiting.store(1);
+      value = position.load();
+      if (condition(value)) {
+        waiting.store(0);
+        return true;
+      }
+      if (_closed.load()) {
+        return false;
+      }
+      futexWait(position, value);
+    }
+  }
+
+  void signal(std::atomic<uint32_t> &position, uint32_t value, std::atomic<uint32_t> &waiting)
+  {
+    position.store(value);
+    if (waiting.load()) {
+      futexWake(position);
+    }
+  }
+};
+
+} // namespace
+
+/// Control segment of an acceptor, which is waiting for connections
+struct SharedMemoryCommunication::Control {
+  Control(std::string const &name, void *memory)
+      : name(name), block(static_cast<ControlBlock *>(memory)) {}
+
+  ~Control()
+  {
+    munmap(block, sizeof(ControlBlock));
+  }
+
+  std::string name;
+
+  ControlBlock *block;
+};
+
+/// Mapped segment shared with one remote process
+struct SharedMemoryCommunication::Channel {
+  Channel(void *memory, size_t bufferSize, bool isAcceptor)
+      : block(static_cast<ChannelBlock *>(memory)),
+        size(sizeof(ChannelBlock) + 2 * bufferSize),
+        toAcceptor(block->toAcceptor, static_cast<char *>(memory) + sizeof(ChannelBlock), bufferSize, block->closed),
+        toRequester(block->toRequester, static_cast<char *>(memory) + sizeof(ChannelBlock) + bufferSize, bufferSize, block->closed),
+        out(isAcceptor ? toRequester : toAcceptor),
+        in(isAcceptor ? toAcceptor : toRequester)
+  {
+  }
+
+  ~Channel()
+  {
+    // Finish pending requests before the other side is told to stop waiting
+    sendWorker.stop();
+    receiveWorker.stop();
+    block->closed.store(1);
+    for (RingBlock *ring : {&block->toAcceptor, &block->toRequester}) {
+      futexWake(ring->written);
+      futexWake(ring->read);
+    }
+    munmap(block, size);
+  }
+
+  static size_t segmentSize(size_t bufferSize)
+  {
+    return sizeof(ChannelBlock) + 2 * bufferSize;
+  }
+
+  ChannelBlock *block;
+  size_t        size;
+  Ring          toAcceptor;
+  Ring          toRequester;
+  Ring &        out;
+  Ring &        in;
+  Worker        sendWorker;
+  Worker        receiveWorker;
+};
+
+logging::Logger SharedMemoryCommunication::_log("precice::com::SharedMemoryCommunication");
+
+SharedMemoryCommunication::SharedMemoryCommunication(size_t             bufferSize,
+                                                     std::string const &addressDirectory)
+    : _bufferSize(64), _addressDirectory(addressDirectory), _isConnected(false)
+{
+  if (_addressDirectory.empty()) {
+    _addressDirectory = ".";
+  }
+  CHECK(bufferSize <= (1u << 30), "Shared memory buffer size " << bufferSize << " exceeds 1 GiB!");
+  while (_bufferSize < bufferSize) {
+    _bufferSize *= 2;
+  }
+}
+
+SharedMemoryCommunication::~SharedMemoryCommunication()
+{
+  TRACE(_isConnected);
+
+  closeConnection();
+}
+
+bool SharedMemoryCommunication::isConnected()
+{
+  return _isConnected;
+}
+
+size_t SharedMemoryCommunication::getRemoteCommunicatorSize()
+{
+  TRACE();
+
+  assertion(isConnected());
+
+  return _channels.size();
+}
+
+void SharedMemoryCommunication::acceptConnection(std::string const &nameAcceptor,
+                                                 std::string const &nameRequester,
+                                                 int                acceptorProcessRank,
+                                                 int                acceptorCommunicatorSize)
+{
+  TRACE(nameAcceptor, nameRequester);
+
+  CHECK(acceptorCommunicatorSize == 1, "Acceptor of shared memory connection can only have one process!");
+
+  assertion(not isConnected());
+
+  std::string address = prepareConnectionAsServer();
+
+  _control->block->acceptorRank = acceptorProcessRank;
+  _rank                         = acceptorProcessRank;
+
+  Publisher::ScopedChangePrefixDirectory scpd(_addressDirectory);
+
+  ScopedPublisher p("." + nameRequester + "-" + nameAcceptor + ".address");
+
+  p.write(address);
+
+  DEBUG("Accept connection at " << address);
+
+  // The requesters announce their number
+  ControlBlock &control = *_control->block;
+  uint32_t      connected;
+  while ((connected = control.connected.load()) == 0) {
+    futexWait(control.connected, connected);
+  }
+
+  int requesterCommunicatorSize = control.requesterSize.load();
+
+  CHECK(requesterCommunicatorSize > 0, "Requester communicator size has to be > 0!");
+
+  acceptChannels(requesterCommunicatorSize);
+}
+
+void SharedMemoryCommunication::acceptConnectionAsServer(std::string const &nameAcceptor,
+                                                         std::string const &nameRequester,
+                                                         int                requesterCommunicatorSize)
+{
+  TRACE(nameAcceptor, nameRequester, requesterCommunicatorSize);
+
+  CHECK(requesterCommunicatorSize > 0, "Requester communicator size has to be > 0!");
+
+  assertion(not isConnected());
+
+  _rank = 0;
+
+  std::unique_ptr<ScopedPublisher> p;
+
+  if (not _control) {
+    std::string address = prepareConnectionAsServer();
+
+    Publisher::ScopedChangePrefixDirectory scpd(_addressDirectory);
+
+    p.reset(new ScopedPublisher("." + nameRequester + "-" + nameAcceptor + ".address"));
+
+    p->write(address);
+  }
+
+  DEBUG("Accept connection at " << _control->name);
+
+  acceptChannels(requesterCommunicatorSize);
+}
+
+void SharedMemoryCommunication::acceptChannels(int requesterCommunicatorSize)
+{
+  TRACE(requesterCommunicatorSize);
+
+  ControlBlock &control = *_control->block;
+
+  uint32_t connected;
+  while ((connected = control.connected.load()) < static_cast<uint32_t>(requesterCommunicatorSize)) {
+    futexWait(control.connected, connected);
+  }
+
+  CHECK(connected == static_cast<uint32_t>(requesterCommunicatorSize),
+        "Expected " << requesterCommunicatorSize << " requesters, but " << connected << " connected!");
+
+  size_t segmentSize = Channel::segmentSize(_bufferSize);
+
+  for (int remoteRank = 0; remoteRank < requesterCommunicatorSize; ++remoteRank) {
+    std::string name   = _control->name + "-" + std::to_string(remoteRank);
+    void *      memory = mapSegment(name, segmentSize, false);
+
+    CHECK(memory != nullptr, "Opening shared memory segment " << name << " failed: " << std::strerror(errno));
+
+    // Not needed anymore once both sides have mapped it
+    shm_unlink(name.c_str());
+
+    _channels.push_back(std::make_shared<Channel>(memory, _bufferSize, true));
+  }
+
+  shm_unlink(_control->name.c_str());
+  _control.reset();
+
+  DEBUG("Accepted " << requesterCommunicatorSize << " connections");
+
+  _isConnected = true;
+}
+
+void SharedMemoryCommunication::requestConnection(std::string const &nameAcceptor,
+                                                  std::string const &nameRequester,
+                                                  int                requesterProcessRank,
+                                                  int                requesterCommunicatorSize)
+{
+  TRACE(nameAcceptor, nameRequester);
+
+  assertion(not isConnected());
+
+  connect(readAddressAsClient(nameAcceptor, nameRequester), requesterProcessRank, requesterCommunicatorSize);
+}
+
+int SharedMemoryCommunication::requestConnectionAsClient(std::string const &nameAcceptor,
+                                                         std::string const &nameRequester)
+{
+  TRACE(nameAcceptor, nameRequester);
+
+  return requestConnectionAsClientAt(readAddressAsClient(nameAcceptor, nameRequester));
+}
+
+std::string SharedMemoryCommunication::readAddressAsClient(std::string const &nameAcceptor,
+                                                           std::string const &nameRequester)
+{
+  TRACE(nameAcceptor, nameRequester);
+
+  std::string addressFileName("." + nameRequester + "-" + nameAcceptor + ".address");
+
+  Publisher::ScopedChangePrefixDirectory scpd(_addressDirectory);
+
+  Publisher p(addressFileName);
+
+  return p.read();
+}
+
+std::string SharedMemoryCommunication::prepareConnectionAsServer()
+{
+  TRACE();
+
+  assertion(not isConnected());
+
+  static std::atomic<int> counter(0);
+
+  std::string name = "/precice-" + std::to_string(getpid()) + "-" + std::to_string(counter++);
+
+  void *memory = mapSegment(name, sizeof(ControlBlock), true);
+
+  CHECK(memory != nullptr, "Creating shared memory segment " << name << " failed: " << std::strerror(errno));
+
+  ControlBlock *block = new (memory) ControlBlock;
+  block->tickets.store(0);
+  block->connected.store(0);
+  block->requesterSize.store(0);
+  block->acceptorRank = 0;
+  block->acceptorSize = 1;
+  block->bufferSize   = _bufferSize;
+
+  _control = std::make_shared<Control>(name, memory);
+
+  return getHostName() + ":" + name;
+}
+
+int SharedMemoryCommunication::requestConnectionAsClientAt(std::string const &address)
+{
+  TRACE(address);
+
+  assertion(not isConnected());
+
+  connect(address, -1, 0);
+
+  return _rank;
+}
+
+void SharedMemoryCommunication::connect(std::string const &address,
+                                        int                requesterProcessRank,
+                                        int                requesterCommunicatorSize)
+{
+  TRACE(address, requesterProcessRank, requesterCommunicatorSize);
+
+  DEBUG("Request connection to " << address);
+
+  std::string hostName    = address.substr(0, address.rfind(":"));
+  std::string controlName = address.substr(hostName.length() + 1);
+
+  CHECK(hostName == getHostName(),
+        "Shared memory communication requires both participants on the same host, but the acceptor runs on \""
+            << hostName << "\" and the requester on \"" << getHostName() << "\"!");
+
+  void *memory = mapSegment(controlName, sizeof(ControlBlock), false);
+
+  CHECK(memory != nullptr, "Opening shared memory segment " << controlName << " failed: " << std::strerror(errno));
+
+  Control control(controlName, memory);
+
+  CHECK(control.block->acceptorRank == 0, "Acceptor base rank has to be 0 but is " << control.block->acceptorRank << "!");
+  CHECK(control.block->acceptorSize == 1, "Acceptor communicator size has to be 1!");
+
+  if (requesterProcessRank < 0) {
+    requesterProcessRank = control.block->tickets.fetch_add(1);
+  } else {
+    uint32_t size = 0;
+    control.block->requesterSize.compare_exchange_strong(size, requesterCommunicatorSize);
+    CHECK(size == 0 || size == static_cast<uint32_t>(requesterCommunicatorSize),
+          "Remote communicator sizes are inconsistent!");
+  }
+
+  _bufferSize = control.block->bufferSize;
+
+  std::string name        = controlName + "-" + std::to_string(requesterProcessRank);
+  size_t      segmentSize = Channel::segmentSize(_bufferSize);
+  void *      channelMemory = mapSegment(name, segmentSize, true);
+
+  CHECK(channelMemory != nullptr, "Creating shared memory segment " << name << " failed: " << std::strerror(errno));
+
+  ChannelBlock *block = new (channelMemory) ChannelBlock;
+  block->closed.store(0);
+  for (RingBlock *ring : {&block->toAcceptor, &block->toRequester}) {
+    ring->written.store(0);
+    ring->readerWaiting.store(0);
+    ring->read.store(0);
+    ring->writerWaiting.store(0);
+  }
+
+  _channels.push_back(std::make_shared<Channel>(channelMemory, _bufferSize, false));
+
+  // Announces the initialized channel to the acceptor
+  control.block->connected.fetch_add(1);
+  futexWake(control.block->connected);
+
+  DEBUG("Requested connection to " << address);
+
+  _rank        = requesterProcessRank;
+  _isConnected = true;
+}
+
+void SharedMemoryCommunication::closeConnection()
+{
+  TRACE();
+
+  if (_control) {
+    shm_unlink(_control->name.c_str());
+    _control.reset();
+  }
+
+  if (not isConnected())
+    return;
+
+  _channels.clear();
+
+  _isConnected = false;
+}
+
+void SharedMemoryCommunication::startSendPackage(int rankReceiver)
+{
+}
+
+void SharedMemoryCommunication::finishSendPackage()
+{
+}
+
+int SharedMemoryCommunication::startReceivePackage(int rankSender)
+{
+  TRACE(rankSender);
+
+  return rankSender;
+}
+
+void SharedMemoryCommunication::finishReceivePackage()
+{
+}
+
+SharedMemoryCommunication::Channel &SharedMemoryCommunication::channel(int rank)
+{
+  rank = rank - _rankOffset;
+
+  assertion((rank >= 0) && (rank < (int) _channels.size()), rank, _channels.size());
+  assertion(isConnected());
+
+  return *_channels[rank];
+}
+
+void SharedMemoryCommunication::sendBytes(void const *data, size_t size, int rankReceiver)
+{
+  CHECK(channel(rankReceiver).out.write(static_cast<char const *>(data), size),
+        "Send failed: connection closed by remote process");
+}
+
+void SharedMemoryCommunication::receiveBytes(void *data, size_t size, int rankSender)
+{
+  CHECK(channel(rankSender).in.read(static_cast<char *>(data), size),
+        "Receive failed: connection closed by remote process");
+}
+
+PtrRequest SharedMemoryCommunication::aSendBytes(void const *data, size_t size, int rankReceiver)
+{
+  Channel &c = channel(rankReceiver);
+  return std::make_shared<SharedMemoryRequest>(c.sendWorker.post([&c, data, size] {
+    CHECK(c.out.write(static_cast<char const *>(data), size),
+          "Send failed: connection closed by remote process");
+  }));
+}
+
+PtrRequest SharedMemoryCommunication::aReceiveBytes(void *data, size_t size, int rankSender)
+{
+  Channel &c = channel(rankSender);
+  return std::make_shared<SharedMemoryRequest>(c.receiveWorker.post([&c, data, size] {
+    CHECK(c.in.read(static_cast<char *>(data), size),
+          "Receive failed: connection closed by remote process");
+  }));
+}
+
+void SharedMemoryCommunication::send(std::string const &itemToSend, int rankReceiver)
+{
+  TRACE(itemToSend, rankReceiver);
+
+  size_t size = itemToSend.size() + 1;
+  sendBytes(&size, sizeof(size_t), rankReceiver);
+  sendBytes(itemToSend.c_str(), size, rankReceiver);
+}
+
+void SharedMemoryCommunication::send(int *itemsToSend, int size, int rankReceiver)
+{
+  TRACE(size, rankReceiver);
+
+  sendBytes(itemsToSend, size * sizeof(int), rankReceiver);
+}
+
+PtrRequest SharedMemoryCommunication::aSend(int *itemsToSend, int size, int rankReceiver)
+{
+  TRACE(size, rankReceiver);
+
+  return aSendBytes(itemsToSend, size * sizeof(int), rankReceiver);
+}
+
+void SharedMemoryCommunication::send(double *itemsToSend, int size, int rankReceiver)
+{
+  TRACE(size, rankReceiver);
+
+  sendBytes(itemsToSend, size * sizeof(double), rankReceiver);
+}
+
+PtrRequest SharedMemoryCommunication::aSend(double *itemsToSend, int size, int rankReceiver)
+{
+  TRACE(size, rankReceiver);
+
+  return aSendBytes(itemsToSend, size * sizeof(double), rankReceiver);
+}
+
+void SharedMemoryCommunication::send(double itemToSend, int rankReceiver)
+{
+  TRACE(itemToSend, rankReceiver);
+
+  sendBytes(&itemToSend, sizeof(double), rankReceiver);
+}
+
+PtrRequest SharedMemoryCommunication::aSend(double *itemToSend, int rankReceiver)
+{
+  return aSend(itemToSend, 1, rankReceiver);
+}
+
+void SharedMemoryCommunication::send(int itemToSend, int rankReceiver)
+{
+  TRACE(itemToSend, rankReceiver);
+
+  sendBytes(&itemToSend, sizeof(int), rankReceiver);
+}
+
+PtrRequest SharedMemoryCommunication::aSend(int *itemToSend, int rankReceiver)
+{
+  return aSend(itemToSend, 1, rankReceiver);
+}
+
+void SharedMemoryCommunication::send(bool itemToSend, int rankReceiver)
+{
+  TRACE(itemToSend, rankReceiver);
+
+  sendBytes(&itemToSend, sizeof(bool), rankReceiver);
+}
+
+PtrRequest SharedMemoryCommunication::aSend(bool *itemToSend, int rankReceiver)
+{
+  TRACE(rankReceiver);
+
+  return aSendBytes(itemToSend, sizeof(bool), rankReceiver);
+}
+
+void SharedMemoryCommunication::receive(std::string &itemToReceive, int rankSender)
+{
+  TRACE(rankSender);
+
+  size_t size = 0;
+  receiveBytes(&size, sizeof(size_t), rankSender);
+  std::vector<char> msg(size);
+  receiveBytes(msg.data(), size, rankSender);
+  itemToReceive = msg.data();
+}
+
+void SharedMemoryCommunication::receive(int *itemsToReceive, int size, int rankSender)
+{
+  TRACE(size, rankSender);
+
+  receiveBytes(itemsToReceive, size * sizeof(int), rankSender);
+}
+
+PtrRequest SharedMemoryCommunication::aReceive(int *itemsToReceive, int size, int rankSender)
+{
+  TRACE(size, rankSender);
+
+  return aReceiveBytes(itemsToReceive, size * sizeof(int), rankSender);
+}
+
+void SharedMemoryCommunication::receive(double *itemsToReceive, int size, int rankSender)
+{
+  TRACE(size, rankSender);
+
+  receiveBytes(itemsToReceive, size * sizeof(double), rankSender);
+}
+
+PtrRequest SharedMemoryCommunication::aReceive(double *itemsToReceive, int size, int rankSender)
+{
+  TRACE(size, rankSender);
+
+  return aReceiveBytes(itemsToReceive, size * sizeof(double), rankSender);
+}
+
+void SharedMemoryCommunication::receive(double &itemToReceive, int rankSender)
+{
+  TRACE(rankSender);
+
+  receiveBytes(&itemToReceive, sizeof(double), rankSender);
+}
+
+PtrRequest SharedMemoryCommunication::aReceive(double *itemToReceive, int rankSender)
+{
+  return aReceive(itemToReceive, 1, rankSender);
+}
+
+void SharedMemoryCommunication::receive(int &itemToReceive, int rankSender)
+{
+  TRACE(rankSender);
+
+  receiveBytes(&itemToReceive, sizeof(int), rankSender);
+}
+
+PtrRequest SharedMemoryCommunication::aReceive(int *itemToReceive, int rankSender)
+{
+  return aReceive(itemToReceive, 1, rankSender);
+}
+
+void SharedMemoryCommunication::receive(bool &itemToReceive, int rankSender)
+{
+  TRACE(rankSender);
+
+  receiveBytes(&itemToReceive, sizeof(bool), rankSender);
+}
+
+PtrRequest SharedMemoryCommunication::aReceive(bool *itemToReceive, int rankSender)
+{
+  TRACE(rankSender);
+
+  return aReceiveBytes(itemToReceive, sizeof(bool), rankSender);
+}
+}
+} // namespace precice, com
+
+#endif // not PRECICE_NO_SHARED_MEMORY
@@ -0,0 +1,237 @@
+#ifndef PRECICE_NO_SHARED_MEMORY
+
+#pragma once
+
+#include "com/Communication.hpp"
+
+#include "logging/Logger.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace precice
+{
+namespace com
+{
+/**
+ * @brief Implements Communication by ring buffers in POSIX shared memory.
+ *
+ * Only processes on the same host can be connected. Each pair of connected
+ * processes shares one memory segment with a ring buffer per direction, a
+ * blocked sender or receiver sleeps on a futex of the ring. Compared to
+ * sockets over the loopback device, no data is copied by the kernel.
+ *
+ * The acceptor publishes the name of a control segment in an address file,
+ * like SocketCommunication. Each requester creates the segment of its
+ * connection and announces it in the control segment.
+ */
+class SharedMemoryCommunication : public Communication
+{
+public:
+  /// Default capacity in bytes of the ring buffer of each direction.
+  static const size_t defaultBufferSize = 1 << 20;
+
+  /**
+   * @param[in] bufferSize Capacity of the ring buffers in bytes, rounded up to a power of two.
+   * @param[in] addressDirectory Directory of the address files.
+   */
+  explicit SharedMemoryCommunication(size_t             bufferSize       = defaultBufferSize,
+                                     std::string const &addressDirectory = ".");
+
+  virtual ~SharedMemoryCommunication();
+
+  /// Returns true, if a connection to a remote participant has been setup.
+  virtual bool isConnected();
+
+  /**
+   * @brief Returns the number of processes in the remote communicator.
+   *
+   * Precondition: a connection to the remote participant has been setup.
+   */
+  virtual size_t getRemoteCommunicatorSize();
+
+  /**
+   * @brief Accepts connection from participant, which has to call
+   * requestConnection().
+   *
+   * The acceptor can only have one process, all requester processes connect
+   * to it.
+   *
+   * @param[in] nameAcceptor Name of calling participant.
+   * @param[in] nameRequester Name of remote participant to connect to.
+   */
+  virtual void acceptConnection(std::string const &nameAcceptor,
+                                std::string const &nameRequester,
+                                int                acceptorProcessRank,
+                                int                acceptorCommunicatorSize);
+
+  virtual void acceptConnectionAsServer(std::string const &nameAcceptor,
+                                        std::string const &nameRequester,
+                                        int                requesterCommunicatorSize);
+
+  /**
+   * @brief Requests connection from participant, which has to call
+   * acceptConnection().
+   *
+   * @param[in] nameAcceptor Name of remote participant to connect to.
+   * @param[in] nameRequester Name of calling participant.
+   */
+  virtual void requestConnection(std::string const &nameAcceptor,
+                                 std::string const &nameRequester,
+                                 int                requesterProcessRank,
+                                 int                requesterCommunicatorSize);
+
+  virtual int requestConnectionAsClient(std::string const &nameAcceptor,
+                                        std::string const &nameRequester);
+
+  /// See precice::com::Communication::prepareConnectionAsServer().
+  virtual std::string prepareConnectionAsServer();
+
+  /// See precice::com::Communication::requestConnectionAsClientAt().
+  virtual int requestConnectionAsClientAt(std::string const &address);
+
+  /// See precice::com::Communication::readAddressAsClient().
+  virtual std::string readAddressAsClient(std::string const &nameAcceptor,
+                                          std::string const &nameRequester);
+
+  /**
+   * @brief Disconnects from communication space, i.e. participant.
+   *
+   * Waits for pending asynchronous requests. This method is called on
+   * destruction.
+   */
+  virtual void closeConnection();
+
+  /// Is empty.
+  virtual void startSendPackage(int rankReceiver);
+
+  /// Is empty.
+  virtual void finishSendPackage();
+
+  /// Just returns rank of sender.
+  virtual int startReceivePackage(int rankSender);
+
+  /// Is empty.
+  virtual void finishReceivePackage();
+
+  /// Sends a std::string to process with given rank.
+  virtual void send(std::string const &itemToSend, int rankReceiver);
+
+  /// Sends an array of integer values.
+  virtual void send(int *itemsToSend, int size, int rankReceiver);
+
+  /// Asynchronously sends an array of integer values.
+  virtual PtrRequest aSend(int *itemsToSend,
+                           int  size,
+                           int  rankReceiver);
+
+  /// Sends an array of double values.
+  virtual void send(double *itemsToSend, int size, int rankReceiver);
+
+  /// Asynchronously sends an array of double values.
+  virtual PtrRequest aSend(double *itemsToSend,
+                           int     size,
+                           int     rankReceiver);
+
+  /// Sends a double to process with given rank.
+  virtual void send(double itemToSend, int rankReceiver);
+
+  /// Asynchronously sends a double to process with given rank.
+  virtual PtrRequest aSend(double *itemToSend, int rankReceiver);
+
+  /// Sends an int to process with given rank.
+  virtual void send(int itemToSend, int rankReceiver);
+
+  /// Asynchronously sends an int to process with given rank.
+  virtual PtrRequest aSend(int *itemToSend, int rankReceiver);
+
+  /// Sends a bool to process with given rank.
+  virtual void send(bool itemToSend, int rankReceiver);
+
+  /// Asynchronously sends a bool to process with given rank.
+  virtual PtrRequest aSend(bool *itemToSend, int rankReceiver);
+
+  /// Receives a std::string from process with given rank.
+  virtual void receive(std::string &itemToReceive, int rankSender);
+
+  /// Receives an array of integer values.
+  virtual void receive(int *itemsToReceive, int size, int rankSender);
+
+  /// Asynchronously receives an array of integer values.
+  virtual PtrRequest aReceive(int *itemsToReceive,
+                              int  size,
+                              int  rankSender);
+
+  /// Receives an array of double values.
+  virtual void receive(double *itemsToReceive, int size, int rankSender);
+
+  /// Asynchronously receives an array of double values.
+  virtual PtrRequest aReceive(double *itemsToReceive,
+                              int     size,
+                              int     rankSender);
+
+  /// Receives a double from process with given rank.
+  virtual void receive(double &itemToReceive, int rankSender);
+
+  /// Asynchronously receives a double from process with given rank.
+  virtual PtrRequest aReceive(double *itemToReceive, int rankSender);
+
+  /// Receives an int from process with given rank.
+  virtual void receive(int &itemToReceive, int rankSender);
+
+  /// Asynchronously receives an int from process with given rank.
+  virtual PtrRequest aReceive(int *itemToReceive, int rankSender);
+
+  /// Receives a bool from process with given rank.
+  virtual void receive(bool &itemToReceive, int rankSender);
+
+  /// Asynchronously receives a bool from process with given rank.
+  virtual PtrRequest aReceive(bool *itemToReceive, int rankSender);
+
+private:
+  static logging::Logger _log;
+
+  /// Capacity of the ring buffers in bytes, a power of two.
+  size_t _bufferSize;
+
+  /// Directory where the name of the control segment is exchanged by file.
+  std::string _addressDirectory;
+
+  bool _isConnected;
+
+  struct Control;
+
+  /// Control segment opened by prepareConnectionAsServer(), until the connections are accepted.
+  std::shared_ptr<Control> _control;
+
+  struct Channel;
+
+  /// Connection to each remote process, indexed by its rank.
+  std::vector<std::shared_ptr<Channel>> _channels;
+
+  /// Waits for the given number of requesters and opens their channels.
+  void acceptChannels(int requesterCommunicatorSize);
+
+  /**
+   * @brief Creates the channel to the acceptor at the given address.
+   *
+   * @param[in] requesterProcessRank Rank of this process, or -1 to be assigned one by the acceptor.
+   * @param[in] requesterCommunicatorSize Number of requesters, ignored if the rank is assigned.
+   */
+  void connect(std::string const &address, int requesterProcessRank, int requesterCommunicatorSize);
+
+  Channel &channel(int rank);
+
+  void sendBytes(void const *data, size_t size, int rankReceiver);
+
+  void receiveBytes(void *data, size_t size, int rankSender);
+
+  PtrRequest aSendBytes(void const *data, size_t size, int rankReceiver);
+
+  PtrRequest aReceiveBytes(void *data, size_t size, int rankSender);
+};
+}
+} // namespace precice, com
+
+#endif // not PRECICE_NO_SHARED_MEMORY
@@ -0,0 +1,40 @@
+#ifndef PRECICE_NO_SHARED_MEMORY
+
+#include "SharedMemoryCommunicationFactory.hpp"
+
+#include "SharedMemoryCommunication.hpp"
+#include "com/SharedPointer.hpp"
+
+namespace precice
+{
+namespace com
+{
+SharedMemoryCommunicationFactory::SharedMemoryCommunicationFactory(
+    size_t             bufferSize,
+    std::string const &addressDirectory)
+    : _bufferSize(bufferSize), _addressDirectory(addressDirectory)
+{
+  if (_addressDirectory.empty()) {
+    _addressDirectory = ".";
+  }
+}
+
+PtrCommunication SharedMemoryCommunicationFactory::newCommunication()
+{
+  return PtrCommunication(new SharedMemoryCommunication(_bufferSize, _addressDirectory));
+}
+
+std::string
+SharedMemoryCommunicationFactory::addressDirectory()
+{
+  return _addressDirectory;
+}
+
+bool SharedMemoryCommunicationFactory::supportsConcurrentConnections()
+{
+  return true;
+}
+}
+} // namespace precice, com
+
+#endif // not PRECICE_NO_SHARED_MEMORY
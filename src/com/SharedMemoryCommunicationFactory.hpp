@@ -0,0 +1,35 @@
+#ifndef PRECICE_NO_SHARED_MEMORY
+
+#pragma once
+
+#include "CommunicationFactory.hpp"
+#include "com/SharedPointer.hpp"
+
+#include <string>
+
+namespace precice
+{
+namespace com
+{
+class SharedMemoryCommunicationFactory : public CommunicationFactory
+{
+public:
+  /// See SharedMemoryCommunication::SharedMemoryCommunication() for the arguments.
+  SharedMemoryCommunicationFactory(size_t             bufferSize,
+                                   std::string const &addressDirectory = ".");
+
+  PtrCommunication newCommunication();
+
+  std::string addressDirectory();
+
+  /// The connections of different communications are independent of each other.
+  bool supportsConcurrentConnections();
+
+private:
+  size_t      _bufferSize;
+  std::string _addressDirectory;
+};
+}
+} // namespace precice, com
+
+#endif // not PRECICE_NO_SHARED_MEMORY
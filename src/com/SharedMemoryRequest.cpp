@@ -0,0 +1,28 @@
+#ifndef PRECICE_NO_SHARED_MEMORY
+
+#include "SharedMemoryRequest.hpp"
+
+#include <chrono>
+
+namespace precice
+{
+namespace com
+{
+SharedMemoryRequest::SharedMemoryRequest(std::shared_future<void> completion)
+    : _completion(std::move(completion))
+{
+}
+
+bool SharedMemoryRequest::test()
+{
+  return _completion.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
+void SharedMemoryRequest::wait()
+{
+  _completion.wait();
+}
+}
+} // namespace precice, com
+
+#endif // not PRECICE_NO_SHARED_MEMORY
@@ -0,0 +1,29 @@
+#ifndef PRECICE_NO_SHARED_MEMORY
+
+#pragma once
+
+#include "Request.hpp"
+
+#include <future>
+
+namespace precice
+{
+namespace com
+{
+/// Request of an operation executed in the background by SharedMemoryCommunication.
+class SharedMemoryRequest : public Request
+{
+public:
+  explicit SharedMemoryRequest(std::shared_future<void> completion);
+
+  bool test();
+
+  void wait();
+
+private:
+  std::shared_future<void> _completion;
+};
+}
+} // namespace precice, com
+
+#endif // not PRECICE_NO_SHARED_MEMORY
@@ -7,6 +7,7 @@
 #include "utils/Publisher.hpp"
 #include "utils/assertion.hpp"
 
+#include <memory>
 #include <sstream>
 
 using precice::utils::Publisher;
@@ -19,6 +20,16 @@ namespace com
 
 namespace asio = boost::asio;
 
+/// Listening endpoint of a server, kept open between prepareConnectionAsServer() and acceptConnectionAsServer()
+struct SocketCommunication::Acceptor {
+  explicit Acceptor(asio::io_service &ioService)
+      : acceptor(ioService) {}
+
+  asio::ip::tcp::acceptor acceptor;
+
+  std::string address;
+};
+
 logging::Logger SocketCommunication::_log(
     "precice::com::SocketCommunication");
 
@@ -26,7 +37,7 @@ SocketCommunication::SocketCommunication(unsigned short     portNumber,
                                          bool               reuseAddress,
                                          std::string const &networkName,
                                          std::string const &addressDirectory)
-    : _portNumber(portNumber), _reuseAddress(reuseAddress), _networkName(networkName), _addressDirectory(addressDirectory), _isConnected(false), _remoteCommunicatorSize(0), _ioService(new IOService), _sockets(), _work(), _thread()
+    : _portNumber(portNumber), _reuseAddress(reuseAddress), _networkName(networkName), _addressDirectory(addressDirectory), _isConnected(false), _remoteCommunicatorSize(0), _ioService(new IOService), _sockets(), _work(), _thread(), _acceptor()
 {
   if (_addressDirectory.empty()) {
     _addressDirectory = ".";
@@ -188,34 +199,21 @@ void SocketCommunication::acceptConnectionAsServer(std::string const &nameAccept
                               ".address");
 
   try {
-    std::string ipAddress = getIpAddress();
+    std::unique_ptr<ScopedPublisher> p;
 
-    CHECK(not ipAddress.empty(),
-          "Network \"" << _networkName << "\" not found for socket connection!");
-
-    using asio::ip::tcp;
+    if (_acceptor) {
+      // The address has been passed to the requesters by other means
+      address = _acceptor->address;
+    } else {
+      address = prepareConnectionAsServer();
 
-    tcp::acceptor acceptor(*_ioService);
+      Publisher::ScopedChangePrefixDirectory scpd(_addressDirectory);
 
-    {
-      tcp::endpoint endpoint(tcp::v4(), _portNumber);
+      p.reset(new ScopedPublisher(addressFileName));
 
-      acceptor.open(endpoint.protocol());
-      acceptor.set_option(tcp::acceptor::reuse_address(_reuseAddress));
-      acceptor.bind(endpoint);
-      acceptor.listen();
-
-      _portNumber = acceptor.local_endpoint().port();
+      p->write(address);
     }
 
-    address = ipAddress + ":" + std::to_string(_portNumber);
-
-    Publisher::ScopedChangePrefixDirectory scpd(_addressDirectory);
-
-    ScopedPublisher p(addressFileName);
-
-    p.write(address);
-
     DEBUG("Accept connection at " << address);
 
     _sockets.resize(_remoteCommunicatorSize);
@@ -224,7 +222,7 @@ void SocketCommunication::acceptConnectionAsServer(std::string const &nameAccept
          ++remoteRank) {
       PtrSocket socket = PtrSocket(new Socket(*_ioService));
 
-      acceptor.accept(*socket);
+      _acceptor->acceptor.accept(*socket);
 
       DEBUG("Accepted connection at " << address);
 
@@ -241,7 +239,8 @@ void SocketCommunication::acceptConnectionAsServer(std::string const &nameAccept
       send(1, remoteRank);
     }
 
-    acceptor.close();
+    _acceptor->acceptor.close();
+    _acceptor.reset();
   } catch (std::exception &e) {
     ERROR(
         "Accepting connection at " << address
@@ -346,19 +345,64 @@ int SocketCommunication::requestConnectionAsClient(
 {
   TRACE(nameAcceptor, nameRequester);
 
-  assertion(not isConnected());
+  return requestConnectionAsClientAt(readAddressAsClient(nameAcceptor, nameRequester));
+}
+
+std::string SocketCommunication::readAddressAsClient(
+    std::string const &nameAcceptor, std::string const &nameRequester)
+{
+  TRACE(nameAcceptor, nameRequester);
 
-  std::string address;
   std::string addressFileName("." + nameRequester + "-" + nameAcceptor +
                               ".address");
 
+  Publisher::ScopedChangePrefixDirectory scpd(_addressDirectory);
+
+  Publisher p(addressFileName);
+
+  return p.read();
+}
+
+std::string SocketCommunication::prepareConnectionAsServer()
+{
+  TRACE();
+
+  assertion(not isConnected());
+
   try {
-    Publisher::ScopedChangePrefixDirectory scpd(_addressDirectory);
+    std::string ipAddress = getIpAddress();
 
-    Publisher p(addressFileName);
+    CHECK(not ipAddress.empty(),
+          "Network \"" << _networkName << "\" not found for socket connection!");
+
+    using asio::ip::tcp;
+
+    _acceptor = std::make_shared<Acceptor>(*_ioService);
+
+    tcp::endpoint endpoint(tcp::v4(), _portNumber);
+
+    _acceptor->acceptor.open(endpoint.protocol());
+    _acceptor->acceptor.set_option(tcp::acceptor::reuse_address(_reuseAddress));
+    _acceptor->acceptor.bind(endpoint);
+    _acceptor->acceptor.listen();
+
+    _portNumber = _acceptor->acceptor.local_endpoint().port();
+
+    _acceptor->address = ipAddress + ":" + std::to_string(_portNumber);
+  } catch (std::exception &e) {
+    ERROR("Opening server endpoint failed: " << e.what());
+  }
+
+  return _acceptor->address;
+}
 
-    std::string address = p.read();
+int SocketCommunication::requestConnectionAsClientAt(std::string const &address)
+{
+  TRACE(address);
+
+  assertion(not isConnected());
 
+  try {
     DEBUG("Request connection to " << address);
 
     std::string ipAddress  = address.substr(0, address.find(":"));
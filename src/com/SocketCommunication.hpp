@@ -94,6 +94,16 @@ public:
   virtual int requestConnectionAsClient(std::string const &nameAcceptor,
                                         std::string const &nameRequester);
 
+  /// See precice::com::Communication::prepareConnectionAsServer().
+  virtual std::string prepareConnectionAsServer();
+
+  /// See precice::com::Communication::requestConnectionAsClientAt().
+  virtual int requestConnectionAsClientAt(std::string const &address);
+
+  /// See precice::com::Communication::readAddressAsClient().
+  virtual std::string readAddressAsClient(std::string const &nameAcceptor,
+                                          std::string const &nameRequester);
+
   /**
    * @brief Disconnects from communication space, i.e. participant.
    *
@@ -269,6 +279,11 @@ private:
 
   std::thread _thread;
 
+  struct Acceptor;
+
+  /// Server endpoint opened by prepareConnectionAsServer(), until the connections are accepted.
+  std::shared_ptr<Acceptor> _acceptor;
+
   bool isClient();
   bool isServer();
 
@@ -36,5 +36,10 @@ SocketCommunicationFactory::addressDirectory()
 {
   return _addressDirectory;
 }
+
+bool SocketCommunicationFactory::supportsConcurrentConnections()
+{
+  return true;
+}
 }
 } // namespace precice, com
@@ -25,6 +25,9 @@ public:
 
   std::string addressDirectory();
 
+  /// Each socket communication connects with its own IO service.
+  bool supportsConcurrentConnections();
+
 private:
   unsigned short _portNumber;
   bool           _reuseAddress;
@@ -0,0 +1,64 @@
+#ifndef PRECICE_NO_MPI
+
+#include "com/CommunicateMesh.hpp"
+#include "com/MPIDirectCommunication.hpp"
+#include "mesh/Mesh.hpp"
+#include "testing/Benchmark.hpp"
+#include "testing/BenchmarkMeshes.hpp"
+#include "utils/Parallel.hpp"
+
+using namespace precice;
+using precice::testing::BenchmarkState;
+
+namespace
+{
+
+/// Sends a triangulated grid mesh from rank 0 to rank 1, the receiver gets a fresh mesh each iteration.
+void benchmarkCommunicateMesh(BenchmarkState& state, int vertices)
+{
+  int rank = utils::Parallel::getProcessRank();
+  mesh::PtrMesh mesh = rank == 0 ? testing::createGridMesh("Mesh", vertices, true)
+                                 : mesh::PtrMesh(new mesh::Mesh("Mesh", 3, false));
+
+  com::PtrCommunication communication(new com::MPIDirectCommunication());
+  com::CommunicateMesh communicateMesh(communication);
+  if (rank == 0) {
+    utils::Parallel::splitCommunicator("Sender");
+    communication->acceptConnection("Sender", "Receiver", 0, 1);
+  }
+  else {
+    utils::Parallel::splitCommunicator("Receiver");
+    communication->requestConnection("Sender", "Receiver", 0, 1);
+  }
+
+  while (state.keepRunning()) {
+    if (rank == 0) {
+      communicateMesh.sendMesh(*mesh, 0);
+    }
+    else {
+      communicateMesh.receiveMesh(*mesh, 0);
+      state.pauseTiming();
+      mesh->clear();
+      state.resumeTiming();
+    }
+  }
+  communication->closeConnection();
+
+  int sent = rank == 0 ? mesh->vertices().size() : 0;
+  state.setItemsProcessed(static_cast<double>(state.iterations()) * sent);
+  state.setCounter("vertices", sent);
+}
+
+bool registered = [] {
+  for (int vertices : {10000, 100000, 1000000}) {
+    testing::registerBenchmark(
+        "CommunicateMesh/" + std::to_string(vertices),
+        [vertices](BenchmarkState& state) { benchmarkCommunicateMesh(state, vertices); },
+        std::max(1, 1000000 / vertices), 2);
+  }
+  return true;
+}();
+
+} // namespace
+
+#endif // not PRECICE_NO_MPI
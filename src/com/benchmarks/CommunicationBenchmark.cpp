@@ -0,0 +1,100 @@
+#ifndef PRECICE_NO_MPI
+
+#include "com/SharedMemoryCommunication.hpp"
+#include "com/SharedMemoryCommunicationFactory.hpp"
+#include "com/SocketCommunicationFactory.hpp"
+#include "testing/Benchmark.hpp"
+#include "utils/Parallel.hpp"
+
+#include <functional>
+#include <vector>
+
+using namespace precice;
+using precice::testing::BenchmarkState;
+
+namespace
+{
+
+/// Connects rank 0 as acceptor and rank 1 as requester of a new communication of the factory.
+com::PtrCommunication connect(com::CommunicationFactory& factory)
+{
+  com::PtrCommunication communication = factory.newCommunication();
+  if (utils::Parallel::getProcessRank() == 0) {
+    communication->acceptConnection("Acceptor", "Requester", 0, 1);
+  }
+  else {
+    communication->requestConnection("Acceptor", "Requester", 0, 1);
+  }
+  return communication;
+}
+
+/// Sends one double from rank 0 to rank 1 and back, an iteration is one round trip.
+void benchmarkLatency(BenchmarkState& state, com::PtrCommunicationFactory factory)
+{
+  com::PtrCommunication communication = connect(*factory);
+  bool   isAcceptor = utils::Parallel::getProcessRank() == 0;
+  double value      = 1.0;
+  while (state.keepRunning()) {
+    if (isAcceptor) {
+      communication->send(value, 0);
+      communication->receive(value, 0);
+    }
+    else {
+      communication->receive(value, 0);
+      communication->send(value, 0);
+    }
+  }
+  communication->closeConnection();
+  state.setItemsProcessed(static_cast<double>(state.iterations()));
+}
+
+/// Sends an array of doubles from rank 0 to rank 1, which acknowledges the receipt with one int.
+void benchmarkBandwidth(BenchmarkState& state, com::PtrCommunicationFactory factory, int size)
+{
+  com::PtrCommunication communication = connect(*factory);
+  bool   isAcceptor = utils::Parallel::getProcessRank() == 0;
+  std::vector<double> data(size, 1.0);
+  int    acknowledgement = 0;
+  while (state.keepRunning()) {
+    if (isAcceptor) {
+      communication->send(data.data(), size, 0);
+      communication->receive(acknowledgement, 0);
+    }
+    else {
+      communication->receive(data.data(), size, 0);
+      communication->send(acknowledgement, 0);
+    }
+  }
+  communication->closeConnection();
+  state.setItemsProcessed(static_cast<double>(state.iterations()) * size * sizeof(double));
+  state.setCounter("bytes", size * sizeof(double));
+}
+
+/// Registers latency and bandwidth cases of a backend, both processes run on the same host.
+void registerBackend(const std::string& name, std::function<com::PtrCommunicationFactory()> createFactory)
+{
+  testing::registerBenchmark(
+      "CommunicationLatency/" + name,
+      [createFactory](BenchmarkState& state) { benchmarkLatency(state, createFactory()); },
+      10000, 2);
+  for (int size : {1000, 100000, 10000000}) {
+    testing::registerBenchmark(
+        "CommunicationBandwidth/" + name + "/" + std::to_string(size),
+        [createFactory, size](BenchmarkState& state) { benchmarkBandwidth(state, createFactory(), size); },
+        std::max(10, 10000000 / size), 2);
+  }
+}
+
+bool registered = [] {
+  registerBackend("Sockets", [] { return std::make_shared<com::SocketCommunicationFactory>(); });
+#ifndef PRECICE_NO_SHARED_MEMORY
+  registerBackend("SharedMemory", [] {
+      return std::make_shared<com::SharedMemoryCommunicationFactory>(com::SharedMemoryCommunication::defaultBufferSize);
+    });
+#endif
+  return true;
+}();
+
+} // namespace
+
+#endif // not PRECICE_NO_MPI
@@ -0,0 +1,158 @@
+#ifndef PRECICE_NO_SHARED_MEMORY
+
+#include "com/SharedMemoryCommunication.hpp"
+#include "testing/Testing.hpp"
+#include "utils/Parallel.hpp"
+
+using namespace precice;
+using namespace precice::com;
+
+BOOST_AUTO_TEST_SUITE(CommunicationTests)
+
+BOOST_AUTO_TEST_SUITE(SharedMemory)
+
+BOOST_AUTO_TEST_CASE(SendAndReceive,
+                     *testing::OnSize(2))
+{
+  SharedMemoryCommunication com;
+  if (utils::Parallel::getProcessRank() == 0) {
+    com.acceptConnection("process0", "process1", 0, 1);
+    BOOST_TEST(com.getRemoteCommunicatorSize() == 1);
+    {
+      std::string msg("testOne");
+      com.send(msg, 0);
+      com.receive(msg, 0);
+      BOOST_TEST(msg == std::string("testTwo"));
+    }
+    {
+      Eigen::Vector3d msg = Eigen::Vector3d::Constant(0);
+      com.receive(msg.data(), msg.size(), 0);
+      BOOST_CHECK(testing::equals(msg, Eigen::Vector3d::Constant(1)));
+      msg = Eigen::Vector3d::Constant(2);
+      com.send(msg.data(), msg.size(), 0);
+    }
+    {
+      double msg = 0.0;
+      com.send(msg, 0);
+      com.receive(msg, 0);
+      BOOST_TEST(msg == 1.0);
+    }
+    {
+      int msg = 1;
+      com.send(msg, 0);
+      com.receive(msg, 0);
+      BOOST_TEST(msg == 2);
+    }
+    {
+      bool msg = true;
+      com.send(msg, 0);
+      com.receive(msg, 0);
+      BOOST_TEST(msg == false);
+    }
+    com.closeConnection();
+  } else if (utils::Parallel::getProcessRank() == 1) {
+    com.requestConnection("process0", "process1", 0, 1);
+    BOOST_TEST(com.getRemoteCommunicatorSize() == 1);
+    {
+      std::string msg;
+      com.receive(msg, 0);
+      BOOST_TEST(msg == std::string("testOne"));
+      msg = "testTwo";
+      com.send(msg, 0);
+    }
+    {
+      Eigen::Vector3d msg = Eigen::Vector3d::Constant(1);
+      com.send(msg.data(), msg.size(), 0);
+      com.receive(msg.data(), msg.size(), 0);
+      BOOST_CHECK(testing::equals(msg, Eigen::Vector3d::Constant(2)));
+    }
+    {
+      double msg = 1.0;
+      com.receive(msg, 0);
+      BOOST_TEST(msg == 0.0);
+      msg = 1.0;
+      com.send(msg, 0);
+    }
+    {
+      int msg = 0;
+      com.receive(msg, 0);
+      BOOST_TEST(msg == 1);
+      msg = 2;
+      com.send(msg, 0);
+    }
+    {
+      bool msg = false;
+      com.receive(msg, 0);
+      BOOST_TEST(msg == true);
+      msg = false;
+      com.send(msg, 0);
+    }
+    com.closeConnection();
+  }
+}
+
+BOOST_AUTO_TEST_CASE(ParallelClient,
+                     *testing::OnSize(3))
+{
+  SharedMemoryCommunication com;
+  int rank = utils::Parallel::getProcessRank();
+  if (rank == 0) {
+    com.acceptConnection("server", "client", 0, 1);
+    BOOST_TEST(com.getRemoteCommunicatorSize() == 2);
+    std::string msg;
+    com.receive(msg, 0);
+    BOOST_TEST(msg == std::string("process 0"));
+    com.receive(msg, 1);
+    BOOST_TEST(msg == std::string("process 1"));
+    com.send(1, 0);
+    com.send(2, 1);
+    com.closeConnection();
+  } else {
+    com.requestConnection("server", "client", rank - 1, 2);
+    BOOST_TEST(com.getRemoteCommunicatorSize() == 1);
+    com.send("process " + std::to_string(rank - 1), 0);
+    int receiveMsg = 0;
+    com.receive(receiveMsg, 0);
+    BOOST_TEST(receiveMsg == rank);
+    com.closeConnection();
+  }
+}
+
+/// Messages larger than the buffer are passed in parts, asynchronous requests run concurrently.
+BOOST_AUTO_TEST_CASE(AsynchronousLargeMessages,
+                     *testing::OnSize(2))
+{
+  SharedMemoryCommunication com(64);
+  std::vector<double> forth(1000), back(1000);
+  if (utils::Parallel::getProcessRank() == 0) {
+    com.acceptConnectionAsServer("server", "client", 1);
+    for (size_t i = 0; i < forth.size(); i++) {
+      forth[i] = i;
+    }
+    // Would deadlock with blocking sends, since both sides send first
+    PtrRequest sendRequest = com.aSend(forth.data(), forth.size(), 0);
+    PtrRequest receiveRequest = com.aReceive(back.data(), back.size(), 0);
+    sendRequest->wait();
+    receiveRequest->wait();
+    BOOST_TEST(receiveRequest->test());
+    BOOST_TEST(back[999] == -999.0);
+    com.closeConnection();
+  } else {
+    BOOST_TEST(com.requestConnectionAsClient("server", "client") == 0);
+    for (size_t i = 0; i < back.size(); i++) {
+      back[i] = -static_cast<double>(i);
+    }
+    PtrRequest sendRequest = com.aSend(back.data(), back.size(), 0);
+    com.receive(forth.data(), forth.size(), 0);
+    sendRequest->wait();
+    BOOST_TEST(forth[999] == 999.0);
+    BOOST_TEST(forth[500] == 500.0);
+    com.closeConnection();
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // SharedMemory
+
+BOOST_AUTO_TEST_SUITE_END() // Communication
+
+#endif // not PRECICE_NO_SHARED_MEMORY
@@ -8,11 +8,13 @@
 #include "impl/PostProcessing.hpp"
 #include "io/TXTReader.hpp"
 #include "io/TXTWriter.hpp"
+#include "m2n/CommunicationStatistics.hpp"
 #include "m2n/M2N.hpp"
 #include "m2n/SharedPointer.hpp"
 #include "math/math.hpp"
 #include "mesh/Mesh.hpp"
 #include "utils/EigenHelperFunctions.hpp"
+#include "utils/EventTimings.hpp"
 #include "utils/Globals.hpp"
 #include "utils/Helpers.hpp"
 #include "utils/MasterSlave.hpp"
@@ -286,6 +288,7 @@ std::vector<int> BaseCouplingScheme::sendData(
     m2n::PtrM2N m2n)
 {
   TRACE();
+  utils::Event e("communicate");
 
   std::vector<int> sentDataIDs;
   assertion(m2n.get() != nullptr);
@@ -293,6 +296,8 @@ std::vector<int> BaseCouplingScheme::sendData(
   for (DataMap::value_type &pair : _sendData) {
     //std::cout<<"\nsend data id="<<pair.first<<": "<<*(pair.second->values)<<std::endl;
     int size = pair.second->values->size();
+    m2n::CommunicationStatistics::ScopedSetData scope(pair.second->mesh->getName(),
+                                                      pair.second->mesh->data(pair.first)->getName());
     m2n->send(pair.second->values->data(), size, pair.second->mesh->getID(), pair.second->dimension);
     sentDataIDs.push_back(pair.first);
   }
@@ -304,6 +309,7 @@ std::vector<int> BaseCouplingScheme::receiveData(
     m2n::PtrM2N m2n)
 {
   TRACE();
+  utils::Event e("communicate");
   std::vector<int> receivedDataIDs;
   assertion(m2n.get() != nullptr);
   assertion(m2n->isConnected());
@@ -311,6 +317,8 @@ std::vector<int> BaseCouplingScheme::receiveData(
   for (DataMap::value_type &pair : _receiveData) {
     int size = pair.second->values->size();
     //std::cout<<"\nreceive data id="<<pair.first<<": "<<*(pair.second->values)<<std::endl;
+    m2n::CommunicationStatistics::ScopedSetData scope(pair.second->mesh->getName(),
+                                                      pair.second->mesh->data(pair.first)->getName());
     m2n->receive(pair.second->values->data(), size, pair.second->mesh->getID(), pair.second->dimension);
     receivedDataIDs.push_back(pair.first);
   }
@@ -689,6 +697,8 @@ bool BaseCouplingScheme::measureConvergence(
     std::map<int, Eigen::VectorXd> &designSpecifications)
 {
   TRACE();
+  // Accounted to the post-processing phase of advance(), as reported by the coupling benchmarks
+  utils::Event e("post-process");
   assertion(not doesFirstStep());
   bool allConverged = true;
   bool oneSuffices  = false;
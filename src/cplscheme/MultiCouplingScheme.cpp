@@ -2,6 +2,7 @@
 #include "impl/PostProcessing.hpp"
 #include "mesh/Mesh.hpp"
 #include "utils/EigenHelperFunctions.hpp"
+#include "utils/EventTimings.hpp"
 #include "utils/MasterSlave.hpp"
 #include "m2n/SharedPointer.hpp"
 #include "m2n/M2N.hpp"
@@ -166,12 +167,14 @@ void MultiCouplingScheme::advance()
     }
     if (convergence) {
       if (getPostProcessing().get() != nullptr) {
+        utils::Event e("post-process");
         getPostProcessing()->iterationsConverged(_allData);
       }
       newConvergenceMeasurements();
       timestepCompleted();
     }
     else if (getPostProcessing().get() != nullptr) {
+      utils::Event e("post-process");
       getPostProcessing()->performPostProcessing(_allData);
     }
 
@@ -2,6 +2,7 @@
 #include "impl/PostProcessing.hpp"
 #include "m2n/M2N.hpp"
 #include "utils/EigenHelperFunctions.hpp"
+#include "utils/EventTimings.hpp"
 #include "utils/MasterSlave.hpp"
 #include "math/math.hpp"
 
@@ -294,12 +295,14 @@ void ParallelCouplingScheme::implicitAdvance()
         if (convergence) {
           if (getPostProcessing().get() != nullptr) {
             _deletedColumnsPPFiltering = getPostProcessing()->getDeletedColumns();
+            utils::Event e("post-process");
             getPostProcessing()->iterationsConverged(getAllData());
           }
           newConvergenceMeasurements();
           timestepCompleted();
         }
         else if (getPostProcessing().get() != nullptr) {
+          utils::Event e("post-process");
           getPostProcessing()->performPostProcessing(getAllData());
         }
 
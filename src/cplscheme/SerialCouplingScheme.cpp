@@ -1,6 +1,7 @@
 #include "SerialCouplingScheme.hpp"
 #include "impl/PostProcessing.hpp"
 #include "utils/EigenHelperFunctions.hpp"
+#include "utils/EventTimings.hpp"
 #include "utils/MasterSlave.hpp"
 #include "m2n/M2N.hpp"
 #include "math/math.hpp"
@@ -279,6 +280,7 @@ void SerialCouplingScheme::advance()
           if (convergence) {
             if (getPostProcessing().get() != nullptr) {
               _deletedColumnsPPFiltering = getPostProcessing()->getDeletedColumns();
+              utils::Event e("post-process");
               getPostProcessing()->iterationsConverged(getSendData());
             }
             newConvergenceMeasurements();
@@ -286,6 +288,7 @@ void SerialCouplingScheme::advance()
 
             // no convergence achieved for the coupling iteration within the current time step
           } else if (getPostProcessing().get() != nullptr) {
+            utils::Event e("post-process");
             getPostProcessing()->performPostProcessing(getSendData());
           }
 
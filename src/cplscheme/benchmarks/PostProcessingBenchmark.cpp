@@ -0,0 +1,83 @@
+#include "cplscheme/CouplingData.hpp"
+#include "cplscheme/SharedPointer.hpp"
+#include "cplscheme/impl/BaseQNPostProcessing.hpp"
+#include "cplscheme/impl/ConstantPreconditioner.hpp"
+#include "cplscheme/impl/IQNILSPostProcessing.hpp"
+#include "cplscheme/impl/SharedPointer.hpp"
+#include "mesh/Mesh.hpp"
+#include "testing/Benchmark.hpp"
+
+#include <Eigen/Core>
+#include <random>
+#include <vector>
+
+using namespace precice;
+using namespace precice::cplscheme;
+using precice::testing::BenchmarkState;
+
+namespace
+{
+
+/// Measures performPostProcessing of IQN-ILS with a full least-squares system of the given size.
+/**
+ * Two coupling data fields of n entries each are post-processed. Before each measured call, the
+ * values and old values are set to pseudo random numbers, such that the residual differences stay
+ * linearly independent and the QR1 filter does not remove columns. The system is filled up to the
+ * given number of columns before the measurement starts.
+ */
+void benchmarkIQNILS(BenchmarkState& state, int n, int columns)
+{
+  std::vector<int> dataIDs {0, 1};
+  impl::PtrPreconditioner preconditioner(new impl::ConstantPreconditioner(std::vector<double>(2, 1.0)));
+  impl::IQNILSPostProcessing postProcessing(0.1, false, columns, 0, impl::BaseQNPostProcessing::QR1FILTER,
+                                            1e-12, dataIDs, preconditioner);
+
+  mesh::PtrMesh mesh(new mesh::Mesh("Mesh", 3, false));
+  Eigen::VectorXd displacements = Eigen::VectorXd::Zero(n);
+  Eigen::VectorXd forces        = Eigen::VectorXd::Zero(n);
+  impl::PostProcessing::DataMap data;
+  data[0] = PtrCouplingData(new CouplingData(&displacements, mesh, false, 1));
+  data[1] = PtrCouplingData(new CouplingData(&forces, mesh, false, 1));
+  postProcessing.initialize(data);
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+  auto randomize = [&] {
+    for (auto& pair : data) {
+      Eigen::VectorXd& values = *pair.second->values;
+      for (int i = 0; i < n; i++) {
+        pair.second->oldValues(i, 0) = values(i);
+        values(i) = distribution(generator);
+      }
+    }
+  };
+
+  for (int i = 0; i <= columns; i++) {
+    randomize();
+    postProcessing.performPostProcessing(data);
+  }
+
+  while (state.keepRunning()) {
+    state.pauseTiming();
+    randomize();
+    state.resumeTiming();
+    postProcessing.performPostProcessing(data);
+  }
+  state.setItemsProcessed(2.0 * state.iterations() * n);
+  state.setCounter("n", 2 * n);
+  state.setCounter("columns", columns);
+}
+
+bool registered = [] {
+  for (int n : {1000, 10000, 100000}) {
+    for (int columns : {10, 50, 100}) {
+      testing::registerBenchmark(
+          "IQNILSPostProcessing/" + std::to_string(n) + "/" + std::to_string(columns),
+          [n, columns](BenchmarkState& state) { benchmarkIQNILS(state, n, columns); },
+          std::max(2, 1000000 / (n * columns) * 10));
+    }
+  }
+  return true;
+}();
+
+} // namespace
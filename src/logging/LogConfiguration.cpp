@@ -1,7 +1,12 @@
 #include "LogConfiguration.hpp"
 
+#include <cstdlib>
 #include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 
 #include <boost/program_options.hpp>
 
@@ -13,9 +18,13 @@
 #include <boost/log/attributes/mutable_constant.hpp>
 #include <boost/log/utility/setup/console.hpp>
 #include <boost/log/support/date_time.hpp>
+#include <boost/log/sinks/async_frontend.hpp>
 
 #include "utils/assertion.hpp"
 #include "utils/Helpers.hpp"
+#include "Logger.hpp"
+#include "RateLimitFilter.hpp"
+#include "RingBufferQueue.hpp"
 
 namespace precice {
 namespace logging {
@@ -111,6 +120,45 @@ public:
 };
 
 
+namespace {
+
+using AsyncSink = boost::log::sinks::asynchronous_sink<StreamBackend, RingBufferQueue>;
+
+/// An asynchronous sink of the current configuration and the number of its dropped records already reported
+struct AsyncSinkEntry
+{
+  boost::shared_ptr<AsyncSink> sink;
+  std::size_t reportedDrops;
+};
+
+std::vector<AsyncSinkEntry> asyncSinks;
+
+std::mutex asyncSinksMutex;
+
+} // namespace
+
+
+/// Creates a sink frontend of type SinkT for the backend and sets format and filter from config.
+template<typename SinkT>
+boost::shared_ptr<SinkT> createSink(boost::shared_ptr<StreamBackend> backend, BackendConfiguration const & config)
+{
+  namespace bl = boost::log;
+  boost::shared_ptr<SinkT> sink(new SinkT(backend));
+  sink->set_formatter(bl::parse_formatter(config.format));
+  auto filter = bl::parse_filter(config.filter);
+  if (config.rateLimit > 0) {
+    auto limiter = std::make_shared<RateLimitFilter>(config.rateLimit);
+    sink->set_filter([filter, limiter](bl::attribute_value_set const & attrs) {
+        return filter(attrs) and (*limiter)(attrs);
+      });
+  }
+  else {
+    sink->set_filter(filter);
+  }
+  return sink;
+}
+
+
 /// Reads a log file, returns a logging configuration.
 LoggingConfiguration readLogConfFile(std::string const & filename)
 {
@@ -150,6 +198,7 @@ const std::string BackendConfiguration::default_filter = "%Severity% > debug";
 const std::string BackendConfiguration::default_formatter = "(%Rank%) %TimeStamp(format=\"%H:%M:%S\")% [%Module%]:%Line% in %Function%: %ColorizedSeverity%%Message%";
 const std::string BackendConfiguration::default_type = "stream";
 const std::string BackendConfiguration::default_output = "stdout";
+const int BackendConfiguration::default_rateLimit = 0;
 
 void BackendConfiguration::setOption(std::string key, std::string value)
 {
@@ -167,6 +216,12 @@ void BackendConfiguration::setOption(std::string key, std::string value)
   if (key == "enabled") {
     enabled = utils::convertStringToBool(value);
   }
+  if (key == "async") {
+    async = utils::convertStringToBool(value);
+  }
+  if (key == "ratelimit") {
+    rateLimit = std::stoi(value);
+  }
 }
 
 
@@ -189,9 +244,21 @@ void setupLogging(LoggingConfiguration configs, bool enabled)
     << bl::expressions::attr<std::string>("Function") << ": "
     << bl::expressions::message;
 
+  // Write out records still queued in asynchronous sinks before they are removed
+  static bool flushAtExit = false;
+  if (not flushAtExit) {
+    std::atexit(flushLogging);
+    flushAtExit = true;
+  }
+  flushLogging();
+
   // Reset
   bl::core::get()->remove_all_sinks();
   bl::core::get()->reset_filter();
+  {
+    std::lock_guard<std::mutex> lock(asyncSinksMutex);
+    asyncSinks.clear();
+  }
 
   bl::core::get()->set_logging_enabled(enabled);
   
@@ -211,11 +278,17 @@ void setupLogging(LoggingConfiguration configs, bool enabled)
     }
     assertion(backend != nullptr, "The logging backend was not initialized properly. Check your log config.");
     backend->auto_flush(true);
-    using sink_t =  boost::log::sinks::synchronous_sink<StreamBackend>;          
-    boost::shared_ptr<sink_t> sink(new sink_t(backend));
-    sink->set_formatter(boost::log::parse_formatter(config.format));
-    sink->set_filter(boost::log::parse_filter(config.filter));
-    boost::log::core::get()->add_sink(sink);
+    if (config.async) {
+      // Formatting and writing happens in the feeding thread of the sink
+      auto sink = createSink<AsyncSink>(backend, config);
+      boost::log::core::get()->add_sink(sink);
+      std::lock_guard<std::mutex> lock(asyncSinksMutex);
+      asyncSinks.push_back(AsyncSinkEntry{sink, 0});
+    }
+    else {
+      using sink_t = boost::log::sinks::synchronous_sink<StreamBackend>;
+      boost::log::core::get()->add_sink(createSink<sink_t>(backend, config));
+    }
   }    
 }
 
@@ -230,4 +303,31 @@ void setMPIRank(int const rank) {
   boost::log::attribute_cast<boost::log::attributes::mutable_constant<int>>(boost::log::core::get()->get_global_attributes()["Rank"]).set(rank);
 }
 
+void flushLogging()
+{
+  boost::log::core::get()->flush();
+
+  // Reports records dropped since the last flush, as a warning to all sinks
+  static Logger _log("logging");
+  std::lock_guard<std::mutex> lock(asyncSinksMutex);
+  for (AsyncSinkEntry & entry : asyncSinks) {
+    std::size_t dropped = entry.sink->droppedRecords();
+    if (dropped > entry.reportedDrops) {
+      WARN(dropped - entry.reportedDrops << " log records were dropped, "
+           << "since the buffer of an asynchronous sink was full.");
+      entry.reportedDrops = dropped;
+      entry.sink->flush();
+    }
+  }
+}
+
+std::size_t droppedRecords()
+{
+  std::lock_guard<std::mutex> lock(asyncSinksMutex);
+  std::size_t dropped = 0;
+  for (AsyncSinkEntry const & entry : asyncSinks)
+    dropped += entry.sink->droppedRecords();
+  return dropped;
+}
+
 }} // namespace precice, logging
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <string>
 #include <vector>
 
@@ -13,6 +14,7 @@ struct BackendConfiguration
   static const std::string default_output;
   static const std::string default_filter;
   static const std::string default_formatter;
+  static const int default_rateLimit;
     
   std::string type = default_type;
   std::string output = default_output;
@@ -20,6 +22,13 @@ struct BackendConfiguration
   std::string format = default_formatter;
   bool enabled = true;
 
+  /// Records are queued and formatted/written by a dedicated thread.
+  bool async = false;
+
+  /// Maximum number of records per second and module passed to the sink, 0 means unlimited.
+  /** Errors are never discarded. */
+  int rateLimit = default_rateLimit;
+
   /// Sets on option, overwrites default values.
   void setOption(std::string key, std::string value);
 };
@@ -36,4 +45,14 @@ void setupLogging(LoggingConfiguration configs, bool enabled = true);
 /// Sets the current MPI rank as a logging attribute
 void setMPIRank(int const rank);
 
+/// Blocks until all records queued in asynchronous sinks are written.
+/**
+ * Records dropped by asynchronous sinks since the last flush are reported by a warning.
+ * The function is also called at process exit.
+ */
+void flushLogging();
+
+/// Returns the number of records dropped by the asynchronous sinks of the current configuration.
+std::size_t droppedRecords();
+
 }} // namespace precice, logging
@@ -12,6 +12,7 @@
 
 #include <string>
 #include "utils/MasterSlave.hpp"
+#include "LogConfiguration.hpp"
 
 
 #include "Tracer.hpp"
@@ -34,6 +35,7 @@
     LOG_LOCATION;                                                       \
     BOOST_LOG_SEV(_log, boost::log::trivial::severity_level::error)     \
       << message;                                                       \
+    precice::logging::flushLogging();                                   \
     std::exit(-1);                                                        \
   } while (false)
 
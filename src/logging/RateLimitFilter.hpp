@@ -0,0 +1,119 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <boost/log/attributes/value_extraction.hpp>
+#include <boost/log/attributes/attribute_value_set.hpp>
+#include <boost/log/trivial.hpp>
+
+namespace precice {
+namespace logging {
+
+/// A filter that passes at most a fixed number of records per second for each module.
+/**
+ * Records of severity error are always passed. The filter is evaluated before the message
+ * of a record is formatted, i.e., discarded records do not cost any formatting.
+ *
+ * The counters are atomic and every thread remembers, for each filter, the window of the module
+ * it logged last. The lock and the lookup of the module are hence only required if a thread
+ * changes the module of a filter. When several threads log the same module at the turn of a
+ * second, the limit may be exceeded by a few records.
+ */
+class RateLimitFilter
+{
+public:
+  explicit RateLimitFilter(int recordsPerSecond)
+    : _limit(recordsPerSecond),
+      _id(nextID())
+  {}
+
+  bool operator()(boost::log::attribute_value_set const & attrs)
+  {
+    namespace bl = boost::log;
+    auto severity = attrs["Severity"].extract<bl::trivial::severity_level>();
+    if (severity and *severity >= bl::trivial::severity_level::error)
+      return true;
+
+    auto module = attrs["Module"].extract<std::string>();
+    Window & window = findWindow(module ? *module : std::string());
+
+    Clock::rep now = Clock::now().time_since_epoch().count();
+    Clock::rep start = window.start.load(std::memory_order_relaxed);
+    if (now - start >= windowLength() and
+        window.start.compare_exchange_strong(start, now, std::memory_order_relaxed)) {
+      window.count.store(0, std::memory_order_relaxed);
+    }
+    return window.count.fetch_add(1, std::memory_order_relaxed) < _limit;
+  }
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  static Clock::rep windowLength()
+  {
+    return std::chrono::duration_cast<Clock::duration>(std::chrono::seconds(1)).count();
+  }
+
+  struct Window
+  {
+    std::atomic<Clock::rep> start{0};
+    std::atomic<int> count{0};
+  };
+
+  /// Window of the module a thread logged last through the filter with the given ID
+  struct CachedWindow
+  {
+    unsigned filter;
+    std::string module;
+    Window * window;
+  };
+
+  /// Returns a new ID, as a new filter could be allocated at the address of a destroyed one.
+  static unsigned nextID()
+  {
+    static std::atomic<unsigned> instances{0};
+    return ++instances;
+  }
+
+  /// Returns the window of the module, windows are never removed, i.e. references stay valid.
+  Window & findWindow(std::string const & module)
+  {
+    // Holds one entry per filter a thread logged through, usually very few
+    thread_local std::vector<CachedWindow> cache;
+    CachedWindow * cached = nullptr;
+    for (CachedWindow & entry : cache) {
+      if (entry.filter == _id) {
+        cached = &entry;
+        break;
+      }
+    }
+    if (cached and cached->module == module)
+      return *cached->window;
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    Window & window = _windows[module];
+    if (cached) {
+      cached->module = module;
+      cached->window = &window;
+    }
+    else {
+      cache.push_back(CachedWindow{_id, module, &window});
+    }
+    return window;
+  }
+
+  int _limit;
+
+  unsigned _id;
+
+  std::map<std::string, Window> _windows;
+
+  std::mutex _mutex;
+};
+
+}} // namespace precice, logging
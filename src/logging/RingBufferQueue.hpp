@@ -0,0 +1,197 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <boost/log/core/record_view.hpp>
+#include <boost/log/trivial.hpp>
+
+namespace precice {
+namespace logging {
+
+/// Bounded, lock-free queueing strategy for boost::log::sinks::asynchronous_sink
+/**
+ * Records are stored in a fixed size ring buffer of cells, each guarded by a sequence counter
+ * (D. Vyukov's bounded MPMC queue). Producers, i.e. the threads issuing log statements, never take
+ * a lock and never allocate. If the buffer is full, the record is dropped and counted instead
+ * of blocking the solver. Records of severity error and above are never dropped, the producer
+ * waits for a free cell instead. The dedicated feeding thread of the sink sleeps on a condition
+ * variable only if the buffer is empty.
+ *
+ * The class implements the QueueingStrategy concept of Boost.Log, hence the protected interface.
+ */
+class RingBufferQueue
+{
+public:
+  /// Number of cells of the ring buffer, needs to be a power of two.
+  static constexpr std::size_t capacity = 4096;
+
+  /// Returns the number of records dropped because the buffer was full.
+  std::size_t droppedRecords() const
+  {
+    return _dropped.load(std::memory_order_relaxed);
+  }
+
+protected:
+  RingBufferQueue()
+    : _cells(capacity)
+  {
+    static_assert((capacity & (capacity - 1)) == 0, "Capacity of the RingBufferQueue must be a power of two.");
+    for (std::size_t i = 0; i < capacity; ++i)
+      _cells[i].sequence.store(i, std::memory_order_relaxed);
+  }
+
+  template<typename ArgsT>
+  explicit RingBufferQueue(ArgsT const &)
+    : RingBufferQueue()
+  {}
+
+  /// Enqueues a record. If the buffer is full, errors wait for a free cell, other records are dropped.
+  void enqueue(boost::log::record_view const & rec)
+  {
+    if (try_enqueue(rec))
+      return;
+    if (isError(rec)) {
+      while (not try_enqueue(rec))
+        std::this_thread::yield();
+    }
+    else {
+      _dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  /// Enqueues a record, returns false if the buffer is full. The record is then left to the caller.
+  bool try_enqueue(boost::log::record_view const & rec)
+  {
+    std::size_t pos = _head.load(std::memory_order_relaxed);
+    Cell * cell;
+    while (true) {
+      cell = &_cells[pos & (capacity - 1)];
+      std::size_t seq = cell->sequence.load(std::memory_order_acquire);
+      std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+      if (diff == 0) {
+        if (_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+          break;
+      }
+      else if (diff < 0) { // Buffer full
+        return false;
+      }
+      else {
+        pos = _head.load(std::memory_order_relaxed);
+      }
+    }
+    cell->record = rec;
+    cell->sequence.store(pos + 1, std::memory_order_release);
+
+    if (_consumerWaiting.load(std::memory_order_acquire)) {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _condition.notify_one();
+    }
+    return true;
+  }
+
+  /// Dequeues a record without blocking.
+  bool try_dequeue_ready(boost::log::record_view & rec)
+  {
+    return try_dequeue(rec);
+  }
+
+  /// Dequeues a record without blocking.
+  bool try_dequeue(boost::log::record_view & rec)
+  {
+    std::size_t pos = _tail.load(std::memory_order_relaxed);
+    Cell * cell;
+    while (true) {
+      cell = &_cells[pos & (capacity - 1)];
+      std::size_t seq = cell->sequence.load(std::memory_order_acquire);
+      std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+      if (diff == 0) {
+        if (_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+          break;
+      }
+      else if (diff < 0) { // Buffer empty
+        return false;
+      }
+      else {
+        pos = _tail.load(std::memory_order_relaxed);
+      }
+    }
+    rec.swap(cell->record);
+    cell->record = boost::log::record_view();
+    cell->sequence.store(pos + capacity, std::memory_order_release);
+    return true;
+  }
+
+  /// Dequeues a record, blocks if the buffer is empty. Returns false if interrupted.
+  bool dequeue_ready(boost::log::record_view & rec)
+  {
+    while (true) {
+      if (try_dequeue(rec))
+        return true;
+      std::unique_lock<std::mutex> lock(_mutex);
+      _consumerWaiting.store(true, std::memory_order_release);
+      // The timeout protects against a record that is pushed between try_dequeue and wait.
+      _condition.wait_for(lock, std::chrono::milliseconds(10));
+      _consumerWaiting.store(false, std::memory_order_relaxed);
+      if (_interrupted.exchange(false, std::memory_order_acquire))
+        return false;
+    }
+  }
+
+  /// Wakes up the feeding thread possibly blocked in dequeue_ready.
+  void interrupt_dequeue()
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _interrupted.store(true, std::memory_order_release);
+    _condition.notify_one();
+  }
+
+private:
+  static bool isError(boost::log::record_view const & rec)
+  {
+    auto severity = rec.attribute_values()["Severity"].extract<boost::log::trivial::severity_level>();
+    return severity and *severity >= boost::log::trivial::severity_level::error;
+  }
+
+  struct Cell
+  {
+    std::atomic<std::size_t> sequence;
+    boost::log::record_view record;
+  };
+
+  /// Assumed size of a cache line.
+  static constexpr std::size_t cacheLineSize = 64;
+
+  std::vector<Cell> _cells;
+
+  // The positions are separated by padding rather than alignas, such that the sink frontend can
+  // allocate the queue by plain operator new, which does not honor over-alignment before C++17.
+  char _padding0[cacheLineSize];
+
+  /// Position of the next write, padded to avoid false sharing with the read position.
+  std::atomic<std::size_t> _head{0};
+
+  char _padding1[cacheLineSize - sizeof(std::atomic<std::size_t>)];
+
+  /// Position of the next read.
+  std::atomic<std::size_t> _tail{0};
+
+  char _padding2[cacheLineSize - sizeof(std::atomic<std::size_t>)];
+
+  std::atomic<std::size_t> _dropped{0};
+
+  std::atomic<bool> _consumerWaiting{false};
+
+  std::atomic<bool> _interrupted{false};
+
+  std::mutex _mutex;
+
+  std::condition_variable _condition;
+};
+
+}} // namespace precice, logging
@@ -0,0 +1,65 @@
+#include "testing/Benchmark.hpp"
+#include "logging/LogConfiguration.hpp"
+#include "logging/Logger.hpp"
+
+#include <sstream>
+
+using namespace precice;
+
+namespace
+{
+
+logging::Logger _log("logging::benchmarks");
+
+/// Mimics SolverInterfaceImpl::advance, which logs the coupling state once per call.
+std::string couplingState(int iteration)
+{
+  std::ostringstream os;
+  os << "it " << iteration << " of 100 | dt# " << iteration / 10 << " | t " << 0.01 * iteration
+     << " of 1 | dt 0.01 | max dt 0.01 | ongoing yes | dt complete no | write-iteration-checkpoint ";
+  return os.str();
+}
+
+/// Logs the coupling state to a file, as done in the advance loop, with the given sink configuration.
+/**
+ * Asynchronous sinks drop records if the producer outpaces the writing thread, which makes them
+ * look cheaper. The number of dropped records is hence reported along with the timing.
+ */
+void benchmarkAdvanceLogging(testing::BenchmarkState& state, bool async, int rateLimit)
+{
+  logging::BackendConfiguration config;
+  config.type = "file";
+  config.output = "benchmark-logging.log";
+  config.async = async;
+  config.rateLimit = rateLimit;
+  logging::setupLogging({config});
+
+  int iteration = 0;
+  while (state.keepRunning()) {
+    // The message is not evaluated at all if the record is discarded by the filter
+    INFO(couplingState(iteration));
+    iteration++;
+  }
+  state.setCounter("droppedRecords", logging::droppedRecords());
+  logging::flushLogging();
+
+  state.setItemsProcessed(iteration);
+  logging::setupLogging();
+}
+
+} // namespace
+
+PRECICE_BENCHMARK(LoggingAdvanceSynchronous, 100000)
+{
+  benchmarkAdvanceLogging(state, false, 0);
+}
+
+PRECICE_BENCHMARK(LoggingAdvanceAsynchronous, 100000)
+{
+  benchmarkAdvanceLogging(state, true, 0);
+}
+
+PRECICE_BENCHMARK(LoggingAdvanceAsynchronousRateLimited, 100000)
+{
+  benchmarkAdvanceLogging(state, true, 10);
+}
@@ -0,0 +1,65 @@
+#include <chrono>
+#include <string>
+#include <thread>
+#include <boost/log/attributes/attribute_set.hpp>
+#include <boost/log/attributes/attribute_value_set.hpp>
+#include <boost/log/attributes/constant.hpp>
+#include <boost/log/trivial.hpp>
+#include "logging/RateLimitFilter.hpp"
+#include "testing/Testing.hpp"
+
+using namespace precice::logging;
+namespace bl = boost::log;
+
+BOOST_AUTO_TEST_SUITE(LoggingTests)
+
+namespace
+{
+/// Returns how many of count records of the module are passed by the filter
+int countPassed(RateLimitFilter &filter, std::string const &module, int count,
+                bl::trivial::severity_level severity = bl::trivial::severity_level::info)
+{
+  bl::attribute_set attrs;
+  attrs["Module"]   = bl::attributes::make_constant(module);
+  attrs["Severity"] = bl::attributes::make_constant(severity);
+  bl::attribute_value_set values(attrs, bl::attribute_set(), bl::attribute_set());
+  values.freeze();
+
+  int passed = 0;
+  for (int i = 0; i < count; i++) {
+    if (filter(values))
+      passed++;
+  }
+  return passed;
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(RateLimitFilterLimits)
+{
+  RateLimitFilter filter(3);
+  RateLimitFilter other(5);
+
+  // Every module has its own limit
+  BOOST_TEST(countPassed(filter, "A", 10) == 3);
+  BOOST_TEST(countPassed(filter, "B", 2) == 2);
+  BOOST_TEST(countPassed(filter, "B", 2) == 1);
+  BOOST_TEST(countPassed(filter, "A", 1) == 0);
+
+  // Filters count independently, also if a thread alternates between them
+  for (int i = 0; i < 3; i++) {
+    BOOST_TEST(countPassed(other, "A", 1) == 1);
+    BOOST_TEST(countPassed(filter, "A", 1) == 0);
+  }
+  BOOST_TEST(countPassed(other, "A", 10) == 2);
+
+  // Errors are always passed
+  BOOST_TEST(countPassed(filter, "A", 10, bl::trivial::severity_level::error) == 10);
+  BOOST_TEST(countPassed(filter, "A", 10, bl::trivial::severity_level::fatal) == 10);
+
+  // The limit applies per second
+  std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+  BOOST_TEST(countPassed(filter, "A", 10) == 3);
+  BOOST_TEST(countPassed(other, "A", 10) == 5);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // LoggingTests
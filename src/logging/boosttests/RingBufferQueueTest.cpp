@@ -0,0 +1,222 @@
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+#include <boost/log/attributes/constant.hpp>
+#include <boost/log/core.hpp>
+#include <boost/log/expressions.hpp>
+#include <boost/log/sinks/async_frontend.hpp>
+#include <boost/log/sinks/basic_sink_backend.hpp>
+#include <boost/log/sinks/sync_frontend.hpp>
+#include <boost/log/trivial.hpp>
+#include "logging/LogConfiguration.hpp"
+#include "logging/LogMacros.hpp"
+#include "logging/Logger.hpp"
+#include "logging/RingBufferQueue.hpp"
+#include "testing/Testing.hpp"
+
+using namespace precice;
+using namespace precice::logging;
+namespace bl = boost::log;
+
+BOOST_AUTO_TEST_SUITE(LoggingTests)
+
+namespace
+{
+/// Exposes the queueing interface, which is only meant for the sink frontend
+struct TestQueue : RingBufferQueue {
+  using RingBufferQueue::enqueue;
+  using RingBufferQueue::try_dequeue;
+};
+
+/// Collects the sequence numbers of the consumed records
+struct CollectingBackend : bl::sinks::basic_sink_backend<bl::sinks::synchronized_feeding> {
+  void consume(bl::record_view const &rec)
+  {
+    sequences.push_back(*rec.attribute_values()["Sequence"].extract<int>());
+  }
+
+  std::vector<int> sequences;
+};
+
+/// Replaces the logging configuration by a sink, which lets the core open the records of the test
+struct RecordFixture {
+  RecordFixture()
+  {
+    auto sink = boost::make_shared<bl::sinks::synchronous_sink<CollectingBackend>>();
+    sink->set_filter(bl::expressions::has_attr<int>("Sequence"));
+    bl::core::get()->remove_all_sinks();
+    bl::core::get()->add_sink(sink);
+  }
+
+  ~RecordFixture()
+  {
+    setupLogging();
+  }
+
+  static bl::record_view makeRecord(int producer, int sequence,
+                                    bl::trivial::severity_level severity = bl::trivial::severity_level::info)
+  {
+    bl::attribute_set attrs;
+    attrs["Producer"] = bl::attributes::make_constant(producer);
+    attrs["Sequence"] = bl::attributes::make_constant(sequence);
+    attrs["Severity"] = bl::attributes::make_constant(severity);
+    bl::record rec = bl::core::get()->open_record(attrs);
+    BOOST_REQUIRE(rec);
+    return rec.lock();
+  }
+
+  static int get(bl::record_view const &rec, char const *name)
+  {
+    return *rec.attribute_values()[name].extract<int>();
+  }
+};
+} // namespace
+
+BOOST_FIXTURE_TEST_CASE(RingBufferQueueMultipleProducers, RecordFixture)
+{
+  const int producerCount = 4;
+  const int recordsPerProducer = 10000;
+  TestQueue queue;
+
+  std::atomic<int> running(producerCount);
+  std::vector<std::thread> producers;
+  for (int p = 0; p < producerCount; p++) {
+    producers.emplace_back([&, p] {
+      for (int i = 0; i < recordsPerProducer; i++) {
+        queue.enqueue(makeRecord(p, i));
+      }
+      running--;
+    });
+  }
+
+  // The records of every producer arrive in order, records are only lost if the buffer is full
+  std::vector<int> last(producerCount, -1);
+  int received = 0;
+  bool ordered = true;
+  bl::record_view rec;
+  while (true) {
+    bool finished = running == 0;
+    if (queue.try_dequeue(rec)) {
+      int producer   = get(rec, "Producer");
+      int sequence   = get(rec, "Sequence");
+      ordered        = ordered and sequence > last[producer];
+      last[producer] = sequence;
+      received++;
+    } else if (finished) {
+      break;
+    }
+  }
+  for (auto &producer : producers)
+    producer.join();
+
+  BOOST_TEST(ordered);
+  BOOST_TEST(received + queue.droppedRecords() == producerCount * recordsPerProducer);
+}
+
+BOOST_FIXTURE_TEST_CASE(RingBufferQueueFull, RecordFixture)
+{
+  TestQueue queue;
+  const int capacity = RingBufferQueue::capacity;
+  for (int i = 0; i < capacity; i++) {
+    queue.enqueue(makeRecord(0, i));
+  }
+  BOOST_TEST(queue.droppedRecords() == 0);
+
+  // Further records are dropped and counted
+  queue.enqueue(makeRecord(0, -1));
+  queue.enqueue(makeRecord(0, -2));
+  BOOST_TEST(queue.droppedRecords() == 2);
+
+  // Errors wait for a free cell instead
+  std::atomic<bool> enqueued(false);
+  std::thread producer([&] {
+    queue.enqueue(makeRecord(0, capacity, bl::trivial::severity_level::error));
+    enqueued = true;
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  BOOST_TEST(not enqueued);
+
+  bl::record_view rec;
+  BOOST_REQUIRE(queue.try_dequeue(rec));
+  BOOST_TEST(get(rec, "Sequence") == 0);
+  producer.join();
+  BOOST_TEST(enqueued);
+  BOOST_TEST(queue.droppedRecords() == 2);
+
+  for (int i = 1; i <= capacity; i++) {
+    BOOST_REQUIRE(queue.try_dequeue(rec));
+    BOOST_TEST(get(rec, "Sequence") == i);
+  }
+  BOOST_TEST(not queue.try_dequeue(rec));
+}
+
+BOOST_FIXTURE_TEST_CASE(RingBufferQueueSink, RecordFixture)
+{
+  using Sink = bl::sinks::asynchronous_sink<CollectingBackend, RingBufferQueue>;
+  auto backend = boost::make_shared<CollectingBackend>();
+  const int count = 1000;
+
+  // Flushing delivers all queued records
+  {
+    Sink sink(backend);
+    for (int i = 0; i < count; i++) {
+      sink.consume(makeRecord(0, i));
+    }
+    sink.flush();
+    BOOST_TEST(backend->sequences.size() == count);
+  }
+
+  // Records left after interrupting the feeding thread are delivered by feeding them explicitly
+  backend->sequences.clear();
+  {
+    Sink sink(backend);
+    for (int i = 0; i < count; i++) {
+      sink.consume(makeRecord(0, i));
+    }
+    sink.stop();
+    sink.feed_records();
+    BOOST_TEST(sink.droppedRecords() == 0);
+  }
+  BOOST_TEST(backend->sequences.size() == count);
+  bool ordered = true;
+  for (int i = 0; i < static_cast<int>(backend->sequences.size()); i++) {
+    ordered = ordered and backend->sequences[i] == i;
+  }
+  BOOST_TEST(ordered);
+}
+
+BOOST_AUTO_TEST_CASE(AsyncSinkReportsDroppedRecords, *testing::OnMaster())
+{
+  // Formatting records takes much longer than issuing them, the buffer overflows
+  BackendConfiguration config;
+  config.type   = "file";
+  config.output = "logging-test-dropped.log";
+  config.async  = true;
+  config.format = "%Message%";
+  for (int i = 0; i < 50; i++) {
+    config.format += " %TimeStamp(format=\"%H:%M:%S\")%";
+  }
+  setupLogging({config});
+
+  logging::Logger _log("LoggingTests");
+  for (int i = 0; i < 100 and droppedRecords() == 0; i++) {
+    for (std::size_t j = 0; j < RingBufferQueue::capacity; j++) {
+      INFO("Record " << j);
+    }
+  }
+  std::size_t dropped = droppedRecords();
+  BOOST_TEST(dropped > 0);
+  flushLogging();
+  BOOST_TEST(droppedRecords() == dropped);
+  setupLogging();
+
+  std::ifstream file(config.output);
+  std::string   content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  BOOST_TEST(content.find(std::to_string(dropped) + " log records were dropped") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // LoggingTests
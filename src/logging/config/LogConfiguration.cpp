@@ -46,6 +46,17 @@ LogConfiguration::LogConfiguration
   attrFilter.setDefaultValue(precice::logging::BackendConfiguration::default_filter);
   tagSink.addAttribute(attrFilter);
   
+  XMLAttribute<bool> attrAsync("async");
+  attrAsync.setDocumentation("Queues records in a lock-free ring buffer and writes them from a dedicated thread. "
+                             "Records are dropped instead of blocking if the buffer is full.");
+  attrAsync.setDefaultValue(false);
+  tagSink.addAttribute(attrAsync);
+
+  XMLAttribute<int> attrRateLimit("rate-limit");
+  attrRateLimit.setDocumentation("Maximum number of records per second and module, 0 for unlimited. Errors are never discarded.");
+  attrRateLimit.setDefaultValue(precice::logging::BackendConfiguration::default_rateLimit);
+  tagSink.addAttribute(attrRateLimit);
+  
   XMLAttribute<bool> attrEnabled("enabled");
   attrEnabled.setDocumentation("Enables the sink");
   attrEnabled.setDefaultValue(true);
@@ -67,6 +78,8 @@ void LogConfiguration::xmlTagCallback
     config.setOption("output", tag.getStringAttributeValue("output"));
     config.setOption("filter", tag.getStringAttributeValue("filter"));
     config.setOption("format", tag.getStringAttributeValue("format"));
+    config.setOption("async", tag.getBooleanAttributeValue("async") ? "true" : "false");
+    config.setOption("ratelimit", std::to_string(tag.getIntAttributeValue("rate-limit")));
     config.setOption("enabled", "true"); // Not needed, but correct.
     _logconfig.push_back(config);
   }
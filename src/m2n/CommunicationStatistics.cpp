@@ -0,0 +1,161 @@
+#include "CommunicationStatistics.hpp"
+
+#include <fstream>
+
+#include "com/Communication.hpp"
+#include "utils/MasterSlave.hpp"
+
+namespace precice {
+namespace m2n {
+
+CommunicationCounters& CommunicationCounters::operator+=(const CommunicationCounters& other)
+{
+  messages += other.messages;
+  bytes    += other.bytes;
+  waitTime += other.waitTime;
+  return *this;
+}
+
+std::map<std::pair<std::string, std::string>, CommunicationStatistics::Channel> CommunicationStatistics::_channels;
+
+std::pair<std::string, std::string> CommunicationStatistics::_currentName;
+
+CommunicationStatistics::Channel* CommunicationStatistics::_current = nullptr;
+
+CommunicationStatistics::ScopedSetData::ScopedSetData(
+    const std::string& meshName, const std::string& dataName)
+  : _previous(CommunicationStatistics::_currentName)
+{
+  CommunicationStatistics::setCurrent(std::make_pair(meshName, dataName));
+}
+
+CommunicationStatistics::ScopedSetData::~ScopedSetData()
+{
+  CommunicationStatistics::setCurrent(_previous);
+}
+
+void CommunicationStatistics::setCurrent(const std::pair<std::string, std::string>& name)
+{
+  _currentName = name;
+  _current = &_channels[name];
+}
+
+void CommunicationStatistics::add(int remoteRank, std::size_t bytes, Clock::duration waitTime)
+{
+  if (_current == nullptr)
+    setCurrent(_currentName);
+  CommunicationCounters& counters = (*_current)[remoteRank];
+  counters.messages++;
+  counters.bytes    += bytes;
+  counters.waitTime += std::chrono::duration<double>(waitTime).count();
+}
+
+std::map<CommunicationStatistics::Key, CommunicationCounters> CommunicationStatistics::getCounters()
+{
+  std::map<Key, CommunicationCounters> counters;
+  for (const auto& channel : _channels) {
+    for (const auto& remote : channel.second) {
+      counters[std::make_tuple(channel.first.first, channel.first.second, remote.first)] = remote.second;
+    }
+  }
+  return counters;
+}
+
+CommunicationCounters CommunicationStatistics::getTotal(const std::string& meshName, const std::string& dataName)
+{
+  CommunicationCounters total;
+  auto channel = _channels.find(std::make_pair(meshName, dataName));
+  if (channel != _channels.end()) {
+    for (const auto& remote : channel->second)
+      total += remote.second;
+  }
+  return total;
+}
+
+void CommunicationStatistics::clear()
+{
+  _channels.clear();
+  _current = nullptr;
+}
+
+namespace {
+
+void writeCSVHeader(std::ostream& out)
+{
+  out << "Rank,Mesh,Data,RemoteRank,Messages,Bytes,WaitTime[s]\n";
+}
+
+void writeCSVLine(std::ostream& out, int rank, const std::string& mesh, const std::string& data,
+                  int remoteRank, const CommunicationCounters& counters)
+{
+  out << rank << "," << mesh << "," << data << "," << remoteRank << ","
+      << counters.messages << "," << counters.bytes << "," << counters.waitTime << "\n";
+}
+
+} // namespace
+
+void CommunicationStatistics::writeCSV(std::ostream& out, bool header)
+{
+  if (header)
+    writeCSVHeader(out);
+  int rank = utils::MasterSlave::_masterMode or utils::MasterSlave::_slaveMode ? utils::MasterSlave::_rank : 0;
+  for (const auto& channel : _channels) {
+    for (const auto& remote : channel.second) {
+      writeCSVLine(out, rank, channel.first.first, channel.first.second, remote.first, remote.second);
+    }
+  }
+}
+
+void CommunicationStatistics::gatherAndWrite(const std::string& participantName)
+{
+  using utils::MasterSlave;
+  bool useMasterCom = (MasterSlave::_masterMode or MasterSlave::_slaveMode)
+                      and MasterSlave::_communication != nullptr
+                      and MasterSlave::_communication->isConnected();
+
+  if (MasterSlave::_slaveMode) {
+    if (not useMasterCom)
+      return;
+    auto counters = getCounters();
+    MasterSlave::_communication->send(static_cast<int>(counters.size()), 0);
+    for (const auto& entry : counters) {
+      MasterSlave::_communication->send(std::get<0>(entry.first), 0);
+      MasterSlave::_communication->send(std::get<1>(entry.first), 0);
+      MasterSlave::_communication->send(std::get<2>(entry.first), 0);
+      MasterSlave::_communication->send(static_cast<double>(entry.second.messages), 0);
+      MasterSlave::_communication->send(static_cast<double>(entry.second.bytes), 0);
+      MasterSlave::_communication->send(entry.second.waitTime, 0);
+    }
+    return;
+  }
+
+  if (_channels.empty() and not useMasterCom)
+    return;
+
+  std::ofstream out("CommunicationStatistics-" + participantName + ".csv");
+  writeCSV(out);
+
+  if (useMasterCom) {
+    for (int rankSlave = 1; rankSlave < MasterSlave::_size; rankSlave++) {
+      int size = 0;
+      MasterSlave::_communication->receive(size, rankSlave);
+      for (int i = 0; i < size; i++) {
+        std::string mesh, data;
+        int remoteRank = 0;
+        double messages = 0, bytes = 0;
+        CommunicationCounters counters;
+        MasterSlave::_communication->receive(mesh, rankSlave);
+        MasterSlave::_communication->receive(data, rankSlave);
+        MasterSlave::_communication->receive(remoteRank, rankSlave);
+        MasterSlave::_communication->receive(messages, rankSlave);
+        MasterSlave::_communication->receive(bytes, rankSlave);
+        MasterSlave::_communication->receive(counters.waitTime, rankSlave);
+        counters.messages = static_cast<long>(messages);
+        counters.bytes    = static_cast<long>(bytes);
+        writeCSVLine(out, rankSlave, mesh, data, remoteRank, counters);
+      }
+    }
+  }
+}
+
+}} // namespace precice, m2n
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <ostream>
+#include <string>
+#include <tuple>
+#include <utility>
+
+namespace precice {
+namespace m2n {
+
+/// Counters of the communication with one remote rank.
+struct CommunicationCounters
+{
+  /// Number of messages sent and received.
+  long messages = 0;
+
+  /// Number of bytes sent and received.
+  long bytes = 0;
+
+  /// Time in seconds spent blocked waiting for sends and receives to complete.
+  double waitTime = 0;
+
+  CommunicationCounters& operator+=(const CommunicationCounters& other);
+};
+
+/// Always-on counters for the communication between participants.
+/**
+ * Counters are kept per mesh, data and remote rank. The distributed communications
+ * (PointToPointCommunication, GatherScatterCommunication) and M2N in coupling mode record
+ * each exchanged message. The mesh and data a message belongs to is set by the caller
+ * using ScopedSetData, e.g. by the coupling scheme when exchanging coupling data.
+ *
+ * The counters are queryable at any time. At finalize, the master gathers the counters of
+ * all slaves and writes them to CommunicationStatistics-Participant.csv.
+ */
+class CommunicationStatistics
+{
+public:
+  using Clock = std::chrono::steady_clock;
+
+  /// Mesh name, data name and remote rank
+  using Key = std::tuple<std::string, std::string, int>;
+
+  /// Sets the mesh and data name for all messages recorded during its lifetime.
+  struct ScopedSetData {
+    ScopedSetData(const std::string& meshName, const std::string& dataName);
+
+    ~ScopedSetData();
+
+  private:
+    std::pair<std::string, std::string> _previous;
+  };
+
+  /// Records a message exchanged with remoteRank of the current mesh and data.
+  static void add(int remoteRank, std::size_t bytes, Clock::duration waitTime);
+
+  /// Returns the counters of this rank.
+  static std::map<Key, CommunicationCounters> getCounters();
+
+  /// Returns the sum of the counters of this rank over all remote ranks for a mesh and data.
+  static CommunicationCounters getTotal(const std::string& meshName, const std::string& dataName);
+
+  /// Resets all counters.
+  static void clear();
+
+  /// Writes the counters of this rank as CSV, each line is prefixed by the local rank.
+  static void writeCSV(std::ostream& out, bool header = true);
+
+  /// Gathers the counters of all ranks on the master, which writes them to CommunicationStatistics-participantName.csv.
+  /**
+   * Requires the master-slave communication to be connected, if running in master-slave mode.
+   */
+  static void gatherAndWrite(const std::string& participantName);
+
+private:
+  using Channel = std::map<int, CommunicationCounters>;
+
+  /// Counters per mesh and data name.
+  static std::map<std::pair<std::string, std::string>, Channel> _channels;
+
+  static std::pair<std::string, std::string> _currentName;
+
+  /// Channel of the current mesh and data, avoids looking it up for each message.
+  static Channel* _current;
+
+  static void setCurrent(const std::pair<std::string, std::string>& name);
+};
+
+}} // namespace precice, m2n
@@ -1,6 +1,10 @@
 #pragma once
 
+#include "com/SharedPointer.hpp"
 #include "mesh/SharedPointer.hpp"
+#include <set>
+#include <string>
+#include <vector>
 
 namespace precice {
 namespace m2n {
@@ -31,6 +35,15 @@ class DistributedCommunication
 public:
   using SharedPointer = std::shared_ptr<DistributedCommunication>;
 
+  /// Direct connection of this rank to one rank of the remote participant, see connectRanks().
+  struct RankConnection {
+    /// Rank of the partner in the remote participant.
+    int remoteRank;
+    /// Rank of the partner within communication.
+    int communicationRank;
+    com::PtrCommunication communication;
+  };
+
 public:
 
   explicit DistributedCommunication(mesh::PtrMesh mesh)
@@ -73,6 +86,28 @@ public:
    */
   virtual void closeConnection() =0;
 
+  /**
+   * @brief Connects this rank directly to the given ranks of the remote participant.
+   *
+   * Used to exchange mesh partitions before the vertex distribution is known. The ranks on both
+   * sides have to be chosen consistently, i.e. if rank i of the acceptor lists rank j of the
+   * requester, then rank j of the requester has to list rank i of the acceptor. The connections
+   * are independent of acceptConnection() and requestConnection() and have to be closed by the
+   * caller.
+   *
+   * @param[in] nameAcceptor Name of the accepting participant.
+   * @param[in] nameRequester Name of the requesting participant.
+   * @param[in] remoteRanks Ranks of the remote participant to connect to.
+   * @param[in] isAcceptor True, if the calling participant is the acceptor.
+   *
+   * @return One connection per remote rank, sorted by remote rank.
+   */
+  virtual std::vector<RankConnection> connectRanks (
+    const std::string&   nameAcceptor,
+    const std::string&   nameRequester,
+    const std::set<int>& remoteRanks,
+    bool                 isAcceptor) =0;
+
   /// Sends an array of double values from all slaves (different for each slave).
   virtual void send (
     double* itemsToSend,
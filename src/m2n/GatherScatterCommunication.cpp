@@ -1,5 +1,6 @@
 
 #include "GatherScatterCommunication.hpp"
+#include "CommunicationStatistics.hpp"
 #include "com/Communication.hpp"
 #include "utils/MasterSlave.hpp"
 #include "mesh/Mesh.hpp"
@@ -58,6 +59,20 @@ void GatherScatterCommunication:: closeConnection()
   _isConnected = false;
 }
 
+std::vector<DistributedCommunication::RankConnection> GatherScatterCommunication:: connectRanks
+(
+  const std::string&   nameAcceptor,
+  const std::string&   nameRequester,
+  const std::set<int>& remoteRanks,
+  bool                 isAcceptor)
+{
+  TRACE(nameAcceptor, nameRequester);
+  ERROR("The distributed exchange of mesh " << _mesh->getName() << " between " << nameAcceptor << " and "
+        << nameRequester << " requires direct connections between ranks. Please use distribution-type "
+        << "point-to-point for this m2n communication or another geometric-filter.");
+  return {};
+}
+
 
 void GatherScatterCommunication:: send (
   double*    itemsToSend,
@@ -111,7 +126,9 @@ void GatherScatterCommunication:: send (
 
     //send data to other master
     assertion(globalItemsToSend!=nullptr);
+    auto start = CommunicationStatistics::Clock::now();
     _com->send(globalItemsToSend, globalSize, 0);
+    CommunicationStatistics::add(0, globalSize * sizeof(double), CommunicationStatistics::Clock::now() - start);
     delete[] globalItemsToSend;
   } //master
 }
@@ -141,7 +158,9 @@ void GatherScatterCommunication:: receive (
     int globalSize = _mesh->getGlobalNumberOfVertices()*valueDimension;
     DEBUG("Global Size = " << globalSize);
     globalItemsToReceive = new double[globalSize];
+    auto start = CommunicationStatistics::Clock::now();
     _com->receive(globalItemsToReceive, globalSize, 0);
+    CommunicationStatistics::add(0, globalSize * sizeof(double), CommunicationStatistics::Clock::now() - start);
   }
 
   //scatter data
@@ -63,6 +63,13 @@ public:
    */
   virtual void closeConnection();
 
+  /// Not supported, all data is communicated via the master.
+  virtual std::vector<RankConnection> connectRanks (
+    const std::string&   nameAcceptor,
+    const std::string&   nameRequester,
+    const std::set<int>& remoteRanks,
+    bool                 isAcceptor);
+
   /// Sends an array of double values from all slaves (different for each slave).
   virtual void send (
     double* itemsToSend,
@@ -1,6 +1,7 @@
 
 #include "M2N.hpp"
 
+#include "CommunicationStatistics.hpp"
 #include "DistributedCommunication.hpp"
 #include "DistributedComFactory.hpp"
 #include "GatherScatterCommunication.hpp"
@@ -27,7 +28,8 @@ M2N:: M2N(  com::PtrCommunication masterCom, DistributedComFactory::SharedPointe
   _masterCom(masterCom),
   _distrFactory(distrFactory),
   _isMasterConnected(false),
-  _areSlavesConnected(false)
+  _areSlavesConnected(false),
+  _isAcceptor(false)
 {}
 
 M2N:: ~M2N()
@@ -50,6 +52,10 @@ void M2N:: acceptMasterConnection (
 
   //Event e("M2N::acceptMasterConnection");
 
+  _nameAcceptor = nameAcceptor;
+  _nameRequester = nameRequester;
+  _isAcceptor = true;
+
   if(not utils::MasterSlave::_slaveMode){
     assertion(_masterCom.use_count()>0);
     _masterCom->acceptConnection(nameAcceptor, nameRequester, 0, 1);
@@ -65,6 +71,10 @@ void M2N:: requestMasterConnection (
 {
   TRACE(nameAcceptor, nameRequester);
 
+  _nameAcceptor = nameAcceptor;
+  _nameRequester = nameRequester;
+  _isAcceptor = false;
+
   if(not utils::MasterSlave::_slaveMode){
     assertion(_masterCom.use_count()>0);
 
@@ -137,6 +147,17 @@ void M2N:: createDistributedCommunication(mesh::PtrMesh mesh){
   _distComs[mesh->getID()] = distCom;
 }
 
+std::vector<DistributedCommunication::RankConnection> M2N:: connectRanks
+(
+  int                  meshID,
+  const std::set<int>& remoteRanks)
+{
+  TRACE(meshID, remoteRanks.size());
+  assertion(_isMasterConnected);
+  assertion(_distComs.find(meshID) != _distComs.end(), meshID);
+  return _distComs[meshID]->connectRanks(_nameAcceptor, _nameRequester, remoteRanks, _isAcceptor);
+}
+
 void M2N:: startSendPackage ( int rankReceiver )
 {
   if(not utils::MasterSlave::_slaveMode){
@@ -195,7 +216,9 @@ void M2N:: send (
   }
   else{//coupling mode
     assertion(_isMasterConnected);
+    auto start = CommunicationStatistics::Clock::now();
     _masterCom->send(itemsToSend, size, 0);
+    CommunicationStatistics::add(0, size * sizeof(double), CommunicationStatistics::Clock::now() - start);
   }
 }
 
@@ -247,7 +270,9 @@ void M2N:: receive (
   }
   else{//coupling mode
     assertion(_isMasterConnected);
+    auto start = CommunicationStatistics::Clock::now();
     _masterCom->receive(itemsToReceive, size, 0);
+    CommunicationStatistics::add(0, size * sizeof(double), CommunicationStatistics::Clock::now() - start);
   }
 }
 
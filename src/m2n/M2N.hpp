@@ -7,6 +7,15 @@
 #include "logging/Logger.hpp"
 
 #include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+// Forward declaration to friend the boost test struct
+namespace M2NTests {
+namespace Configuration {
+struct ConnectionTimeout;
+}}
 
 namespace precice {
 namespace m2n {
@@ -87,6 +96,17 @@ public:
 
   void createDistributedCommunication(mesh::PtrMesh mesh);
 
+  /**
+   * @brief Connects this rank directly to the given ranks of the remote participant.
+   *
+   * Used for the distributed exchange of the mesh with the given ID, before the slaves are
+   * connected. Requires a connected master communication, the caller closes the returned
+   * connections.
+   */
+  std::vector<DistributedCommunication::RankConnection> connectRanks (
+    int                  meshID,
+    const std::set<int>& remoteRanks);
+
   void startSendPackage ( int rankReceiver );
 
   void finishSendPackage();
@@ -148,6 +168,8 @@ public:
 
 private:
 
+  friend struct M2NTests::Configuration::ConnectionTimeout;
+
   static logging::Logger _log;
 
   std::map<int, DistributedCommunication::SharedPointer> _distComs;
@@ -160,6 +182,13 @@ private:
 
   bool _areSlavesConnected;
 
+  /// Names of both participants and the role of this one, known after the master connection is set up.
+  std::string _nameAcceptor;
+
+  std::string _nameRequester;
+
+  bool _isAcceptor;
+
 
 };
 
@@ -6,13 +6,17 @@
 namespace precice {
 namespace m2n {
 
-PointToPointComFactory::PointToPointComFactory(com::PtrCommunicationFactory comFactory)
-  : _comFactory(comFactory) {}
+PointToPointComFactory::PointToPointComFactory(com::PtrCommunicationFactory comFactory,
+                                               bool exchangeAddressesViaMasters,
+                                               double connectionTimeout)
+  : _comFactory(comFactory),
+    _exchangeAddressesViaMasters(exchangeAddressesViaMasters),
+    _connectionTimeout(connectionTimeout) {}
 
 DistributedCommunication::SharedPointer
 PointToPointComFactory::newDistributedCommunication(mesh::PtrMesh mesh)
 {
-  return DistributedCommunication::SharedPointer(new PointToPointCommunication(_comFactory, mesh));
+  return DistributedCommunication::SharedPointer(new PointToPointCommunication(_comFactory, mesh, _exchangeAddressesViaMasters, _connectionTimeout));
 }
 
 }} // namespace precice, m2n
@@ -9,7 +9,10 @@ namespace m2n {
 class PointToPointComFactory : public DistributedComFactory {
 
 public:
-  explicit PointToPointComFactory(com::PtrCommunicationFactory comFactory);
+  /// See PointToPointCommunication::PointToPointCommunication() for the arguments.
+  explicit PointToPointComFactory(com::PtrCommunicationFactory comFactory,
+                                  bool exchangeAddressesViaMasters = false,
+                                  double connectionTimeout = 0.0);
 
   DistributedCommunication::SharedPointer newDistributedCommunication(
       mesh::PtrMesh mesh);
@@ -18,6 +21,10 @@ private:
   /// communication factory for 1:M communications
   com::PtrCommunicationFactory _comFactory;
 
+  bool _exchangeAddressesViaMasters;
+
+  double _connectionTimeout;
+
 };
 
 
@@ -1,13 +1,19 @@
 #include "PointToPointCommunication.hpp"
 
+#include "CommunicationStatistics.hpp"
 #include "com/Communication.hpp"
 #include "com/CommunicationFactory.hpp"
+#include "mesh/IndexRanges.hpp"
 #include "mesh/Mesh.hpp"
 #include "utils/EventTimings.hpp"
 #include "utils/Globals.hpp"
 #include "utils/MasterSlave.hpp"
 #include "utils/Publisher.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <future>
+#include <sstream>
 #include <vector>
 
 using precice::utils::Event;
@@ -22,7 +28,7 @@ send(std::vector<int> const& v,
      int rankReceiver,
      com::PtrCommunication communication) {
   communication->send(static_cast<int>(v.size()), rankReceiver);
-  communication->send(const_cast<int*>(&v[0]), v.size(), rankReceiver);
+  communication->send(const_cast<int*>(v.data()), v.size(), rankReceiver);
 }
 
 void
@@ -37,26 +43,47 @@ receive(std::vector<int>& v,
 
   v.resize(size);
 
-  communication->receive(&v[0], size, rankSender);
+  communication->receive(v.data(), size, rankSender);
 }
 
 void
-send(std::map<int, std::vector<int>> const& m,
+broadcast(std::vector<int> const& v,
+          com::PtrCommunication communication =
+              utils::MasterSlave::_communication) {
+  communication->broadcast(static_cast<int>(v.size()));
+  communication->broadcast(const_cast<int*>(v.data()), v.size());
+}
+
+void
+broadcast(std::vector<int>& v,
+          int rankBroadcaster,
+          com::PtrCommunication communication =
+              utils::MasterSlave::_communication) {
+  v.clear();
+
+  int size = 0;
+
+  communication->broadcast(size, rankBroadcaster);
+
+  v.resize(size);
+
+  communication->broadcast(v.data(), size, rankBroadcaster);
+}
+
+void
+send(std::map<int, mesh::IndexRanges> const& m,
      int rankReceiver,
      com::PtrCommunication communication) {
   communication->send(static_cast<int>(m.size()), rankReceiver);
 
   for (auto const& i : m) {
-    auto const& rank = i.first;
-    auto const& indices = i.second;
-
-    communication->send(rank, rankReceiver);
-    send(indices, rankReceiver, communication);
+    communication->send(i.first, rankReceiver);
+    send(i.second.serialize(), rankReceiver, communication);
   }
 }
 
 void
-receive(std::map<int, std::vector<int>>& m,
+receive(std::map<int, mesh::IndexRanges>& m,
         int rankSender,
         com::PtrCommunication communication) {
   m.clear();
@@ -65,83 +92,142 @@ receive(std::map<int, std::vector<int>>& m,
 
   communication->receive(size, rankSender);
 
+  std::vector<int> serialized;
+
   while (size--) {
     int rank = -1;
 
     communication->receive(rank, rankSender);
-    receive(m[rank], rankSender, communication);
+    receive(serialized, rankSender, communication);
+    m[rank] = mesh::IndexRanges::deserialize(serialized);
   }
 }
 
 void
-broadcast(std::vector<int> const& v,
-          com::PtrCommunication communication =
-              utils::MasterSlave::_communication) {
-  communication->broadcast(static_cast<int>(v.size()));
-  communication->broadcast(const_cast<int*>(&v[0]), v.size());
-}
+broadcast(std::map<int, mesh::IndexRanges>& m) {
+  if (utils::MasterSlave::_masterMode) {
+    utils::MasterSlave::_communication->broadcast(static_cast<int>(m.size()));
 
-void
-broadcast(std::vector<int>& v,
-          int rankBroadcaster,
-          com::PtrCommunication communication =
-              utils::MasterSlave::_communication) {
-  v.clear();
+    for (auto const& i : m) {
+      utils::MasterSlave::_communication->broadcast(i.first);
+      broadcast(i.second.serialize());
+    }
+  } else {
+    assertion(utils::MasterSlave::_slaveMode);
 
-  int size = 0;
+    m.clear();
 
-  communication->broadcast(size, rankBroadcaster);
+    int size = 0;
 
-  v.resize(size);
+    utils::MasterSlave::_communication->broadcast(size, 0);
+
+    std::vector<int> serialized;
+
+    while (size--) {
+      int rank = -1;
 
-  communication->broadcast(&v[0], size, rankBroadcaster);
+      utils::MasterSlave::_communication->broadcast(rank, 0);
+      broadcast(serialized, 0);
+      m[rank] = mesh::IndexRanges::deserialize(serialized);
+    }
+  }
 }
 
-void
-broadcastSend(std::map<int, std::vector<int>> const& m,
-              com::PtrCommunication communication =
-                  utils::MasterSlave::_communication) {
-  communication->broadcast(static_cast<int>(m.size()));
+/// Compresses each rank's indices of a vertex distribution to ranges.
+std::map<int, mesh::IndexRanges>
+compress(std::map<int, std::vector<int>> const& m) {
+  std::map<int, mesh::IndexRanges> compressed;
 
   for (auto const& i : m) {
-    auto const& rank = i.first;
-    auto const& indices = i.second;
+    compressed[i.first] = mesh::IndexRanges(i.second);
+  }
+
+  return compressed;
+}
 
-    communication->broadcast(rank);
-    broadcast(indices, communication);
+/// Sends each slave its own indices of the vertex distribution, in their
+/// local order, and returns the indices of the master.
+///
+/// Only the master holds the vertex distribution of its participant, a slave
+/// only needs its own part.
+std::vector<int>
+scatter(std::map<int, std::vector<int>> const& m) {
+  if (utils::MasterSlave::_masterMode) {
+    for (int rank = 1; rank < utils::MasterSlave::_size; ++rank) {
+      auto iterator = m.find(rank);
+
+      send(iterator == m.end() ? std::vector<int>() : iterator->second,
+           rank,
+           utils::MasterSlave::_communication);
+    }
+
+    auto iterator = m.find(0);
+
+    return iterator == m.end() ? std::vector<int>() : iterator->second;
   }
+
+  assertion(utils::MasterSlave::_slaveMode);
+
+  std::vector<int> indices;
+
+  receive(indices, 0, utils::MasterSlave::_communication);
+
+  return indices;
 }
 
+/// Gathers the server address of each rank on the master, which sends them to
+/// the remote master in one message.
+///
+/// Ranks without communication partners contribute an empty address.
 void
-broadcastReceive(std::map<int, std::vector<int>>& m,
-                 int rankBroadcaster,
-                 com::PtrCommunication communication =
-                     utils::MasterSlave::_communication) {
-  m.clear();
+sendAddresses(std::string const& address,
+              com::PtrCommunication masterCommunication) {
+  if (utils::MasterSlave::_masterMode) {
+    std::string addresses = address;
 
-  int size = 0;
+    for (int rank = 1; rank < utils::MasterSlave::_size; ++rank) {
+      std::string slaveAddress;
 
-  communication->broadcast(size, rankBroadcaster);
+      utils::MasterSlave::_communication->receive(slaveAddress, rank);
 
-  while (size--) {
-    int rank = -1;
+      addresses += "\n" + slaveAddress;
+    }
+
+    masterCommunication->send(addresses, 0);
+  } else {
+    assertion(utils::MasterSlave::_slaveMode);
 
-    communication->broadcast(rank, rankBroadcaster);
-    broadcast(m[rank], rankBroadcaster, communication);
+    utils::MasterSlave::_communication->send(address, 0);
   }
 }
 
-void
-broadcast(std::map<int, std::vector<int>>& m) {
+/// Receives the server addresses of all remote ranks on the master and passes
+/// them on to all slaves, returns the addresses indexed by remote rank.
+std::vector<std::string>
+receiveAddresses(com::PtrCommunication masterCommunication) {
+  std::string addresses;
+
   if (utils::MasterSlave::_masterMode) {
-    // Broadcast (send) vertex distributions.
-    m2n::broadcastSend(m);
+    masterCommunication->receive(addresses, 0);
+
+    for (int rank = 1; rank < utils::MasterSlave::_size; ++rank) {
+      utils::MasterSlave::_communication->send(addresses, rank);
+    }
   } else {
     assertion(utils::MasterSlave::_slaveMode);
 
-    // Broadcast (receive) vertex distributions.
-    m2n::broadcastReceive(m, 0);
+    utils::MasterSlave::_communication->receive(addresses, 0);
+  }
+
+  std::vector<std::string> result;
+  std::istringstream       iss(addresses);
+  std::string              address;
+
+  while (std::getline(iss, address)) {
+    result.push_back(address);
   }
+
+  return result;
 }
 
 void
@@ -281,46 +367,47 @@ printLocalIndexCountStats(std::map<int, std::vector<int>> const& m) {
 }
 
 // The approximate complexity of this function is O((number of local data
-// indices for the current rank in `thisVertexDistribution') * (total number of
-// data indices for all ranks in `otherVertexDistribution')).
+// indices for the current rank) * (number of ranks in `otherVertexDistribution'
+// whose index range overlaps the local one) * log(number of ranges per rank)).
 std::map<int, std::vector<int>>
 buildCommunicationMap(
     // `localIndexCount' is the number of unique local indices for the current
     // rank.
     size_t& localIndexCount,
-    // `thisVertexDistribution' is input vertex distribution from this
-    // participant.
-    std::map<int, std::vector<int>> const& thisVertexDistribution,
+    // `thisIndices' are the global indices of the current rank in local order.
+    std::vector<int> const& thisIndices,
     // `otherVertexDistribution' is input vertex distribution from other
     // participant.
-    std::map<int, std::vector<int>> const& otherVertexDistribution,
-    int thisRank = utils::MasterSlave::_rank) {
+    std::map<int, mesh::IndexRanges> const& otherVertexDistribution) {
 
   localIndexCount = 0;
-  
+
   std::map<int, std::vector<int>> communicationMap;
 
-  auto iterator = thisVertexDistribution.find(thisRank);
-  
-  if (iterator == thisVertexDistribution.end())
+  if (thisIndices.empty())
     return communicationMap;
-  
-  auto const& indices = iterator->second;
-
-  int index = 0;
-
-  for (int thisIndex : indices) {
-    for (auto &other : otherVertexDistribution) {
-      for (auto &otherIndex : other.second) {
-        if (thisIndex == otherIndex) {
-          communicationMap[other.first].push_back(index);
-          break;
-        }
-      }
+
+  auto minmax = std::minmax_element(thisIndices.begin(), thisIndices.end());
+  int  thisMin = *minmax.first;
+  int  thisMax = *minmax.second;
+
+  for (auto const& other : otherVertexDistribution) {
+    auto const& otherIndices = other.second;
+
+    if (otherIndices.empty() || otherIndices.max() < thisMin || otherIndices.min() > thisMax)
+      continue;
+
+    std::vector<int> indices;
+
+    for (size_t index = 0; index < thisIndices.size(); ++index) {
+      if (otherIndices.contains(thisIndices[index]))
+        indices.push_back(index);
     }
-    ++index;
+
+    if (not indices.empty())
+      communicationMap[other.first] = std::move(indices);
   }
-  
+
   // CAUTION:
   // This prevents point-to-point communication from considering those process
   // ranks, which don't have matching indices in the remote participant
@@ -329,7 +416,7 @@ buildCommunicationMap(
   // interface, or because user did a mistake and did not define the interface
   // boundary properly.
   if (communicationMap.size() > 0)
-    localIndexCount = indices.size();
+    localIndexCount = thisIndices.size();
 
   return communicationMap;
 }
@@ -362,9 +449,13 @@ logging::Logger PointToPointCommunication::_log(
 
 PointToPointCommunication::PointToPointCommunication(
     com::PtrCommunicationFactory communicationFactory,
-    mesh::PtrMesh mesh)
+    mesh::PtrMesh mesh,
+    bool exchangeAddressesViaMasters,
+    double connectionTimeout)
     : DistributedCommunication(mesh)
     , _communicationFactory(communicationFactory)
+    , _exchangeAddressesViaMasters(exchangeAddressesViaMasters)
+    , _connectionTimeout(connectionTimeout)
     , _localIndexCount(0)
     , _totalIndexCount(0)
     , _isConnected(false) {
@@ -394,7 +485,12 @@ PointToPointCommunication::acceptConnection(std::string const& nameAcceptor,
 
   std::map<int, std::vector<int>>& vertexDistribution =
       _mesh->getVertexDistribution();
-  std::map<int, std::vector<int>> requesterVertexDistribution;
+  std::map<int, mesh::IndexRanges> requesterVertexDistribution;
+
+  // Connection between participants' master processes, kept open until the
+  // end of the setup, if the addresses are exchanged over it. Closing it
+  // earlier stalls the following connections with some MPI implementations.
+  com::PtrCommunication masterCommunication;
 
   if (utils::MasterSlave::_masterMode) {
     // Establish connection between participants' master processes.
@@ -409,13 +505,18 @@ PointToPointCommunication::acceptConnection(std::string const& nameAcceptor,
     c->receive(requesterMasterRank, 0);
 
     // Exchange vertex distributions.
-    m2n::send(vertexDistribution, 0, c);
+    m2n::send(m2n::compress(vertexDistribution), 0, c);
     m2n::receive(requesterVertexDistribution, 0, c);
+
+    if (_exchangeAddressesViaMasters)
+      masterCommunication = c;
   } else {
     assertion(utils::MasterSlave::_slaveMode);
   }
 
-  m2n::broadcast(vertexDistribution);
+  // Each rank only needs its own indices and the compressed distribution of
+  // the remote participant.
+  std::vector<int> localIndices = m2n::scatter(vertexDistribution);
   m2n::broadcast(requesterVertexDistribution);
 
   // Local (for process rank in the current participant) communication map that
@@ -436,7 +537,7 @@ PointToPointCommunication::acceptConnection(std::string const& nameAcceptor,
   // - has to communicate (send/receive) data with local indices 0 and 2 with
   //   the remote process with rank 4.
   std::map<int, std::vector<int>> communicationMap = m2n::buildCommunicationMap(
-      _localIndexCount, vertexDistribution, requesterVertexDistribution);
+      _localIndexCount, localIndices, requesterVertexDistribution);
 
 // Print `communicationMap'.
 #ifdef P2P_LCM_PRINT
@@ -454,7 +555,7 @@ PointToPointCommunication::acceptConnection(std::string const& nameAcceptor,
 #endif
 
 #ifdef SuperMUC_WORK
-  try {
+  if (not _exchangeAddressesViaMasters) try {
     auto addressDirectory = _communicationFactory->addressDirectory();
 
     if (utils::MasterSlave::_masterMode) {
@@ -472,6 +573,22 @@ PointToPointCommunication::acceptConnection(std::string const& nameAcceptor,
   }
 #endif
 
+  // Accept point-to-point connections (as server) between the current acceptor
+  // process (in the current participant) with rank `utils::MasterSlave::_rank'
+  // and (multiple) requester processes (in the requester participant).
+  auto c = _communicationFactory->newCommunication();
+
+  if (_exchangeAddressesViaMasters) {
+    // Instead of one address file per rank, all addresses are sent in bulk
+    // over the connection of the masters.
+    std::string address;
+
+    if (not communicationMap.empty())
+      address = c->prepareConnectionAsServer();
+
+    m2n::sendAddresses(address, masterCommunication);
+  }
+
   if (communicationMap.empty()) {
     assertion(_localIndexCount == 0);
 
@@ -480,11 +597,6 @@ PointToPointCommunication::acceptConnection(std::string const& nameAcceptor,
     return;
   }
 
-  // Accept point-to-point connections (as server) between the current acceptor
-  // process (in the current participant) with rank `utils::MasterSlave::_rank'
-  // and (multiple) requester processes (in the requester participant).
-  auto c = _communicationFactory->newCommunication();
-
 #ifdef SuperMUC_WORK
   Publisher::ScopedPushDirectory spd("." + nameAcceptor + "-" + _mesh->getName() + "-" +
                                      std::to_string(utils::MasterSlave::_rank) +
@@ -545,7 +657,12 @@ PointToPointCommunication::requestConnection(std::string const& nameAcceptor,
 
   std::map<int, std::vector<int>>& vertexDistribution =
       _mesh->getVertexDistribution();
-  std::map<int, std::vector<int>> acceptorVertexDistribution;
+  std::map<int, mesh::IndexRanges> acceptorVertexDistribution;
+
+  // Connection between participants' master processes, kept open until the
+  // end of the setup, if the addresses are exchanged over it. Closing it
+  // earlier stalls the following connections with some MPI implementations.
+  com::PtrCommunication masterCommunication;
 
   if (utils::MasterSlave::_masterMode) {
     // Establish connection between participants' master processes.
@@ -570,13 +687,18 @@ PointToPointCommunication::requestConnection(std::string const& nameAcceptor,
 
     // Exchange vertex distributions.
     m2n::receive(acceptorVertexDistribution, 0, c);
-    m2n::send(vertexDistribution, 0, c);
+    m2n::send(m2n::compress(vertexDistribution), 0, c);
+
+    if (_exchangeAddressesViaMasters)
+      masterCommunication = c;
   } else {
     assertion(utils::MasterSlave::_slaveMode);
 
   }
 
-  m2n::broadcast(vertexDistribution);
+  // Each rank only needs its own indices and the compressed distribution of
+  // the remote participant.
+  std::vector<int> localIndices = m2n::scatter(vertexDistribution);
   m2n::broadcast(acceptorVertexDistribution);
 
   // Local (for process rank in the current participant) communication map that
@@ -597,7 +719,7 @@ PointToPointCommunication::requestConnection(std::string const& nameAcceptor,
   // - has to communicate (send/receive) data with local indices 0 and 2 with
   //   the remote process with rank 4.
   std::map<int, std::vector<int>> communicationMap = m2n::buildCommunicationMap(
-      _localIndexCount, vertexDistribution, acceptorVertexDistribution);
+      _localIndexCount, localIndices, acceptorVertexDistribution);
 
 // Print `communicationMap'.
 #ifdef P2P_LCM_PRINT
@@ -623,6 +745,12 @@ PointToPointCommunication::requestConnection(std::string const& nameAcceptor,
   }
 #endif
 
+  // Server addresses of the acceptor ranks, if they are sent via the masters.
+  std::vector<std::string> acceptorAddresses;
+
+  if (_exchangeAddressesViaMasters)
+    acceptorAddresses = m2n::receiveAddresses(masterCommunication);
+
   if (communicationMap.empty()) {
     assertion(_localIndexCount == 0);
 
@@ -638,33 +766,62 @@ PointToPointCommunication::requestConnection(std::string const& nameAcceptor,
       "request"
       "/");
 
-  std::vector<com::PtrRequest> requests;
+  std::vector<com::PtrCommunication> communications;
+  std::vector<int> acceptorRanks;
+  std::vector<std::string> addresses;
 
-  requests.reserve(communicationMap.size());
+  communications.reserve(communicationMap.size());
+  acceptorRanks.reserve(communicationMap.size());
+  addresses.reserve(communicationMap.size());
 
-  _mappings.reserve(communicationMap.size());
+  // Look up the addresses of all acceptor processes first. Address files are
+  // read here, since the publisher is not thread-safe.
+  for (auto const& i : communicationMap) {
+    auto globalAcceptorRank = i.first;
+
+    auto c = _communicationFactory->newCommunication();
+
+    if (_exchangeAddressesViaMasters) {
+      assertion(globalAcceptorRank < static_cast<int>(acceptorAddresses.size()),
+                globalAcceptorRank, acceptorAddresses.size());
+
+      addresses.push_back(acceptorAddresses[globalAcceptorRank]);
+    } else {
+#ifdef SuperMUC_WORK
+      Publisher::ScopedPushDirectory spd("." + nameAcceptor + "-" + _mesh->getName() + "-" +
+                                         std::to_string(globalAcceptorRank) +
+                                         ".address");
+#endif
+
+      addresses.push_back(c->readAddressAsClient(
+          nameAcceptor + "-" + std::to_string(globalAcceptorRank), nameRequester));
+    }
+
+    communications.push_back(c);
+    acceptorRanks.push_back(globalAcceptorRank);
+  }
 
   // Request point-to-point connections (as client) between the current
   // requester process (in the current participant) and (multiple) acceptor
   // processes (in the acceptor participant) with ranks `globalAcceptorRank'
   // according to communication map.
+  requestConnectionsAt(communications, acceptorRanks, addresses);
+
+  std::vector<com::PtrRequest> requests;
+
+  requests.reserve(communicationMap.size());
+
+  _mappings.reserve(communicationMap.size());
+
+  size_t partner = 0;
+
   for (auto& i : communicationMap) {
     auto globalAcceptorRank = i.first;
     auto indices = std::move(i.second);
+    auto c = communications[partner++];
 
     _totalIndexCount += indices.size();
 
-    auto c = _communicationFactory->newCommunication();
-
-#ifdef SuperMUC_WORK
-    Publisher::ScopedPushDirectory spd("." + nameAcceptor + "-" + _mesh->getName() + "-" +
-                                       std::to_string(globalAcceptorRank) +
-                                       ".address");
-#endif
-
-    c->requestConnectionAsClient(
-        nameAcceptor + "-" + std::to_string(globalAcceptorRank), nameRequester);
-
     assertion(c->getRemoteCommunicatorSize() == 1);
 
     auto request = c->aSend(&utils::MasterSlave::_rank, 0);
@@ -713,6 +870,158 @@ PointToPointCommunication::closeConnection() {
   _isConnected = false;
 }
 
+std::vector<DistributedCommunication::RankConnection>
+PointToPointCommunication::connectRanks(std::string const& nameAcceptor,
+                                        std::string const& nameRequester,
+                                        std::set<int> const& remoteRanks,
+                                        bool isAcceptor) {
+  TRACE(nameAcceptor, nameRequester, remoteRanks.size(), isAcceptor);
+
+  std::vector<RankConnection> connections;
+
+  if (remoteRanks.empty())
+    return connections;
+
+  // Serial participants are treated as a single rank 0.
+  int rank = utils::MasterSlave::_slaveMode ? utils::MasterSlave::_rank : 0;
+
+  // The names differ from the ones of acceptConnection(), since the connections
+  // of both may be established shortly after each other.
+  std::string prefix = nameAcceptor + "-" + _mesh->getName() + "-";
+
+  if (isAcceptor) {
+    auto c = _communicationFactory->newCommunication();
+
+    c->acceptConnectionAsServer(prefix + std::to_string(rank), nameRequester, remoteRanks.size());
+
+    assertion(c->getRemoteCommunicatorSize() == remoteRanks.size());
+
+    for (size_t localRequesterRank = 0; localRequesterRank < remoteRanks.size(); ++localRequesterRank) {
+      int globalRequesterRank = -1;
+
+      c->receive(globalRequesterRank, localRequesterRank);
+
+      assertion(remoteRanks.count(globalRequesterRank) == 1, globalRequesterRank);
+
+      connections.push_back({globalRequesterRank, static_cast<int>(localRequesterRank), c});
+    }
+
+    std::sort(connections.begin(), connections.end(),
+              [](RankConnection const& lhs, RankConnection const& rhs) {
+                return lhs.remoteRank < rhs.remoteRank;
+              });
+  } else {
+    std::vector<com::PtrCommunication> communications;
+    std::vector<int> acceptorRanks(remoteRanks.begin(), remoteRanks.end());
+    std::vector<std::string> addresses;
+
+    for (int globalAcceptorRank : acceptorRanks) {
+      auto c = _communicationFactory->newCommunication();
+
+      addresses.push_back(c->readAddressAsClient(prefix + std::to_string(globalAcceptorRank), nameRequester));
+
+      communications.push_back(c);
+    }
+
+    requestConnectionsAt(communications, acceptorRanks, addresses);
+
+    std::vector<com::PtrRequest> requests;
+
+    for (size_t partner = 0; partner < acceptorRanks.size(); ++partner) {
+      int  globalAcceptorRank = acceptorRanks[partner];
+      auto c                  = communications[partner];
+
+      assertion(c->getRemoteCommunicatorSize() == 1);
+
+      requests.push_back(c->aSend(&rank, 0));
+
+      connections.push_back({globalAcceptorRank, 0, c});
+    }
+
+    com::Request::wait(requests);
+  }
+
+  return connections;
+}
+
+void
+PointToPointCommunication::requestConnectionsAt(std::vector<com::PtrCommunication> const& communications,
+                                                std::vector<int> const& acceptorRanks,
+                                                std::vector<std::string> const& addresses) {
+  TRACE(acceptorRanks.size());
+
+  assertion(communications.size() == acceptorRanks.size());
+  assertion(addresses.size() == acceptorRanks.size());
+
+  using Clock = std::chrono::steady_clock;
+
+  bool hasTimeout = _connectionTimeout > 0.0;
+  auto deadline   = Clock::now() + std::chrono::duration_cast<Clock::duration>(
+                                     std::chrono::duration<double>(_connectionTimeout));
+
+  // Seconds needed to connect to each partner
+  std::vector<double> durations(acceptorRanks.size(), 0.0);
+
+  auto connect = [&](size_t partner) {
+    auto start = Clock::now();
+    communications[partner]->requestConnectionAsClientAt(addresses[partner]);
+    durations[partner] = std::chrono::duration<double>(Clock::now() - start).count();
+  };
+
+  std::vector<int> pendingRanks;
+
+  // With a timeout, a single connection is also made in its own thread, such that it can be waited for.
+  if ((acceptorRanks.size() > 1 || hasTimeout) && _communicationFactory->supportsConcurrentConnections()) {
+    std::vector<std::future<void>> connections;
+
+    for (size_t partner = 0; partner < acceptorRanks.size(); ++partner) {
+      connections.push_back(std::async(std::launch::async, connect, partner));
+    }
+
+    for (size_t partner = 0; partner < acceptorRanks.size(); ++partner) {
+      if (hasTimeout && connections[partner].wait_until(deadline) == std::future_status::timeout) {
+        pendingRanks.push_back(acceptorRanks[partner]);
+      } else {
+        connections[partner].get();
+      }
+    }
+  } else {
+    for (size_t partner = 0; partner < acceptorRanks.size(); ++partner) {
+      if (hasTimeout && Clock::now() > deadline) {
+        pendingRanks.assign(acceptorRanks.begin() + partner, acceptorRanks.end());
+        break;
+      }
+      connect(partner);
+    }
+  }
+
+  if (not pendingRanks.empty()) {
+    std::ostringstream ranks;
+    for (int rank : pendingRanks) {
+      ranks << " " << rank;
+    }
+    // The pending connections cannot be cancelled, they are ended by the termination of the process.
+    ERROR("Rank " << utils::MasterSlave::_rank << " could not connect to the remote ranks" << ranks.str()
+                  << " within the connection timeout of " << _connectionTimeout << " seconds");
+  }
+
+  // Report partners which took more than twice the median time, if it is noticeable at all.
+  std::vector<double> sorted(durations);
+  std::nth_element(sorted.begin(), sorted.begin() + sorted.size() / 2, sorted.end());
+  double median = sorted[sorted.size() / 2];
+
+  std::ostringstream slowRanks;
+  for (size_t partner = 0; partner < acceptorRanks.size(); ++partner) {
+    if (durations[partner] >= 1.0 && durations[partner] > 2.0 * median) {
+      slowRanks << " " << acceptorRanks[partner] << " (" << durations[partner] << " s)";
+    }
+  }
+  if (not slowRanks.str().empty()) {
+    WARN("Rank " << utils::MasterSlave::_rank << " was slow to connect to the remote ranks" << slowRanks.str()
+                 << ", the median time was " << median << " s");
+  }
+}
+
 void
 PointToPointCommunication::send(double* itemsToSend,
                                 size_t size,
@@ -741,7 +1050,11 @@ PointToPointCommunication::send(double* itemsToSend,
   }
 
   for (auto& mapping : _mappings) {
+    auto start = CommunicationStatistics::Clock::now();
     mapping.request->wait();
+    CommunicationStatistics::add(mapping.globalRemoteRank,
+                                 mapping.indices.size() * valueDimension * sizeof(double),
+                                 CommunicationStatistics::Clock::now() - start);
   }
 
   _buffer.clear();
@@ -772,7 +1085,11 @@ PointToPointCommunication::receive(double* itemsToReceive,
   }
 
   for (auto& mapping : _mappings) {
+    auto start = CommunicationStatistics::Clock::now();
     mapping.request->wait();
+    CommunicationStatistics::add(mapping.globalRemoteRank,
+                                 mapping.indices.size() * valueDimension * sizeof(double),
+                                 CommunicationStatistics::Clock::now() - start);
 
     int i = 0;
 
@@ -6,6 +6,12 @@
 #include "mesh/SharedPointer.hpp"
 #include "logging/Logger.hpp"
 
+// Forward declaration to friend the boost test struct
+namespace M2NTests {
+namespace Configuration {
+struct ConnectionTimeout;
+}}
+
 namespace precice {
 namespace m2n {
 /**
@@ -39,9 +45,28 @@ public:
 
 public:
   
+  /**
+   * @brief Constructor.
+   *
+   * If exchangeAddressesViaMasters is set, the server addresses of all ranks
+   * are sent in bulk over the connection of the masters, instead of publishing
+   * one address file per rank. This requires a communication which supports
+   * com::Communication::prepareConnectionAsServer().
+   *
+   * The requester connects to all its partner ranks at once, if the
+   * communication factory supports concurrent connections. If connectionTimeout
+   * is positive, the setup is aborted after this many seconds with a list of
+   * the partner ranks which have not been connected. Connection attempts still
+   * in progress are not cancelled, but end with the terminated process. If the
+   * factory does not support concurrent connections, the timeout is only
+   * checked between two connections, i.e. a single connection which never
+   * completes is not detected.
+   */
   PointToPointCommunication(
       com::PtrCommunicationFactory communicationFactory,
-      mesh::PtrMesh mesh);
+      mesh::PtrMesh mesh,
+      bool exchangeAddressesViaMasters = false,
+      double connectionTimeout = 0.0);
 
   virtual ~PointToPointCommunication();
 
@@ -74,6 +99,17 @@ public:
    */
   virtual void closeConnection();
 
+  /**
+   * @brief Connects this rank directly to the given ranks of the remote participant.
+   *
+   * The acceptor accepts all connections as server, the requester requests one connection per
+   * remote rank as client. See DistributedCommunication::connectRanks().
+   */
+  virtual std::vector<RankConnection> connectRanks(std::string const& nameAcceptor,
+                                                   std::string const& nameRequester,
+                                                   std::set<int> const& remoteRanks,
+                                                   bool isAcceptor);
+
   /**
    * @brief Sends a subset of local double values corresponding to local indices
    *        deduced from the current and remote vertex distributions.
@@ -89,13 +125,37 @@ public:
                        int valueDimension = 1);
 
 private:
+  friend struct M2NTests::Configuration::ConnectionTimeout;
+
   static logging::Logger _log;
 
+  /**
+   * @brief Connects the given communications as clients to the given addresses
+   *        of the acceptor ranks.
+   *
+   * The connections are requested concurrently if supported by the factory,
+   * otherwise one after the other, where the timeout is only checked between
+   * two connections. Partner ranks which took much longer to connect than the
+   * others are reported.
+   *
+   * On timeout, the process is terminated with an error, while the pending
+   * connection attempts are still blocked.
+   */
+  void requestConnectionsAt(std::vector<com::PtrCommunication> const& communications,
+                            std::vector<int> const& acceptorRanks,
+                            std::vector<std::string> const& addresses);
+
   static std::string _prefix;
 
 private:
   com::PtrCommunicationFactory _communicationFactory;
 
+  /// Exchange server addresses via the masters instead of address files
+  bool _exchangeAddressesViaMasters;
+
+  /// Seconds to wait for the connections to all partner ranks, unlimited if not positive
+  double _connectionTimeout;
+
   /**
    * @brief Defines mapping between:
    *        1. local (to the current process) remote process rank;
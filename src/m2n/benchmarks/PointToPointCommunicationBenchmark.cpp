@@ -0,0 +1,122 @@
+#ifndef PRECICE_NO_MPI
+
+#include "com/MPIDirectCommunication.hpp"
+#include "com/MPIPortsCommunicationFactory.hpp"
+#include "com/SharedMemoryCommunication.hpp"
+#include "com/SharedMemoryCommunicationFactory.hpp"
+#include "com/SocketCommunicationFactory.hpp"
+#include "m2n/PointToPointCommunication.hpp"
+#include "mesh/Mesh.hpp"
+#include "testing/Benchmark.hpp"
+#include "utils/MasterSlave.hpp"
+#include "utils/Parallel.hpp"
+
+#include <chrono>
+#include <vector>
+
+using namespace precice;
+using precice::testing::BenchmarkState;
+using precice::utils::MasterSlave;
+using precice::utils::Parallel;
+
+namespace
+{
+
+/// Exchanges vector data of a mesh between participant A (ranks 0, 1) and B (ranks 2, 3).
+/**
+ * A distributes the vertices in two contiguous halves, B in alternating blocks of a quarter, such
+ * that each rank of A communicates with each rank of B. One iteration is a round trip, i.e. A sends
+ * to B and B sends the data back. The connection setup is reported as counter.
+ */
+void benchmarkExchange(BenchmarkState& state, com::PtrCommunicationFactory factory, int vertices)
+{
+  const int   dimensions  = 3;
+  int         rank        = Parallel::getProcessRank();
+  bool        isA         = rank < 2;
+  std::string participant = isA ? "A" : "B";
+
+  MasterSlave::_communication = std::make_shared<com::MPIDirectCommunication>();
+  MasterSlave::_rank       = rank % 2;
+  MasterSlave::_size       = 2;
+  MasterSlave::_masterMode = rank % 2 == 0;
+  MasterSlave::_slaveMode  = rank % 2 == 1;
+
+  mesh::PtrMesh mesh(new mesh::Mesh("Mesh", dimensions, false));
+  if (MasterSlave::_masterMode) {
+    Parallel::splitCommunicator(participant + ".Master");
+    MasterSlave::_communication->acceptConnection(participant + ".Master", participant + ".Slave", 0, 1);
+    MasterSlave::_communication->setRankOffset(1);
+    mesh->setGlobalNumberOfVertices(vertices);
+    for (int i = 0; i < vertices; i++) {
+      int owner = isA ? 2 * i / vertices : (4 * i / vertices) % 2;
+      mesh->getVertexDistribution()[owner].push_back(i);
+    }
+  }
+  else {
+    Parallel::splitCommunicator(participant + ".Slave");
+    MasterSlave::_communication->requestConnection(participant + ".Master", participant + ".Slave", 0, 1);
+  }
+
+  m2n::PointToPointCommunication communication(factory, mesh);
+  auto start = std::chrono::steady_clock::now();
+  if (isA) {
+    communication.requestConnection("B", "A");
+  }
+  else {
+    communication.acceptConnection("B", "A");
+  }
+  double connectionTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  std::vector<double> data(vertices / 2 * dimensions, 1.0);
+  while (state.keepRunning()) {
+    if (isA) {
+      communication.send(data.data(), data.size(), dimensions);
+      communication.receive(data.data(), data.size(), dimensions);
+    }
+    else {
+      communication.receive(data.data(), data.size(), dimensions);
+      communication.send(data.data(), data.size(), dimensions);
+    }
+  }
+  communication.closeConnection();
+
+  MasterSlave::_communication.reset();
+  MasterSlave::reset();
+
+  // Items are the bytes sent and received by the master of A
+  state.setItemsProcessed(2.0 * state.iterations() * data.size() * sizeof(double));
+  state.setCounter("vertices", vertices);
+  state.setCounter("connection_seconds", connectionTime);
+}
+
+bool registered = [] {
+  for (int vertices : {10000, 100000, 1000000}) {
+    long long iterations = std::max(1, 1000000 / vertices) * 10;
+    testing::registerBenchmark(
+        "PointToPointSockets/" + std::to_string(vertices),
+        [vertices](BenchmarkState& state) {
+          benchmarkExchange(state, std::make_shared<com::SocketCommunicationFactory>(), vertices);
+        },
+        iterations, 4);
+    testing::registerBenchmark(
+        "PointToPointMPIPorts/" + std::to_string(vertices),
+        [vertices](BenchmarkState& state) {
+          benchmarkExchange(state, std::make_shared<com::MPIPortsCommunicationFactory>(), vertices);
+        },
+        iterations, 4);
+#ifndef PRECICE_NO_SHARED_MEMORY
+    testing::registerBenchmark(
+        "PointToPointSharedMemory/" + std::to_string(vertices),
+        [vertices](BenchmarkState& state) {
+          benchmarkExchange(state, std::make_shared<com::SharedMemoryCommunicationFactory>(
+                                       com::SharedMemoryCommunication::defaultBufferSize), vertices);
+        },
+        iterations, 4);
+#endif
+  }
+  return true;
+}();
+
+} // namespace
+
+#endif // not PRECICE_NO_MPI
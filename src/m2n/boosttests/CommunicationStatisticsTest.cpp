@@ -0,0 +1,46 @@
+#include "m2n/CommunicationStatistics.hpp"
+#include "testing/Testing.hpp"
+
+#include <sstream>
+
+using namespace precice;
+using namespace precice::m2n;
+
+BOOST_AUTO_TEST_SUITE(M2NTests)
+
+BOOST_AUTO_TEST_CASE(CommunicationStatisticsCounters, * testing::OnMaster())
+{
+  CommunicationStatistics::clear();
+  {
+    CommunicationStatistics::ScopedSetData scope("FluidMesh", "Forces");
+    CommunicationStatistics::add(1, 80, std::chrono::milliseconds(2));
+    CommunicationStatistics::add(1, 80, std::chrono::milliseconds(1));
+    CommunicationStatistics::add(3, 40, CommunicationStatistics::Clock::duration::zero());
+    {
+      CommunicationStatistics::ScopedSetData nested("FluidMesh", "Velocities");
+      CommunicationStatistics::add(1, 24, CommunicationStatistics::Clock::duration::zero());
+    }
+    CommunicationStatistics::add(3, 40, CommunicationStatistics::Clock::duration::zero());
+  }
+
+  auto counters = CommunicationStatistics::getCounters();
+  BOOST_TEST(counters.size() == 3);
+  auto & toOne = counters[std::make_tuple("FluidMesh", "Forces", 1)];
+  BOOST_TEST(toOne.messages == 2);
+  BOOST_TEST(toOne.bytes == 160);
+  BOOST_TEST(toOne.waitTime == 0.003);
+
+  auto forces = CommunicationStatistics::getTotal("FluidMesh", "Forces");
+  BOOST_TEST(forces.messages == 4);
+  BOOST_TEST(forces.bytes == 240);
+  BOOST_TEST(CommunicationStatistics::getTotal("FluidMesh", "Velocities").bytes == 24);
+  BOOST_TEST(CommunicationStatistics::getTotal("SolidMesh", "Forces").messages == 0);
+
+  std::ostringstream csv;
+  CommunicationStatistics::writeCSV(csv);
+  BOOST_TEST(csv.str().find("0,FluidMesh,Forces,3,2,80,0\n") != std::string::npos);
+
+  CommunicationStatistics::clear();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,39 @@
+#include "testing/Testing.hpp"
+#include "m2n/config/M2NConfiguration.hpp"
+#include "m2n/M2N.hpp"
+#include "m2n/PointToPointCommunication.hpp"
+#include "mesh/Mesh.hpp"
+#include "xml/XMLTag.hpp"
+#include "utils/Globals.hpp"
+
+using namespace precice;
+using namespace precice::m2n;
+
+BOOST_AUTO_TEST_SUITE(M2NTests)
+BOOST_AUTO_TEST_SUITE(Configuration)
+
+BOOST_AUTO_TEST_CASE(ConnectionTimeout)
+{
+  std::string file(utils::getPathToSources() + "/m2n/boosttests/m2n-config.xml");
+  xml::XMLTag tag = xml::getRootTag();
+  M2NConfiguration config(tag);
+  xml::configure(tag, file);
+  BOOST_TEST(config.m2ns().size() == 2);
+
+  mesh::PtrMesh mesh(new mesh::Mesh("Mesh", 2, false));
+
+  PtrM2N m2n = config.getM2N("SolverOne", "SolverTwo");
+  m2n->createDistributedCommunication(mesh);
+  auto p2p = std::dynamic_pointer_cast<PointToPointCommunication>(m2n->_distComs[mesh->getID()]);
+  BOOST_TEST_REQUIRE(p2p.get() != nullptr);
+  BOOST_TEST(p2p->_connectionTimeout == 2.5);
+
+  m2n = config.getM2N("SolverOne", "SolverThree");
+  m2n->createDistributedCommunication(mesh);
+  p2p = std::dynamic_pointer_cast<PointToPointCommunication>(m2n->_distComs[mesh->getID()]);
+  BOOST_TEST_REQUIRE(p2p.get() != nullptr);
+  BOOST_TEST(p2p->_connectionTimeout == 0.0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -26,14 +26,14 @@ void process(vector<double> &data) {
   }
 }
 
-void P2PComTest1(com::PtrCommunicationFactory cf) {
+void P2PComTest1(com::PtrCommunicationFactory cf, bool exchangeAddressesViaMasters = false, double connectionTimeout = 0.0) {
   assertion(Parallel::getCommunicatorSize() == 4);
 
   MasterSlave::_communication = std::make_shared<com::MPIDirectCommunication>();
 
   mesh::PtrMesh mesh(new mesh::Mesh("Mesh", 2, true));
 
-  m2n::PointToPointCommunication c(cf, mesh);
+  m2n::PointToPointCommunication c(cf, mesh, exchangeAddressesViaMasters, connectionTimeout);
 
   vector<double> data;
   vector<double> expectedData;
@@ -162,14 +162,14 @@ void P2PComTest1(com::PtrCommunicationFactory cf) {
 }
 
 /// a very similar test, but with a vertex that has been completely filtered out
-void P2PComTest2(com::PtrCommunicationFactory cf) {
+void P2PComTest2(com::PtrCommunicationFactory cf, bool exchangeAddressesViaMasters = false, double connectionTimeout = 0.0) {
   assertion(Parallel::getCommunicatorSize() == 4);
 
   MasterSlave::_communication = std::make_shared<com::MPIDirectCommunication>();
 
   mesh::PtrMesh mesh(new mesh::Mesh("Mesh", 2, true));
 
-  m2n::PointToPointCommunication c(cf, mesh);
+  m2n::PointToPointCommunication c(cf, mesh, exchangeAddressesViaMasters, connectionTimeout);
 
   vector<double> data;
   vector<double> expectedData;
@@ -305,6 +305,23 @@ BOOST_AUTO_TEST_CASE(SocketCommunication, *testing::OnSize(4)) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(SocketCommunicationWithTimeout, *testing::OnSize(4)) {
+  // The connections are established in time, every single one is waited for with the timeout
+  com::PtrCommunicationFactory cf(new com::SocketCommunicationFactory);
+  if (utils::Parallel::getProcessRank() < 4) {
+    P2PComTest1(cf, false, 60.0);
+    P2PComTest2(cf, false, 60.0);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(SocketCommunicationAddressesViaMasters, *testing::OnSize(4)) {
+  com::PtrCommunicationFactory cf(new com::SocketCommunicationFactory);
+  if (utils::Parallel::getProcessRank() < 4) {
+    P2PComTest1(cf, true);
+    P2PComTest2(cf, true);
+  }
+}
+
 BOOST_AUTO_TEST_CASE(MPIPortsCommunication,
                      *testing::OnSize(4) *
                          boost::unit_test::label("MPI_Ports")) {
@@ -315,6 +332,16 @@ BOOST_AUTO_TEST_CASE(MPIPortsCommunication,
   }
 }
 
+BOOST_AUTO_TEST_CASE(MPIPortsCommunicationAddressesViaMasters,
+                     *testing::OnSize(4) *
+                         boost::unit_test::label("MPI_Ports")) {
+  com::PtrCommunicationFactory cf(new com::MPIPortsCommunicationFactory);
+  if (utils::Parallel::getProcessRank() < 4) {
+    P2PComTest1(cf, true);
+    P2PComTest2(cf, true);
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 #endif // not PRECICE_NO_MPI
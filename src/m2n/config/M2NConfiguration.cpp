@@ -3,6 +3,7 @@
 #include "m2n/DistributedComFactory.hpp"
 #include "m2n/GatherScatterComFactory.hpp"
 #include "m2n/PointToPointComFactory.hpp"
+#include "com/SharedMemoryCommunicationFactory.hpp"
 #include "com/SocketCommunicationFactory.hpp"
 #include "com/MPIPortsCommunicationFactory.hpp"
 #include "com/MPIDirectCommunication.hpp"
@@ -31,11 +32,17 @@ M2NConfiguration:: M2NConfiguration
   ATTR_PORT("port"),
   ATTR_NETWORK("network"),
   ATTR_EXCHANGE_DIRECTORY("exchange-directory"),
+  ATTR_BUFFER_SIZE("buffer-size"),
+  ATTR_ADDRESS_EXCHANGE("address-exchange"),
+  ATTR_CONNECTION_TIMEOUT("connection-timeout"),
   VALUE_MPI("mpi"),
   VALUE_MPI_SINGLE("mpi-single"),
   VALUE_SOCKETS("sockets"),
+  VALUE_SHARED_MEMORY("shared-memory"),
   VALUE_GATHER_SCATTER("gather-scatter"),
   VALUE_POINT_TO_POINT("point-to-point"),
+  VALUE_FILES("files"),
+  VALUE_MASTERS("masters"),
   _m2ns()
 {
   using namespace xml;
@@ -75,6 +82,30 @@ M2NConfiguration:: M2NConfiguration
 
     tags.push_back(tag);
   }
+  {
+    XMLTag tag(*this, VALUE_SHARED_MEMORY, occ, TAG);
+    doc = "Communication via ring buffers in shared memory. Both participants have to run on the same ";
+    doc += "host, e.g. for small cases on a workstation. Avoids the overhead of sockets over the loopback ";
+    doc += "device.";
+    tag.setDocumentation(doc);
+
+    XMLAttribute<int> attrBufferSize(ATTR_BUFFER_SIZE);
+    doc = "Capacity in bytes of the buffer of each direction of a connection, rounded up to a power of two. ";
+    doc += "Larger messages are passed in several parts.";
+    attrBufferSize.setDocumentation(doc);
+    attrBufferSize.setDefaultValue(1 << 20);
+    tag.addAttribute(attrBufferSize);
+
+    XMLAttribute<std::string> attrExchangeDirectory(ATTR_EXCHANGE_DIRECTORY);
+    doc = "Directory where connection information is exchanged. By default, the ";
+    doc += "directory of startup is chosen, and both solvers have to be started ";
+    doc += "in the same directory.";
+    attrExchangeDirectory.setDocumentation(doc);
+    attrExchangeDirectory.setDefaultValue("");
+    tag.addAttribute(attrExchangeDirectory);
+
+    tags.push_back(tag);
+  }
   {
     XMLTag tag(*this, VALUE_MPI, occ, TAG);
     doc = "Communication via MPI with startup in separated communication spaces.";
@@ -117,6 +148,27 @@ M2NConfiguration:: M2NConfiguration
   attrDistrTypeOnly.setValidator ( validDistrGatherScatter );
   attrDistrTypeOnly.setDefaultValue(VALUE_GATHER_SCATTER);
 
+  XMLAttribute<std::string> attrAddressExchange(ATTR_ADDRESS_EXCHANGE);
+  doc = "Exchange of the connection addresses of a \"" + VALUE_POINT_TO_POINT + "\" communication. ";
+  doc += "\"" + VALUE_FILES + "\" publishes one address file per rank in the exchange directory. ";
+  doc += "\"" + VALUE_MASTERS + "\" only exchanges a file between the masters, the addresses of all ";
+  doc += "ranks are sent in bulk over the connection of the masters. This is recommended for many ranks ";
+  doc += "or slow network file systems.";
+  attrAddressExchange.setDocumentation(doc);
+  ValidatorEquals<std::string> validFiles(VALUE_FILES);
+  ValidatorEquals<std::string> validMasters(VALUE_MASTERS);
+  attrAddressExchange.setValidator(validFiles || validMasters);
+  attrAddressExchange.setDefaultValue(VALUE_FILES);
+
+  XMLAttribute<double> attrConnectionTimeout(ATTR_CONNECTION_TIMEOUT);
+  doc = "Time in seconds a rank of a \"" + VALUE_POINT_TO_POINT + "\" communication waits for the ";
+  doc += "connections to all its partner ranks, before the setup is aborted with a list of the missing ";
+  doc += "ranks. A value of 0 waits without limit. Pending connection attempts are not cancelled, but end with ";
+  doc += "the aborted participant. For MPI ports without MPI_THREAD_MULTIPLE support, the connections are made one ";
+  doc += "after the other and the timeout is only checked between two of them.";
+  attrConnectionTimeout.setDocumentation(doc);
+  attrConnectionTimeout.setDefaultValue(0.0);
+
   XMLAttribute<std::string> attrFrom ( ATTR_FROM );
   doc = "First participant name involved in communication. For performance reasons, we recommend to use ";
   doc += "the participant with less ranks at the coupling interface as \"from\" in the m2n communication.";
@@ -128,8 +180,10 @@ M2NConfiguration:: M2NConfiguration
   for (XMLTag& tag : tags) {
     tag.addAttribute(attrFrom);
     tag.addAttribute(attrTo);
-    if(tag.getName() == VALUE_MPI || tag.getName() == VALUE_SOCKETS){
+    if(tag.getName() == VALUE_MPI || tag.getName() == VALUE_SOCKETS || tag.getName() == VALUE_SHARED_MEMORY){
       tag.addAttribute(attrDistrTypeBoth);
+      tag.addAttribute(attrAddressExchange);
+      tag.addAttribute(attrConnectionTimeout);
     }
     else{
       tag.addAttribute(attrDistrTypeOnly);
@@ -181,6 +235,20 @@ void M2NConfiguration:: xmlTagCallback
         comFactory = std::make_shared<com::SocketCommunicationFactory>(port, false, network, dir);
         com = comFactory->newCommunication();
     }
+    else if (tag.getName() == VALUE_SHARED_MEMORY){
+#     ifdef PRECICE_NO_SHARED_MEMORY
+        std::ostringstream error;
+        error << "Communication type \"" << VALUE_SHARED_MEMORY << "\" is only available on Linux";
+        throw error.str();
+#     else
+        int bufferSize = tag.getIntAttributeValue(ATTR_BUFFER_SIZE);
+        CHECK(bufferSize > 0,
+              "The value given for the \"" << ATTR_BUFFER_SIZE << "\" attribute has to be positive: " << bufferSize);
+        std::string dir = tag.getStringAttributeValue(ATTR_EXCHANGE_DIRECTORY);
+        comFactory = std::make_shared<com::SharedMemoryCommunicationFactory>(bufferSize, dir);
+        com = comFactory->newCommunication();
+#     endif
+    }
     else if (tag.getName() == VALUE_MPI){
       std::string dir = tag.getStringAttributeValue(ATTR_EXCHANGE_DIRECTORY);
 #     ifdef PRECICE_NO_MPI
@@ -212,8 +280,12 @@ void M2NConfiguration:: xmlTagCallback
       distrFactory = std::make_shared<GatherScatterComFactory>(com);
     }
     else if(distrType == VALUE_POINT_TO_POINT){
-      assertion(tag.getName() == VALUE_MPI || tag.getName() == VALUE_SOCKETS);
-      distrFactory = std::make_shared<PointToPointComFactory>(comFactory);
+      assertion(tag.getName() == VALUE_MPI || tag.getName() == VALUE_SOCKETS || tag.getName() == VALUE_SHARED_MEMORY);
+      bool exchangeAddressesViaMasters = tag.getStringAttributeValue(ATTR_ADDRESS_EXCHANGE) == VALUE_MASTERS;
+      double connectionTimeout = tag.getDoubleAttributeValue(ATTR_CONNECTION_TIMEOUT);
+      CHECK(connectionTimeout >= 0.0,
+            "The value given for the \"" << ATTR_CONNECTION_TIMEOUT << "\" attribute must not be negative: " << connectionTimeout);
+      distrFactory = std::make_shared<PointToPointComFactory>(comFactory, exchangeAddressesViaMasters, connectionTimeout);
     }
     assertion(distrFactory.get() != nullptr);
 
@@ -63,14 +63,21 @@ private:
    const std::string ATTR_PORT;
    const std::string ATTR_NETWORK;
    const std::string ATTR_EXCHANGE_DIRECTORY;
+   const std::string ATTR_BUFFER_SIZE;
+   const std::string ATTR_ADDRESS_EXCHANGE;
+   const std::string ATTR_CONNECTION_TIMEOUT;
 
    const std::string VALUE_MPI;
    const std::string VALUE_MPI_SINGLE;
    const std::string VALUE_SOCKETS;
+   const std::string VALUE_SHARED_MEMORY;
 
    const std::string VALUE_GATHER_SCATTER;
    const std::string VALUE_POINT_TO_POINT;
 
+   const std::string VALUE_FILES;
+   const std::string VALUE_MASTERS;
+
    std::vector<M2NTuple> _m2ns;
 
    void checkDuplicates (
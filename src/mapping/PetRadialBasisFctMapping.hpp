@@ -13,6 +13,7 @@
 #include "utils/Petsc.hpp"
 namespace petsc = precice::utils::petsc;
 #include "utils/EventTimings.hpp"
+#include "utils/Threads.hpp"
 
 #include "petscmat.h"
 #include "petscksp.h"
@@ -152,6 +153,28 @@ private:
   /// Prints an INFO about the current mapping
   void printMappingInfo(int inputDataID, int dim) const;
 
+  /// Global column indices and values of the basis function entries of a matrix row
+  /**
+   * The values are the distances to the vertices of the columns, until they are replaced by the
+   * basis function evaluated on them in evaluateRow().
+   */
+  struct RowEntries {
+    std::vector<PetscInt> cols;
+    std::vector<PetscScalar> values;
+  };
+
+  /// Number of rows whose entries are computed concurrently before they are inserted into a matrix
+  static const size_t rowBlockSize = 4096;
+
+  /// Evaluates the basis function on all distances of a row, in place
+  void evaluateRow(RowEntries& entries) const;
+
+  /// Collects the entries of a row of matrix C by comparing to all vertices of the input mesh
+  void computeRowMatrixC(const mesh::PtrMesh inMesh, const mesh::Vertex& inVertex, RowEntries& entries) const;
+
+  /// Collects the entries of a row of matrix A by comparing to all vertices of the input mesh
+  void computeRowMatrixA(const mesh::PtrMesh inMesh, const mesh::Vertex& oVertex, RowEntries& entries) const;
+
   /// Toggles use of preallocation for matrix C and A
   const Preallocation _preallocation;
 
@@ -163,13 +186,13 @@ private:
 
   void computePreallocationMatrixA(const mesh::PtrMesh inMesh, const mesh::PtrMesh outMesh);
 
-  std::vector<std::vector<std::pair<int, double>>> savedPreallocationMatrixC(const mesh::PtrMesh inMesh);
+  std::vector<RowEntries> savedPreallocationMatrixC(const mesh::PtrMesh inMesh);
   
-  std::vector<std::vector<std::pair<int, double>>> savedPreallocationMatrixA(const mesh::PtrMesh inMesh, const mesh::PtrMesh outMesh);
+  std::vector<RowEntries> savedPreallocationMatrixA(const mesh::PtrMesh inMesh, const mesh::PtrMesh outMesh);
 
-  std::vector<std::vector<std::pair<int, double>>> bgPreallocationMatrixC(const mesh::PtrMesh inMesh);
+  std::vector<RowEntries> bgPreallocationMatrixC(const mesh::PtrMesh inMesh);
   
-  std::vector<std::vector<std::pair<int, double>>> bgPreallocationMatrixA(const mesh::PtrMesh inMesh, const mesh::PtrMesh outMesh);
+  std::vector<RowEntries> bgPreallocationMatrixA(const mesh::PtrMesh inMesh, const mesh::PtrMesh outMesh);
 
 };
 
@@ -370,16 +393,14 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
 
   const PetscInt *mapIndizes;
   ISLocalToGlobalMappingGetIndices(_ISmapping, &mapIndizes);
-  
-  Eigen::VectorXd distance(dimensions);
 
   // We do preallocating of the matrices C and A. That means we traverse the input data once, just
   // to know where we have entries in the sparse matrix. This information petsc can use to
   // preallocate the matrix. In the second phase we actually fill the matrix.
 
   // -- BEGIN PREALLOC LOOP FOR MATRIX C --
-  std::vector<std::vector<std::pair<int, double>>> vertexData;
-   
+  std::vector<RowEntries> vertexData;
+
   if (_preallocation == Preallocation::SAVED) {
     vertexData = savedPreallocationMatrixC(inMesh);
   }
@@ -396,66 +417,59 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
   
   // -- BEGIN FILL LOOP FOR MATRIX C --
   precice::utils::Event eFillC("PetRBF.fillC");
-  // We collect entries for each row and set them blockwise using MatSetValues.
-  int preallocRow = 0;
+  // Rows are computed and evaluated concurrently in blocks, then inserted blockwise using MatSetValues.
+  std::vector<const mesh::Vertex*> ownedInVertices;
   for (const mesh::Vertex& inVertex : inMesh->vertices()) {
-    if (not inVertex.isOwner())
-      continue;
-
-    int row = inVertex.getGlobalIndex() + polyparams;
-    PetscInt colNum = 0;  // holds the number of columns
-    PetscInt colIdx[_matrixC.getSize().second];     // holds the columns indices of the entries
-    PetscScalar rowVals[_matrixC.getSize().second]; // holds the values of the entries
-    
-    // -- SETS THE POLYNOM PART OF THE MATRIX --
-    if (_polynomial == Polynomial::ON or _polynomial == Polynomial::SEPARATE) {
-      colIdx[colNum] = colNum;
-      rowVals[colNum++] = 1;
-      
-      for (int dim = 0; dim < dimensions; dim++) {
-        if (not _deadAxis[dim]) {
-          colIdx[colNum] = colNum;
-          rowVals[colNum++] = inVertex.getCoords()[dim];
-        }
-      }
-      
-      if (_polynomial == Polynomial::ON) {
-        ierr = MatSetValuesLocal(_matrixC, colNum, colIdx, 1, &row, rowVals, INSERT_VALUES); CHKERRV(ierr);
-      }
-      else if (_polynomial == Polynomial::SEPARATE) {
-        ierr = MatSetValuesLocal(_matrixQ, 1, &row, colNum, colIdx, rowVals, INSERT_VALUES); CHKERRV(ierr);
-      }
-      colNum = 0;
+    if (inVertex.isOwner())
+      ownedInVertices.push_back(&inVertex);
+  }
+  const bool preallocatedEntries = _preallocation == Preallocation::SAVED or _preallocation == Preallocation::TREE;
+  std::vector<RowEntries> rowBlock;
+  std::vector<PetscInt> polyIdx(dimensions + 1);
+  std::vector<PetscScalar> polyVals(dimensions + 1);
+  for (size_t blockBegin = 0; blockBegin < ownedInVertices.size(); blockBegin += rowBlockSize) {
+    size_t blockEnd = std::min(ownedInVertices.size(), blockBegin + rowBlockSize);
+    RowEntries* rows = preallocatedEntries ? &vertexData[blockBegin] : nullptr;
+    if (not preallocatedEntries) {
+      rowBlock.assign(blockEnd - blockBegin, RowEntries());
+      rows = rowBlock.data();
     }
-
-    // -- SETS THE COEFFICIENTS --
-    if (_preallocation == Preallocation::SAVED or _preallocation == Preallocation::TREE) {
-      const auto & rowVertices = vertexData[preallocRow];
-      for (const auto & vertex : rowVertices) {
-        rowVals[colNum] = _basisFunction.evaluate(vertex.second);
-        colIdx[colNum++] = vertex.first;
+    utils::parallelFor(0, blockEnd - blockBegin, 16, [&](size_t i) {
+      if (not preallocatedEntries) {
+        computeRowMatrixC(inMesh, *ownedInVertices[blockBegin + i], rows[i]);
       }
-      ++preallocRow;
-    }
-    else {
-      for (const mesh::Vertex& vj : inMesh->vertices()) {
-        int col = vj.getGlobalIndex() + polyparams;
-        if (row > col)
-          continue;
-        distance = inVertex.getCoords() - vj.getCoords();
-        for (int d = 0; d < dimensions; d++) {
-          if (_deadAxis[d]) {
-            distance[d] = 0;
+      evaluateRow(rows[i]);
+    });
+
+    for (size_t i = 0; i < blockEnd - blockBegin; i++) {
+      const mesh::Vertex& inVertex = *ownedInVertices[blockBegin + i];
+      int row = inVertex.getGlobalIndex() + polyparams;
+
+      // -- SETS THE POLYNOM PART OF THE MATRIX --
+      if (_polynomial == Polynomial::ON or _polynomial == Polynomial::SEPARATE) {
+        PetscInt colNum = 0;
+        polyIdx[colNum] = colNum;
+        polyVals[colNum++] = 1;
+
+        for (int dim = 0; dim < dimensions; dim++) {
+          if (not _deadAxis[dim]) {
+            polyIdx[colNum] = colNum;
+            polyVals[colNum++] = inVertex.getCoords()[dim];
           }
         }
-        if (_basisFunction.getSupportRadius() > distance.norm()) {
-          double coeff = _basisFunction.evaluate(distance.norm());
-          rowVals[colNum] = coeff;
-          colIdx[colNum++] = col; // column of entry is the globalIndex
+
+        if (_polynomial == Polynomial::ON) {
+          ierr = MatSetValuesLocal(_matrixC, colNum, polyIdx.data(), 1, &row, polyVals.data(), INSERT_VALUES); CHKERRV(ierr);
+        }
+        else if (_polynomial == Polynomial::SEPARATE) {
+          ierr = MatSetValuesLocal(_matrixQ, 1, &row, colNum, polyIdx.data(), polyVals.data(), INSERT_VALUES); CHKERRV(ierr);
         }
       }
+
+      // -- SETS THE COEFFICIENTS --
+      ierr = MatSetValuesLocal(_matrixC, 1, &row, rows[i].cols.size(), rows[i].cols.data(),
+                               rows[i].values.data(), INSERT_VALUES); CHKERRV(ierr);
     }
-    ierr = MatSetValuesLocal(_matrixC, 1, &row, colNum, colIdx, rowVals, INSERT_VALUES); CHKERRV(ierr);
   }
   DEBUG("Finished filling Matrix C");
   eFillC.stop();
@@ -489,54 +503,45 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
   DEBUG("Begin filling matrix A.");
   precice::utils::Event eFillA("PetRBF.fillA");
 
-  for (int row = ownerRangeABegin; row < ownerRangeAEnd; row++) {
-    PetscInt colNum = 0;
-    PetscInt colIdx[_matrixA.getSize().second];     // holds the columns indices of the entries
-    PetscScalar rowVals[_matrixA.getSize().second]; // holds the values of the entries
-    const mesh::Vertex& oVertex = outMesh->vertices()[row - _matrixA.ownerRange().first];
-
-    // -- SET THE POLYNOM PART OF THE MATRIX --
-    if (_polynomial == Polynomial::ON or _polynomial == Polynomial::SEPARATE) {
-      Mat m = _polynomial == Polynomial::ON ? _matrixA : _matrixV;
-      
-      colIdx[colNum] = colNum;
-      rowVals[colNum++] = 1;
-      
-      for (int dim = 0; dim < dimensions; dim++) {
-        if (not _deadAxis[dim]) {
-          colIdx[colNum] = colNum;
-          rowVals[colNum++] = oVertex.getCoords()[dim];
-        }
-      }
-      ierr = MatSetValuesLocal(m, 1, &row, colNum, colIdx, rowVals, INSERT_VALUES); CHKERRV(ierr);
-      colNum = 0;
+  const size_t rowsA = ownerRangeAEnd - ownerRangeABegin;
+  for (size_t blockBegin = 0; blockBegin < rowsA; blockBegin += rowBlockSize) {
+    size_t blockEnd = std::min(rowsA, blockBegin + rowBlockSize);
+    RowEntries* rows = preallocatedEntries ? &vertexData[blockBegin] : nullptr;
+    if (not preallocatedEntries) {
+      rowBlock.assign(blockEnd - blockBegin, RowEntries());
+      rows = rowBlock.data();
     }
-    
-    // -- SETS THE COEFFICIENTS --
-    if (_preallocation == Preallocation::SAVED or _preallocation == Preallocation::TREE) {
-      const auto & rowVertices = vertexData[row - ownerRangeABegin];
-      for (const auto & vertex : rowVertices) {
-        // std::cout << "Setting colNum = " << colNum << ", idx = " << vertex.first
-        // << " to " << _basisFunction.evaluate(vertex.second) << "\n";
-        rowVals[colNum] = _basisFunction.evaluate(vertex.second);
-        colIdx[colNum++] = vertex.first;
+    utils::parallelFor(0, blockEnd - blockBegin, 16, [&](size_t i) {
+      if (not preallocatedEntries) {
+        computeRowMatrixA(inMesh, outMesh->vertices()[blockBegin + i], rows[i]);
       }
-    }
-    else {
-      for (const mesh::Vertex& inVertex : inMesh->vertices()) {
-        distance = oVertex.getCoords() - inVertex.getCoords();
-        for (int d = 0; d < dimensions; d++) {
-          if (_deadAxis[d])
-            distance[d] = 0;
-        }
-        if (_basisFunction.getSupportRadius() > distance.norm()) {
-          double coeff = _basisFunction.evaluate(distance.norm());
-          rowVals[colNum] = coeff;
-          colIdx[colNum++] = inVertex.getGlobalIndex() + polyparams;
+      evaluateRow(rows[i]);
+    });
+
+    for (size_t i = 0; i < blockEnd - blockBegin; i++) {
+      int row = ownerRangeABegin + blockBegin + i;
+      const mesh::Vertex& oVertex = outMesh->vertices()[blockBegin + i];
+
+      // -- SET THE POLYNOM PART OF THE MATRIX --
+      if (_polynomial == Polynomial::ON or _polynomial == Polynomial::SEPARATE) {
+        Mat m = _polynomial == Polynomial::ON ? _matrixA : _matrixV;
+        PetscInt colNum = 0;
+        polyIdx[colNum] = colNum;
+        polyVals[colNum++] = 1;
+
+        for (int dim = 0; dim < dimensions; dim++) {
+          if (not _deadAxis[dim]) {
+            polyIdx[colNum] = colNum;
+            polyVals[colNum++] = oVertex.getCoords()[dim];
+          }
         }
+        ierr = MatSetValuesLocal(m, 1, &row, colNum, polyIdx.data(), polyVals.data(), INSERT_VALUES); CHKERRV(ierr);
       }
+
+      // -- SETS THE COEFFICIENTS --
+      ierr = MatSetValuesLocal(_matrixA, 1, &row, rows[i].cols.size(), rows[i].cols.data(),
+                               rows[i].values.data(), INSERT_VALUES); CHKERRV(ierr);
     }
-    ierr = MatSetValuesLocal(_matrixA, 1, &row, colNum, colIdx, rowVals, INSERT_VALUES); CHKERRV(ierr);
   }
   DEBUG("Finished filling Matrix A");
   eFillA.stop();
@@ -643,15 +648,18 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::map(int inputDataID, int
     petsc::Vector au(_matrixA, "au", petsc::Vector::RIGHT);
     petsc::Vector in(_matrixA, "in");
     
-    // Fill input from input data values
+    // Fill input from input data values, the rows of A are the input vertices in local order
+    assertion(in.getLocalSize() == static_cast<int>(input()->vertices().size()),
+              in.getLocalSize(), input()->vertices().size());
     for (int dim = 0; dim < valueDim; dim++) {
       printMappingInfo(inputDataID, dim);
-  
+
+      PetscScalar *inArray;
+      ierr = VecGetArray(in, &inArray); CHKERRV(ierr);
       for (size_t i = 0; i < input()->vertices().size(); i++ ) {
-        int globalIndex = input()->vertices()[i].getGlobalIndex();
-        VecSetValue(in, globalIndex, inValues[i*valueDim + dim], INSERT_VALUES); // Dies besser als VecSetValuesLocal machen
+        inArray[i] = inValues[i*valueDim + dim];
       }
-      in.assemble();
+      ierr = VecRestoreArray(in, &inArray); CHKERRV(ierr);
 
       // Gets the petsc::vector for the given combination of outputData, inputData and dimension
       // If none created yet, create one, based on _matrixC
@@ -701,20 +709,26 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::map(int inputDataID, int
     petsc::Vector in(_matrixC, "in");
     petsc::Vector a(_matrixQ, "a", petsc::Vector::RIGHT); // holds the solution of the LS polynom
         
-    ierr = VecSetLocalToGlobalMapping(in, _ISmapping); CHKERRV(ierr);
     const PetscScalar *vecArray;
 
     // For every data dimension, perform mapping
     for (int dim=0; dim < valueDim; dim++) {
       printMappingInfo(inputDataID, dim);
       
-      // Fill input from input data values
+      // Fill input from input data values. The local rows of C are the polynomial rows on rank 0,
+      // followed by the owned vertices, each value is set by the owner of its vertex.
+      PetscScalar *inArray;
+      ierr = VecGetArray(in, &inArray); CHKERRV(ierr);
       int count = 0;
+      int localRow = localPolyparams;
       for (const auto& vertex : input()->vertices()) {
-        ierr = VecSetValueLocal(in, vertex.getGlobalIndex()+polyparams, inValues[count*valueDim + dim], INSERT_VALUES); CHKERRV(ierr); // evtl. besser als VecSetValuesLocal
+        if (vertex.isOwner()) {
+          inArray[localRow++] = inValues[count*valueDim + dim];
+        }
         count++;
       }
-      in.assemble();
+      assertion(localRow == in.getLocalSize(), localRow, in.getLocalSize());
+      ierr = VecRestoreArray(in, &inArray); CHKERRV(ierr);
             
       if (_polynomial == Polynomial::SEPARATE) {
         KSPSolve(_QRsolver, in, a);
@@ -852,6 +866,54 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::tagMeshSecondRound()
 }
 
 
+template <typename RADIAL_BASIS_FUNCTION_T>
+void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::evaluateRow(RowEntries& entries) const
+{
+  evaluateAll(_basisFunction, entries.values.data(), entries.values.size());
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeRowMatrixC(
+  const mesh::PtrMesh inMesh, const mesh::Vertex& inVertex, RowEntries& entries) const
+{
+  const int dimensions = input()->getDimensions();
+  const int row = inVertex.getGlobalIndex() + polyparams;
+  Eigen::VectorXd distance(dimensions);
+  for (const mesh::Vertex& vj : inMesh->vertices()) {
+    int col = vj.getGlobalIndex() + polyparams;
+    if (row > col)
+      continue;
+    distance = inVertex.getCoords() - vj.getCoords();
+    for (int d = 0; d < dimensions; d++) {
+      if (_deadAxis[d])
+        distance[d] = 0;
+    }
+    if (_basisFunction.getSupportRadius() > distance.norm()) {
+      entries.cols.push_back(col); // column of entry is the globalIndex
+      entries.values.push_back(distance.norm());
+    }
+  }
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeRowMatrixA(
+  const mesh::PtrMesh inMesh, const mesh::Vertex& oVertex, RowEntries& entries) const
+{
+  const int dimensions = input()->getDimensions();
+  Eigen::VectorXd distance(dimensions);
+  for (const mesh::Vertex& inVertex : inMesh->vertices()) {
+    distance = oVertex.getCoords() - inVertex.getCoords();
+    for (int d = 0; d < dimensions; d++) {
+      if (_deadAxis[d])
+        distance[d] = 0;
+    }
+    if (_basisFunction.getSupportRadius() > distance.norm()) {
+      entries.cols.push_back(inVertex.getGlobalIndex() + polyparams);
+      entries.values.push_back(distance.norm());
+    }
+  }
+}
+
 template <typename RADIAL_BASIS_FUNCTION_T>
 void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::printMappingInfo(int inputDataID, int dim) const
 {
@@ -1115,7 +1177,8 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computePreallocationMatr
 }
 
 template <typename RADIAL_BASIS_FUNCTION_T>
-std::vector<std::vector<std::pair<int, double>>> PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::savedPreallocationMatrixC(
+std::vector<typename PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::RowEntries>
+PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::savedPreallocationMatrixC(
   const mesh::PtrMesh inMesh)
 {
   precice::utils::Event ePreallocC("PetRBF.PreallocC");
@@ -1126,32 +1189,39 @@ std::vector<std::vector<std::pair<int, double>>> PetRadialBasisFctMapping<RADIAL
   ISLocalToGlobalMappingGetIndices(_ISmapping, &mapIndizes);
 
   int dimensions = input()->getDimensions();
-  Eigen::VectorXd distance(dimensions);
-  
+
   std::tie(n, std::ignore) = _matrixC.getLocalSize();
   std::vector<PetscInt> d_nnz(n), o_nnz(n);
   PetscInt colOwnerRangeCBegin, colOwnerRangeCEnd;
   std::tie(colOwnerRangeCBegin, colOwnerRangeCEnd) = _matrixC.ownerRangeColumn();
 
-  std::vector<std::vector<std::pair<int, double>>> vertexData(n - localPolyparams);
+  std::vector<RowEntries> vertexData(n - localPolyparams);
   
-  size_t local_row = 0;
   // -- PREALLOCATES THE POLYNOMIAL PART OF THE MATRIX --
   if (_polynomial == Polynomial::ON) {
-    for (local_row = 0; local_row < localPolyparams; local_row++) {
+    for (size_t local_row = 0; local_row < localPolyparams; local_row++) {
       d_nnz[local_row] = colOwnerRangeCEnd - colOwnerRangeCBegin;
       o_nnz[local_row] = _matrixC.getSize().first - d_nnz[local_row];
     }
   }
 
+  std::vector<const mesh::Vertex*> ownedInVertices;
   for (const mesh::Vertex& inVertex : inMesh->vertices()) {
-    if (not inVertex.isOwner())
-      continue;
+    if (inVertex.isOwner())
+      ownedInVertices.push_back(&inVertex);
+  }
+  const PetscInt ownerRangeCBegin = _matrixC.ownerRange().first;
 
+  // Rows are independent of each other and computed concurrently
+  utils::parallelFor(0, ownedInVertices.size(), 16, [&](size_t k) {
+    const mesh::Vertex& inVertex = *ownedInVertices[k];
+    const size_t local_row = k + localPolyparams;
     PetscInt col = polyparams - 1;
-    const int global_row = local_row + _matrixC.ownerRange().first;
+    const int global_row = local_row + ownerRangeCBegin;
     d_nnz[local_row] = 0;
     o_nnz[local_row] = 0;
+    Eigen::VectorXd distance(dimensions);
+    RowEntries& entries = vertexData[k];
       
     // -- PREALLOCATES THE COEFFICIENTS --
     for (mesh::Vertex& vj : inMesh->vertices()) {
@@ -1167,15 +1237,15 @@ std::vector<std::vector<std::pair<int, double>>> PetRadialBasisFctMapping<RADIAL
           distance[d] = 0;
        
       if (_basisFunction.getSupportRadius() > distance.norm() or col == global_row) {
-        vertexData[local_row - localPolyparams].emplace_back( vj.getGlobalIndex() + polyparams, distance.norm() );
+        entries.cols.push_back(vj.getGlobalIndex() + polyparams);
+        entries.values.push_back(distance.norm());
         if (mapped_col >= colOwnerRangeCBegin and mapped_col < colOwnerRangeCEnd)
           d_nnz[local_row]++;
         else
           o_nnz[local_row]++;
       }
     }
-    local_row++;
-  }
+  });
         
   if (utils::Parallel::getCommunicatorSize() == 1) {
     // std::cout << "Computed Preallocation C Seq diagonal = " << std::accumulate(d_nnz.begin(), d_nnz.end(), 0) << std::endl;
@@ -1195,7 +1265,8 @@ std::vector<std::vector<std::pair<int, double>>> PetRadialBasisFctMapping<RADIAL
 }
 
 template <typename RADIAL_BASIS_FUNCTION_T>
-std::vector<std::vector<std::pair<int, double>>> PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::savedPreallocationMatrixA(
+std::vector<typename PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::RowEntries>
+PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::savedPreallocationMatrixA(
   const mesh::PtrMesh inMesh, const mesh::PtrMesh outMesh)
 {
   INFO("Using saved preallocation");
@@ -1213,16 +1284,18 @@ std::vector<std::vector<std::pair<int, double>>> PetRadialBasisFctMapping<RADIAL
   int dimensions = input()->getDimensions();
     
   std::vector<PetscInt> d_nnz(outputSize), o_nnz(outputSize);
-  Eigen::VectorXd distance(dimensions);
 
   // Contains localRow<localCols<colPosition, distance>>>
-  std::vector<std::vector<std::pair<int, double>>> vertexData(outputSize);
+  std::vector<RowEntries> vertexData(outputSize);
         
-  for (int localRow = 0; localRow < ownerRangeAEnd - ownerRangeABegin; localRow++) {
+  // Rows are independent of each other and computed concurrently
+  utils::parallelFor(0, ownerRangeAEnd - ownerRangeABegin, 16, [&](size_t localRow) {
     d_nnz[localRow] = 0;
     o_nnz[localRow] = 0;
     PetscInt col = 0;
     const mesh::Vertex& oVertex = outMesh->vertices()[localRow];
+    Eigen::VectorXd distance(dimensions);
+    RowEntries& entries = vertexData[localRow];
 
     // -- PREALLOCATE THE POLYNOM PART OF THE MATRIX --
     if (_polynomial == Polynomial::ON) {
@@ -1252,7 +1325,8 @@ std::vector<std::vector<std::pair<int, double>>> PetRadialBasisFctMapping<RADIAL
         
       if (_basisFunction.getSupportRadius() > distance.norm()) {
         col = inVertex.getGlobalIndex() + polyparams;
-        vertexData[localRow].emplace_back(col, distance.norm());
+        entries.cols.push_back(col);
+        entries.values.push_back(distance.norm());
 
         if (mapIndizes[col] >= colOwnerRangeABegin and mapIndizes[col] < colOwnerRangeAEnd)
           d_nnz[localRow]++;
@@ -1260,7 +1334,7 @@ std::vector<std::vector<std::pair<int, double>>> PetRadialBasisFctMapping<RADIAL
           o_nnz[localRow]++;
       }
     }
-  }
+  });
   if (utils::Parallel::getCommunicatorSize() == 1) {
     // std::cout << "Preallocation A Seq diagonal = " << std::accumulate(d_nnz.begin(), d_nnz.end(), 0) << std::endl;
     MatSeqAIJSetPreallocation(_matrixA, 0, d_nnz.data());
@@ -1279,7 +1353,8 @@ std::vector<std::vector<std::pair<int, double>>> PetRadialBasisFctMapping<RADIAL
 
 
 template <typename RADIAL_BASIS_FUNCTION_T>
-std::vector<std::vector<std::pair<int, double>>> PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::bgPreallocationMatrixC(
+std::vector<typename PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::RowEntries>
+PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::bgPreallocationMatrixC(
   const mesh::PtrMesh inMesh)
 {
   INFO("Using tree-based preallocation for matrix C");
@@ -1295,32 +1370,39 @@ std::vector<std::vector<std::pair<int, double>>> PetRadialBasisFctMapping<RADIAL
   ISLocalToGlobalMappingGetIndices(_ISmapping, &mapIndizes);
   
   int dimensions = input()->getDimensions();
-  Eigen::VectorXd distance(dimensions);
-  
+
   std::tie(n, std::ignore) = _matrixC.getLocalSize();
   std::vector<PetscInt> d_nnz(n), o_nnz(n);
   PetscInt colOwnerRangeCBegin, colOwnerRangeCEnd;
   std::tie(colOwnerRangeCBegin, colOwnerRangeCEnd) = _matrixC.ownerRangeColumn();
 
-  std::vector<std::vector<std::pair<int, double>>> vertexData(n - localPolyparams);
+  std::vector<RowEntries> vertexData(n - localPolyparams);
   
-  size_t local_row = 0;
   // -- PREALLOCATES THE POLYNOMIAL PART OF THE MATRIX --
   if (_polynomial == Polynomial::ON) {
-    for (local_row = 0; local_row < localPolyparams; local_row++) {
+    for (size_t local_row = 0; local_row < localPolyparams; local_row++) {
       d_nnz[local_row] = colOwnerRangeCEnd - colOwnerRangeCBegin;
       o_nnz[local_row] = _matrixC.getSize().first - d_nnz[local_row];
     }
   }
 
+  std::vector<const mesh::Vertex*> ownedInVertices;
   for (const mesh::Vertex& inVertex : inMesh->vertices()) {
-    if (not inVertex.isOwner())
-      continue;
+    if (inVertex.isOwner())
+      ownedInVertices.push_back(&inVertex);
+  }
+  const PetscInt ownerRangeCBegin = _matrixC.ownerRange().first;
 
+  // Rows are independent of each other and computed concurrently
+  utils::parallelFor(0, ownedInVertices.size(), 16, [&](size_t k) {
+    const mesh::Vertex& inVertex = *ownedInVertices[k];
+    const size_t local_row = k + localPolyparams;
     PetscInt col = polyparams - 1;
-    const int global_row = local_row + _matrixC.ownerRange().first;
+    const int global_row = local_row + ownerRangeCBegin;
     d_nnz[local_row] = 0;
     o_nnz[local_row] = 0;
+    Eigen::VectorXd distance(dimensions);
+    RowEntries& entries = vertexData[k];
     
     // -- PREALLOCATES THE COEFFICIENTS --
     std::vector<size_t> results;
@@ -1345,15 +1427,15 @@ std::vector<std::vector<std::pair<int, double>>> PetRadialBasisFctMapping<RADIAL
           distance[d] = 0;
        
       if (_basisFunction.getSupportRadius() > distance.norm() or col == global_row) {
-        vertexData[local_row - localPolyparams].emplace_back( vj.getGlobalIndex() + polyparams, distance.norm() );
+        entries.cols.push_back(vj.getGlobalIndex() + polyparams);
+        entries.values.push_back(distance.norm());
         if (mapped_col >= colOwnerRangeCBegin and mapped_col < colOwnerRangeCEnd)
           d_nnz[local_row]++;
         else
           o_nnz[local_row]++;
       }
     }
-    local_row++;
-  }
+  });
   
   if (utils::Parallel::getCommunicatorSize() == 1) {
     MatSeqSBAIJSetPreallocation(_matrixC, _matrixC.blockSize(), 0, d_nnz.data());
@@ -1370,7 +1452,8 @@ std::vector<std::vector<std::pair<int, double>>> PetRadialBasisFctMapping<RADIAL
 }
 
 template <typename RADIAL_BASIS_FUNCTION_T>
-std::vector<std::vector<std::pair<int, double>>> PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::bgPreallocationMatrixA(
+std::vector<typename PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::RowEntries>
+PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::bgPreallocationMatrixA(
   const mesh::PtrMesh inMesh, const mesh::PtrMesh outMesh)
 {
   INFO("Using tree-based preallocation for matrix A");
@@ -1391,16 +1474,18 @@ std::vector<std::vector<std::pair<int, double>>> PetRadialBasisFctMapping<RADIAL
   int dimensions = input()->getDimensions();
     
   std::vector<PetscInt> d_nnz(outputSize), o_nnz(outputSize);
-  Eigen::VectorXd distance(dimensions);
 
   // Contains localRow<localCols<colPosition, distance>>>
-  std::vector<std::vector<std::pair<int, double>>> vertexData(outputSize);
+  std::vector<RowEntries> vertexData(outputSize);
   
-  for (int localRow = 0; localRow < ownerRangeAEnd - ownerRangeABegin; localRow++) {
+  // Rows are independent of each other and computed concurrently
+  utils::parallelFor(0, ownerRangeAEnd - ownerRangeABegin, 16, [&](size_t localRow) {
     d_nnz[localRow] = 0;
     o_nnz[localRow] = 0;
     PetscInt col = 0;
     const mesh::Vertex& oVertex = outMesh->vertices()[localRow];
+    Eigen::VectorXd distance(dimensions);
+    RowEntries& entries = vertexData[localRow];
     
     // -- PREALLOCATE THE POLYNOM PART OF THE MATRIX --
     if (_polynomial == Polynomial::ON) {
@@ -1439,7 +1524,8 @@ std::vector<std::vector<std::pair<int, double>>> PetRadialBasisFctMapping<RADIAL
         
         if (_basisFunction.getSupportRadius() > distance.norm()) {
           col = inVertex.getGlobalIndex() + polyparams;
-          vertexData[localRow].emplace_back(col, distance.norm());
+          entries.cols.push_back(col);
+          entries.values.push_back(distance.norm());
 
           if (mapIndizes[col] >= colOwnerRangeABegin and mapIndizes[col] < colOwnerRangeAEnd)
             d_nnz[localRow]++;
@@ -1447,7 +1533,7 @@ std::vector<std::vector<std::pair<int, double>>> PetRadialBasisFctMapping<RADIAL
             o_nnz[localRow]++;
         }
     }
-  }
+  });
   if (utils::Parallel::getCommunicatorSize() == 1) {
     MatSeqAIJSetPreallocation(_matrixA, 0, d_nnz.data());
   }
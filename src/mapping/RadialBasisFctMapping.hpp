@@ -2,12 +2,19 @@
 
 #include "Mapping.hpp"
 #include "impl/BasisFunctions.hpp"
+#include "impl/Distances.hpp"
 #include "utils/MasterSlave.hpp"
 #include "io/TXTWriter.hpp"
 
 #include <Eigen/Core>
 #include <Eigen/QR>
 
+// Forward declaration to friend the boost test struct
+namespace MappingTests {
+namespace RadialBasisFunctionMapping {
+struct ReducedCoordinates;
+}}
+
 namespace precice {
 namespace mapping {
 
@@ -66,6 +73,8 @@ private:
 
   static precice::logging::Logger _log;
 
+  friend struct MappingTests::RadialBasisFunctionMapping::ReducedCoordinates;
+
   bool _hasComputedMapping;
 
   /// Radial basis function type used in interpolation.
@@ -78,8 +87,8 @@ private:
   /// true if the mapping along some axis should be ignored
   bool* _deadAxis;
 
-  /// Deletes all dead directions from fullVector and returns a vector of reduced dimensionality.
-  Eigen::VectorXd reduceVector(const Eigen::VectorXd& fullVector);
+  /// Returns the vertex coordinates of mesh without the dead directions, one column per vertex.
+  Eigen::MatrixXd reducedCoordinates(const mesh::Mesh& mesh) const;
   
   void setDeadAxis(bool xDead, bool yDead, bool zDead)
   {
@@ -172,20 +181,22 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>:: computeMapping()
   _matrixA = Eigen::MatrixXd(outputSize, n);
   _matrixA.setZero();
 
-  // Fill upper right part (due to symmetry) of _matrixCLU with values
-  int i = 0;
-  Eigen::VectorXd difference(dimensions);
-  for (const mesh::Vertex& iVertex : inMesh->vertices()) {
-    for (int j = iVertex.getID(); j < inputSize; j++) {
-      difference = iVertex.getCoords();
-      difference -= inMesh->vertices()[j].getCoords();
-      matrixCLU(i,j) = _basisFunction.evaluate(reduceVector(difference).norm());
-    }
+  // The distances and basis functions are computed column-wise, i.e. on contiguous memory
+  int reducedDimensions = dimensions - deadDimensions;
+  Eigen::MatrixXd inCoords = reducedCoordinates(*inMesh);
+  Eigen::MatrixXd outCoords = reducedCoordinates(*outMesh);
+
+  // Fill upper right part (due to symmetry) of matrixCLU with values
+  for (int j = 0; j < inputSize; j++) {
+    double* column = matrixCLU.col(j).data();
+    impl::computeDistances(reducedDimensions, inCoords.data(), j + 1, inCoords.col(j).data(), column);
+    evaluateAll(_basisFunction, column, j + 1);
+  }
+  for (int i = 0; i < inputSize; i++) {
     matrixCLU(i,inputSize) = 1.0;
-    for (int dim=0; dim < dimensions-deadDimensions; dim++) {
-      matrixCLU(i,inputSize+1+dim) = reduceVector(iVertex.getCoords())[dim];
+    for (int dim=0; dim < reducedDimensions; dim++) {
+      matrixCLU(i,inputSize+1+dim) = inCoords(dim,i);
     }
-    i++;
   }
   // Copy values of upper right part of C to lower left part
   for (int i = 0; i < n; i++) {
@@ -195,20 +206,16 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>:: computeMapping()
   }
 
   // Fill _matrixA with values
-  i = 0;
-  for (const mesh::Vertex& iVertex : outMesh->vertices()) {
-    int j = 0;
-    for (const mesh::Vertex& jVertex : inMesh->vertices()) {
-      difference = iVertex.getCoords();
-      difference -= jVertex.getCoords();
-      _matrixA(i,j) = _basisFunction.evaluate(reduceVector(difference).norm());
-      j++;
-    }
+  for (int j = 0; j < inputSize; j++) {
+    double* column = _matrixA.col(j).data();
+    impl::computeDistances(reducedDimensions, outCoords.data(), outputSize, inCoords.col(j).data(), column);
+    evaluateAll(_basisFunction, column, outputSize);
+  }
+  for (int i = 0; i < outputSize; i++) {
     _matrixA(i,inputSize) = 1.0;
-    for (int dim=0; dim < dimensions-deadDimensions; dim++) {
-      _matrixA(i,inputSize+1+dim) = reduceVector(iVertex.getCoords())[dim];
+    for (int dim=0; dim < reducedDimensions; dim++) {
+      _matrixA(i,inputSize+1+dim) = outCoords(dim,i);
     }
-    i++;
   }
 
 # ifdef PRECICE_STATISTICS
@@ -342,9 +349,9 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>:: map
 
 
 template<typename RADIAL_BASIS_FUNCTION_T>
-Eigen::VectorXd RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::reduceVector
+Eigen::MatrixXd RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::reducedCoordinates
 (
-  const Eigen::VectorXd& fullVector)
+  const mesh::Mesh& mesh) const
 {
   int deadDimensions = 0;
   for (int d = 0; d < getDimensions(); d++) {
@@ -352,15 +359,19 @@ Eigen::VectorXd RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::reduceVector
       deadDimensions +=1;
   }
   assertion(getDimensions()>deadDimensions, getDimensions(), deadDimensions);
-  Eigen::VectorXd reducedVector(getDimensions()-deadDimensions);
-  int k = 0;
-  for (int d = 0; d < getDimensions(); d++) {
-    if (not _deadAxis[d]) {
-      reducedVector[k] = fullVector[d];
-      k++;
+  Eigen::MatrixXd coords(getDimensions()-deadDimensions, mesh.vertices().size());
+  int i = 0;
+  for (const mesh::Vertex& vertex : mesh.vertices()) {
+    int k = 0;
+    for (int d = 0; d < getDimensions(); d++) {
+      if (not _deadAxis[d]) {
+        coords(k,i) = vertex.getCoords()[d];
+        k++;
+      }
     }
+    i++;
   }
-  return reducedVector;
+  return coords;
 }
 
 template<typename RADIAL_BASIS_FUNCTION_T>
@@ -0,0 +1,138 @@
+#include "mapping/Mapping.hpp"
+#include "mapping/SharedPointer.hpp"
+#include "mapping/NearestNeighborMapping.hpp"
+#include "mapping/NearestProjectionMapping.hpp"
+#include "mapping/RadialBasisFctMapping.hpp"
+#include "mapping/PetRadialBasisFctMapping.hpp"
+#include "mapping/impl/BasisFunctions.hpp"
+#include "mesh/Data.hpp"
+#include "mesh/Mesh.hpp"
+#include "testing/Benchmark.hpp"
+#include "testing/BenchmarkMeshes.hpp"
+
+#include <functional>
+#include <memory>
+
+using namespace precice;
+using precice::testing::BenchmarkState;
+
+namespace
+{
+
+using MappingFactory = std::function<mapping::PtrMapping()>;
+
+/// Mapping from a grid mesh to a shifted grid mesh of the same size
+struct MappingSetup
+{
+  mesh::PtrMesh inMesh;
+  mesh::PtrMesh outMesh;
+  int inDataID;
+  int outDataID;
+  mapping::PtrMapping mapping;
+};
+
+MappingSetup createSetup(const MappingFactory& factory, int vertices, bool withConnectivity)
+{
+  MappingSetup setup;
+  // Shifted by a fraction of the grid spacing and lifted, such that no mapping is trivial
+  double shift = 0.25 / std::sqrt(static_cast<double>(vertices));
+  setup.inMesh  = testing::createGridMesh("InMesh", vertices, withConnectivity);
+  setup.outMesh = testing::createGridMesh("OutMesh", vertices, false, shift, shift);
+  setup.inDataID  = setup.inMesh->createData("InData", 1)->getID();
+  setup.outDataID = setup.outMesh->createData("OutData", 1)->getID();
+  setup.inMesh->allocateDataValues();
+  setup.outMesh->allocateDataValues();
+
+  Eigen::VectorXd& values = setup.inMesh->data(setup.inDataID)->values();
+  for (int i = 0; i < values.size(); i++) {
+    values(i) = static_cast<double>(i % 97);
+  }
+
+  setup.mapping = factory();
+  setup.mapping->setMeshes(setup.inMesh, setup.outMesh);
+  return setup;
+}
+
+/// Measures computeMapping(), which includes building the search structures or interpolation system.
+void benchmarkSetup(BenchmarkState& state, const MappingFactory& factory, int vertices, bool withConnectivity)
+{
+  MappingSetup setup = createSetup(factory, vertices, withConnectivity);
+  while (state.keepRunning()) {
+    setup.mapping->computeMapping();
+    state.pauseTiming();
+    setup.mapping->clear();
+    state.resumeTiming();
+  }
+  state.setItemsProcessed(static_cast<double>(state.iterations()) * setup.outMesh->vertices().size());
+  state.setCounter("vertices", setup.outMesh->vertices().size());
+}
+
+/// Measures map() of scalar data with a precomputed mapping.
+void benchmarkApply(BenchmarkState& state, const MappingFactory& factory, int vertices, bool withConnectivity)
+{
+  MappingSetup setup = createSetup(factory, vertices, withConnectivity);
+  setup.mapping->computeMapping();
+  while (state.keepRunning()) {
+    setup.mapping->map(setup.inDataID, setup.outDataID);
+  }
+  state.setItemsProcessed(static_cast<double>(state.iterations()) * setup.outMesh->vertices().size());
+  state.setCounter("vertices", setup.outMesh->vertices().size());
+}
+
+/// Registers setup and apply cases for all sizes, iterations are scaled down with the size.
+void registerMapping(const std::string& name, const MappingFactory& factory, const std::vector<int>& sizes,
+                     long long setupIterations, long long applyIterations, bool withConnectivity = false)
+{
+  for (int vertices : sizes) {
+    long long scale = std::max(1, vertices / sizes.front());
+    testing::registerBenchmark(
+        "Mapping" + name + "Setup/" + std::to_string(vertices),
+        [=](BenchmarkState& state) { benchmarkSetup(state, factory, vertices, withConnectivity); },
+        std::max(1LL, setupIterations / scale));
+    testing::registerBenchmark(
+        "Mapping" + name + "Apply/" + std::to_string(vertices),
+        [=](BenchmarkState& state) { benchmarkApply(state, factory, vertices, withConnectivity); },
+        std::max(1LL, applyIterations / scale));
+  }
+}
+
+/// Support radius covering about five grid spacings of a mesh with the given number of vertices
+double supportRadius(int vertices)
+{
+  return 5.0 / std::sqrt(static_cast<double>(vertices));
+}
+
+bool registered = [] {
+  using mapping::Mapping;
+  const std::vector<int> large = {10000, 100000, 1000000};
+
+  registerMapping("NearestNeighbor", [] {
+      return mapping::PtrMapping(new mapping::NearestNeighborMapping(Mapping::CONSISTENT, 3));
+    }, large, 10, 100);
+
+  // The nearest projection mapping searches all elements of the input mesh for each output vertex,
+  // the setup takes minutes beyond a few thousand vertices.
+  registerMapping("NearestProjection", [] {
+      return mapping::PtrMapping(new mapping::NearestProjectionMapping(Mapping::CONSISTENT, 3));
+    }, {1000, 2000}, 5, 100, true);
+
+  // The serial RBF mapping solves a dense system, sizes beyond a few thousand vertices are infeasible.
+  const std::vector<int> dense = {1000, 4000};
+  registerMapping("RadialBasisFct", [] {
+      return mapping::PtrMapping(new mapping::RadialBasisFctMapping<mapping::ThinPlateSplines>(
+          Mapping::CONSISTENT, 3, mapping::ThinPlateSplines(), false, false, true));
+    }, dense, 3, 100);
+
+#ifndef PRECICE_NO_PETSC
+  for (int vertices : {10000, 100000}) {
+    registerMapping("PetRadialBasisFct", [vertices] {
+        return mapping::PtrMapping(new mapping::PetRadialBasisFctMapping<mapping::CompactPolynomialC0>(
+            Mapping::CONSISTENT, 3, mapping::CompactPolynomialC0(supportRadius(vertices)), false, false, true));
+      }, {vertices}, 3, 20);
+  }
+#endif
+
+  return true;
+}();
+
+} // namespace
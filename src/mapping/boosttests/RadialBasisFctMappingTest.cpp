@@ -243,6 +243,108 @@ BOOST_AUTO_TEST_CASE(DeadAxis3D)
   BOOST_TEST ( outData->values()[3] = 4.3 );
 }
 
+BOOST_AUTO_TEST_CASE(Distances)
+{
+  // Three points, stored consecutively with three coordinates each
+  double points[] = {0.0, 0.0, 0.0,
+                     3.0, 4.0, 12.0,
+                     -1.0, 2.0, -2.0};
+  double point[] = {0.0, 0.0, 0.0};
+  double distances[3];
+
+  // The same coordinates interpreted as nine 1D points
+  double distances1D[9];
+  impl::computeDistances<1>(points, 9, point, distances1D);
+  for (int i = 0; i < 9; i++) {
+    BOOST_TEST(distances1D[i] == std::abs(points[i]));
+  }
+
+  // The first six coordinates interpreted as three 2D points
+  impl::computeDistances<2>(points, 3, point, distances);
+  BOOST_TEST(distances[0] == 0.0);
+  BOOST_TEST(distances[1] == 3.0);
+  BOOST_TEST(distances[2] == std::sqrt(160.0));
+
+  impl::computeDistances<3>(points, 3, point, distances);
+  BOOST_TEST(distances[0] == 0.0);
+  BOOST_TEST(distances[1] == 13.0);
+  BOOST_TEST(distances[2] == 3.0);
+
+  // The runtime dispatch gives the same result, also for a point different from the origin
+  double otherPoint[] = {1.0, 1.0, 1.0};
+  for (int dimensions = 1; dimensions <= 3; dimensions++) {
+    impl::computeDistances(dimensions, points, 3, otherPoint, distances);
+    for (int i = 0; i < 3; i++) {
+      double sum = 0.0;
+      for (int d = 0; d < dimensions; d++) {
+        sum += (points[i * dimensions + d] - 1.0) * (points[i * dimensions + d] - 1.0);
+      }
+      BOOST_TEST(distances[i] == std::sqrt(sum));
+    }
+  }
+}
+
+/// Checks that evaluateAll() gives the same values as evaluate() for each distance
+template<typename RADIAL_BASIS_FUNCTION_T>
+void testEvaluateAll(const RADIAL_BASIS_FUNCTION_T& function)
+{
+  std::vector<double> distances {0.0, 0.1, 0.5, 0.99, 1.0, 1.5, 2.0, 10.0};
+  std::vector<double> values = distances;
+  evaluateAll(function, values.data(), values.size());
+  for (size_t i = 0; i < distances.size(); i++) {
+    BOOST_TEST(values[i] == function.evaluate(distances[i]));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(EvaluateAll)
+{
+  testEvaluateAll(ThinPlateSplines());
+  testEvaluateAll(Multiquadrics(1e-3));
+  testEvaluateAll(InverseMultiquadrics(1e-3));
+  testEvaluateAll(VolumeSplines());
+  testEvaluateAll(Gaussian(1.0));
+  testEvaluateAll(Gaussian(1.0, 1.2));
+  testEvaluateAll(CompactThinPlateSplinesC2(1.2));
+  testEvaluateAll(CompactPolynomialC0(1.2));
+  testEvaluateAll(CompactPolynomialC6(1.2));
+}
+
+BOOST_AUTO_TEST_CASE(ReducedCoordinates)
+{
+  int dimensions = 3;
+  ThinPlateSplines fct;
+  mesh::Mesh mesh("Mesh", dimensions, false);
+  mesh.createVertex(Eigen::Vector3d(1.0, 2.0, 3.0));
+  mesh.createVertex(Eigen::Vector3d(4.0, 5.0, 6.0));
+
+  RadialBasisFctMapping<ThinPlateSplines> noDeadAxis(Mapping::CONSISTENT, dimensions, fct, false, false, false);
+  Eigen::MatrixXd coords = noDeadAxis.reducedCoordinates(mesh);
+  BOOST_TEST(coords.rows() == 3);
+  BOOST_TEST(coords.cols() == 2);
+  BOOST_TEST(coords(0,0) == 1.0);
+  BOOST_TEST(coords(1,0) == 2.0);
+  BOOST_TEST(coords(2,0) == 3.0);
+  BOOST_TEST(coords(0,1) == 4.0);
+  BOOST_TEST(coords(1,1) == 5.0);
+  BOOST_TEST(coords(2,1) == 6.0);
+
+  RadialBasisFctMapping<ThinPlateSplines> yDead(Mapping::CONSISTENT, dimensions, fct, false, true, false);
+  coords = yDead.reducedCoordinates(mesh);
+  BOOST_TEST(coords.rows() == 2);
+  BOOST_TEST(coords.cols() == 2);
+  BOOST_TEST(coords(0,0) == 1.0);
+  BOOST_TEST(coords(1,0) == 3.0);
+  BOOST_TEST(coords(0,1) == 4.0);
+  BOOST_TEST(coords(1,1) == 6.0);
+
+  RadialBasisFctMapping<ThinPlateSplines> xzDead(Mapping::CONSISTENT, dimensions, fct, true, false, true);
+  coords = xzDead.reducedCoordinates(mesh);
+  BOOST_TEST(coords.rows() == 1);
+  BOOST_TEST(coords.cols() == 2);
+  BOOST_TEST(coords(0,0) == 2.0);
+  BOOST_TEST(coords(0,1) == 5.0);
+}
+
 void perform2DTestConsistentMapping(Mapping& mapping )
 {
   int dimensions = 2;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include "logging/Logger.hpp"
 #include "math/math.hpp"
 
@@ -27,7 +28,7 @@ public:
   {
     double result = 0.0;
     if (math::greater(radius, 0.0)){
-      result = std::log(radius) * std::pow(radius, 2);
+      result = std::log(radius) * radius * radius;
     }
     return result;
   }
@@ -55,7 +56,7 @@ public:
 
   double evaluate ( double radius ) const
   {
-    return std::sqrt(_cPow2 + std::pow(radius, 2));
+    return std::sqrt(_cPow2 + radius * radius);
   }
 
 private:
@@ -90,7 +91,7 @@ public:
 
   double evaluate ( double radius ) const
   {
-    return 1.0 / std::sqrt(_cPow2 + std::pow(radius, 2));
+    return 1.0 / std::sqrt(_cPow2 + radius * radius);
   }
 
 private:
@@ -158,8 +159,8 @@ public:
   {
     if (radius > _supportRadius)
       return 0;
-    else
-      return std::exp( - std::pow(_shape*radius,2.0) ) - _deltaY;
+    double scaledRadius = _shape * radius;
+    return std::exp( - scaledRadius * scaledRadius ) - _deltaY;
   }
 
 private:
@@ -209,10 +210,10 @@ public:
   {
     if (radius >= _r) return 0.0;
     double p = radius / _r;
-    using std::pow;
-    using std::log;
-    return 1.0 - 30.0*pow(p,2.0) - 10.0*pow(p,3.0) + 45.0*pow(p,4.0)
-      - 6.0*pow(p,5.0) - 60.0*log(pow(p,pow(p,3.0)));
+    double p2 = p * p;
+    double p3 = p2 * p;
+    return 1.0 - 30.0*p2 - 10.0*p3 + 45.0*p2*p2
+      - 6.0*p2*p3 - 60.0*std::log(std::pow(p,p3));
   }
 
 private:
@@ -252,7 +253,8 @@ public:
   double evaluate ( double radius ) const
   {
     if (radius >= _r) return 0.0;
-    return std::pow(1.0 - radius/_r, 2.0);
+    double q = 1.0 - radius/_r;
+    return q * q;
   }
 
 private:
@@ -293,8 +295,9 @@ public:
   {
     if (radius >= _r) return 0.0;
     double p = radius / _r;
-    using std::pow;
-    return pow(1.0-p,8.0) * (32.0*pow(p,3.0) + 25.0*pow(p,2.0) + 8.0*p + 1.0);
+    double q2 = (1.0 - p) * (1.0 - p);
+    double q4 = q2 * q2;
+    return q4 * q4 * (((32.0*p + 25.0)*p + 8.0)*p + 1.0);
   }
 
 private:
@@ -304,4 +307,20 @@ private:
   double _r;
 };
 
+/// Evaluates the basis function on all radii in values, in place.
+/**
+ * Used for assembling the interpolation matrices from contiguous rows or columns of radii. The
+ * evaluate() functions above are inlined into the loop, which lets the compiler vectorize the
+ * basis functions without transcendental functions.
+ */
+template<typename RADIAL_BASIS_FUNCTION_T>
+void evaluateAll(const RADIAL_BASIS_FUNCTION_T& function, double* values, size_t size)
+{
+  // A local copy keeps the parameters of the basis function in registers
+  const RADIAL_BASIS_FUNCTION_T localFunction = function;
+  for (size_t i = 0; i < size; i++) {
+    values[i] = localFunction.evaluate(values[i]);
+  }
+}
+
 }} // namespace precice, mapping
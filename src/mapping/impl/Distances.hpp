@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include "utils/assertion.hpp"
+
+namespace precice {
+namespace mapping {
+namespace impl {
+
+/// Computes the Euclidean distances of size points to one point, all of dimension DIM.
+/**
+ * The coordinates of the points are stored consecutively, i.e., point i starts at points[i * DIM].
+ * With the dimension known at compile time, the inner loop is unrolled and the outer loop can be
+ * vectorized.
+ */
+template<int DIM>
+void computeDistances(const double* points, size_t size, const double* point, double* distances)
+{
+  for (size_t i = 0; i < size; i++) {
+    double sum = 0.0;
+    for (int d = 0; d < DIM; d++) {
+      double difference = points[i * DIM + d] - point[d];
+      sum += difference * difference;
+    }
+    distances[i] = std::sqrt(sum);
+  }
+}
+
+/// Calls computeDistances() for the given dimension, which has to be 1, 2 or 3.
+inline void computeDistances(int dimensions, const double* points, size_t size, const double* point, double* distances)
+{
+  switch (dimensions) {
+  case 1:
+    computeDistances<1>(points, size, point, distances);
+    break;
+  case 2:
+    computeDistances<2>(points, size, point, distances);
+    break;
+  case 3:
+    computeDistances<3>(points, size, point, distances);
+    break;
+  default:
+    assertion(false, dimensions);
+  }
+}
+
+}}} // namespace precice, mapping, impl
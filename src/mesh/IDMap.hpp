@@ -0,0 +1,63 @@
+#pragma once
+
+#include <vector>
+#include "utils/assertion.hpp"
+
+namespace precice
+{
+namespace mesh
+{
+
+/// Maps IDs of mesh elements to pointers, e.g. from the elements of one mesh to their copies in another.
+/**
+ * Element IDs handed out by a mesh are dense, starting at 0. Hence, the pointers are stored in a
+ * vector indexed by ID, with nullptr for IDs that are not mapped.
+ */
+template <typename ELEMENT_T>
+class IDMap
+{
+public:
+  /// Reserves storage for the IDs up to count - 1.
+  void reserve(int count)
+  {
+    _elements.reserve(count);
+  }
+
+  /// Maps the given ID to element, replaces a previous mapping.
+  void insert(int id, ELEMENT_T *element)
+  {
+    assertion(id >= 0, id);
+    if (id >= static_cast<int>(_elements.size())) {
+      _elements.resize(id + 1, nullptr);
+    }
+    _elements[id] = element;
+  }
+
+  /// Returns the element mapped to the given ID, or nullptr if there is none.
+  ELEMENT_T *find(int id) const
+  {
+    if (id < 0 || id >= static_cast<int>(_elements.size())) {
+      return nullptr;
+    }
+    return _elements[id];
+  }
+
+  /// Returns true, if the given ID is mapped.
+  bool contains(int id) const
+  {
+    return find(id) != nullptr;
+  }
+
+  /// Returns the element mapped to the given ID, which has to exist.
+  ELEMENT_T &operator[](int id) const
+  {
+    assertion(contains(id), id);
+    return *_elements[id];
+  }
+
+private:
+  std::vector<ELEMENT_T *> _elements;
+};
+
+} // namespace mesh
+} // namespace precice
@@ -0,0 +1,121 @@
+#include "IndexRanges.hpp"
+
+#include <algorithm>
+#include "utils/assertion.hpp"
+
+namespace precice {
+namespace mesh {
+
+IndexRanges::IndexRanges(std::vector<int> indices)
+{
+  std::sort(indices.begin(), indices.end());
+  indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+  _size = indices.size();
+
+  for (std::size_t i = 0; i < indices.size(); i++) {
+    if (i == 0 || indices[i] != indices[i - 1] + 1) {
+      _values.push_back(indices[i]);
+      _values.push_back(indices[i] + 1);
+    }
+    else {
+      _values.back() = indices[i] + 1;
+    }
+    if (_values.size() > indices.size()) {
+      // Too fragmented, the plain list is smaller
+      _values     = std::move(indices);
+      _compressed = false;
+      return;
+    }
+  }
+}
+
+std::size_t IndexRanges::size() const
+{
+  return _size;
+}
+
+bool IndexRanges::empty() const
+{
+  return _size == 0;
+}
+
+bool IndexRanges::isCompressed() const
+{
+  return _compressed;
+}
+
+int IndexRanges::min() const
+{
+  assertion(not empty());
+  return _values.front();
+}
+
+int IndexRanges::max() const
+{
+  assertion(not empty());
+  return _compressed ? _values.back() - 1 : _values.back();
+}
+
+bool IndexRanges::contains(int index) const
+{
+  if (empty() || index < min() || index > max()) {
+    return false;
+  }
+  if (not _compressed) {
+    return std::binary_search(_values.begin(), _values.end(), index);
+  }
+  // The first range boundary greater than index is a past-the-end index, if index lies in a range
+  auto boundary = std::upper_bound(_values.begin(), _values.end(), index);
+  return (boundary - _values.begin()) % 2 == 1;
+}
+
+bool IndexRanges::overlaps(const IndexRanges& other) const
+{
+  if (empty() || other.empty()) {
+    return false;
+  }
+  return min() <= other.max() && other.min() <= max();
+}
+
+std::vector<int> IndexRanges::toVector() const
+{
+  if (not _compressed) {
+    return _values;
+  }
+  std::vector<int> indices;
+  indices.reserve(_size);
+  for (std::size_t i = 0; i < _values.size(); i += 2) {
+    for (int index = _values[i]; index < _values[i + 1]; index++) {
+      indices.push_back(index);
+    }
+  }
+  return indices;
+}
+
+std::vector<int> IndexRanges::serialize() const
+{
+  std::vector<int> serialized;
+  serialized.reserve(_values.size() + 1);
+  serialized.push_back(_compressed ? 1 : 0);
+  serialized.insert(serialized.end(), _values.begin(), _values.end());
+  return serialized;
+}
+
+IndexRanges IndexRanges::deserialize(const std::vector<int>& serialized)
+{
+  assertion(not serialized.empty());
+  IndexRanges ranges;
+  ranges._compressed = serialized[0] == 1;
+  ranges._values.assign(serialized.begin() + 1, serialized.end());
+  if (ranges._compressed) {
+    for (std::size_t i = 0; i < ranges._values.size(); i += 2) {
+      ranges._size += ranges._values[i + 1] - ranges._values[i];
+    }
+  }
+  else {
+    ranges._size = ranges._values.size();
+  }
+  return ranges;
+}
+
+}} // namespace precice, mesh
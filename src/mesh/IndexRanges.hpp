@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace precice {
+namespace mesh {
+
+/// Set of global vertex indices, compressed to sorted, disjoint ranges.
+/**
+ * Vertex distributions created by a ProvidedPartition consist of one contiguous range per rank,
+ * such that a rank's indices can be stored and communicated in constant size. Distributions
+ * created by a ReceivedPartition can be fragmented arbitrarily. If the ranges would need more
+ * memory than the indices themselves, the set falls back to a sorted list of the indices.
+ *
+ * The order of the indices is not preserved, only membership is.
+ */
+class IndexRanges
+{
+public:
+  /// Creates an empty set
+  IndexRanges() = default;
+
+  /// Creates the set of the given indices, which may be unsorted and contain duplicates
+  explicit IndexRanges(std::vector<int> indices);
+
+  /// Returns the number of indices in the set
+  std::size_t size() const;
+
+  bool empty() const;
+
+  /// Returns true, if the indices are stored as ranges rather than as list
+  bool isCompressed() const;
+
+  /// Returns the smallest index, the set must not be empty
+  int min() const;
+
+  /// Returns the largest index, the set must not be empty
+  int max() const;
+
+  /// Returns true, if the index is contained, in logarithmic time
+  bool contains(int index) const;
+
+  /// Returns true, if the closed interval [min(), max()] of both sets overlaps
+  bool overlaps(const IndexRanges& other) const;
+
+  /// Returns all indices in ascending order
+  std::vector<int> toVector() const;
+
+  /// Returns the compact representation for communication
+  /**
+   * The first entry is 1 for ranges and 0 for a list, followed by the begin and past-the-end
+   * index of each range or by the list of indices, respectively.
+   */
+  std::vector<int> serialize() const;
+
+  /// Restores a set from the representation created by serialize()
+  static IndexRanges deserialize(const std::vector<int>& serialized);
+
+private:
+  /// Begin and past-the-end index of each range, if compressed, otherwise the sorted indices
+  std::vector<int> _values;
+
+  bool _compressed = true;
+
+  std::size_t _size = 0;
+};
+
+}} // namespace precice, mesh
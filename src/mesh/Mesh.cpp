@@ -2,10 +2,12 @@
 #include "Edge.hpp"
 #include "Triangle.hpp"
 #include "Quad.hpp"
+#include "IDMap.hpp"
 #include "PropertyContainer.hpp"
 #include "com/Communication.hpp"
 #include "utils/Globals.hpp"
 #include "utils/EigenHelperFunctions.hpp"
+#include "utils/Threads.hpp"
 #include "math/math.hpp"
 #include <Eigen/Dense>
 #include "RTree.hpp"
@@ -15,6 +17,9 @@ namespace mesh {
 
 logging::Logger Mesh:: _log("mesh::Mesh");
 
+/// Minimal number of mesh elements per thread in computeState().
+static const size_t GRAIN_SIZE = 1024;
+
 std::unique_ptr<utils::ManageUniqueIDs> Mesh::_managerPropertyIDs;
 
 void Mesh:: resetGeometryIDsGlobally()
@@ -53,17 +58,12 @@ Mesh:: Mesh
   _nameIDPairs[_name] = _managerPropertyIDs->getFreeID ();
   setProperty(INDEX_GEOMETRY_ID, _nameIDPairs[_name]);
 
-  meshChanged.connect(&rtree::clear);
   meshDestroyed.connect(&rtree::clear);
 }
 
 Mesh:: ~Mesh()
 {
-  _content.quads().deleteElements();
-  _content.triangles().deleteElements();
-  _content.edges().deleteElements();
-  _content.vertices().deleteElements();
-
+  _propertyContainers.deleteElements();
   meshDestroyed(*this);
 }
 
@@ -132,7 +132,7 @@ Edge& Mesh:: createEdge
   Vertex& vertexOne,
   Vertex& vertexTwo )
 {
-  Edge* newEdge = new Edge(vertexOne, vertexTwo, _manageEdgeIDs.getFreeID());
+  Edge* newEdge = _edgePool.create(vertexOne, vertexTwo, _manageEdgeIDs.getFreeID());
   newEdge->addParent(*this);
   _content.add(newEdge);
   return *newEdge;
@@ -144,7 +144,7 @@ Triangle& Mesh:: createTriangle
   Edge& edgeTwo,
   Edge& edgeThree )
 {
-  Triangle* newTriangle = new Triangle (
+  Triangle* newTriangle = _trianglePool.create(
       edgeOne, edgeTwo, edgeThree, _manageTriangleIDs.getFreeID());
   newTriangle->addParent(*this);
   _content.add(newTriangle);
@@ -158,7 +158,7 @@ Quad& Mesh:: createQuad
   Edge& edgeThree,
   Edge& edgeFour )
 {
-  Quad* newQuad = new Quad (
+  Quad* newQuad = _quadPool.create(
       edgeOne, edgeTwo, edgeThree, edgeFour, _manageQuadIDs.getFreeID());
   newQuad->addParent(*this);
   _content.add(newQuad);
@@ -308,18 +308,24 @@ void Mesh:: computeState()
     computeNormals = false;
   }
 
+  // The centers, radii and normals of the elements are computed concurrently. The area-weighted
+  // normals of the elements are accumulated afterwards by the calling thread, in element order,
+  // such that the vertex and edge normals do not depend on the number of threads.
+  auto& edges = _content.edges();
+  auto& triangles = _content.triangles();
+  auto& quads = _content.quads();
+
   // Compute edge centers, enclosing radius, and (in 2D) edge normals
-  Eigen::VectorXd center(_dimensions);
-  Eigen::VectorXd distanceToCenter(_dimensions);
-  for (Edge& edge : _content.edges()) {
-    center = edge.vertex(0).getCoords();
+  bool computeEdgeNormals = _dimensions == 2 && computeNormals;
+  Eigen::MatrixXd edgeWeightedNormals(_dimensions, computeEdgeNormals ? edges.size() : 0);
+  utils::parallelFor(0, edges.size(), GRAIN_SIZE, [&](size_t i) {
+    Edge& edge = edges[i];
+    Eigen::VectorXd center = edge.vertex(0).getCoords();
     center += edge.vertex(1).getCoords();
     center *= 0.5;
     edge.setCenter(center);
-    distanceToCenter = edge.vertex(0).getCoords();
-    distanceToCenter -= edge.getCenter();
-    edge.setEnclosingRadius(distanceToCenter.norm());
-    if (_dimensions == 2 && computeNormals){
+    edge.setEnclosingRadius((edge.vertex(0).getCoords() - edge.getCenter()).norm());
+    if (computeEdgeNormals){
       // Compute normal
       Eigen::VectorXd vectorA = edge.vertex(1).getCoords();
       vectorA -= edge.vertex(0).getCoords();
@@ -331,20 +337,25 @@ void Mesh:: computeState()
       assertion(math::greater(length, 0.0));
       normal /= length;   // Scale normal vector to length 1
       edge.setNormal(normal);
-
-      // Accumulate normal in associated vertices
-      normal *= edge.getEnclosingRadius() * 2.0; // Weight by length
-      for (int i=0; i < 2; i++){
-        Eigen::VectorXd vertexNormal = edge.vertex(i).getNormal();
-        vertexNormal += normal;
-        edge.vertex(i).setNormal(vertexNormal);
+      edgeWeightedNormals.col(i) = normal * edge.getEnclosingRadius() * 2.0; // Weight by length
+    }
+  });
+
+  // Accumulate normal in associated vertices
+  if (computeEdgeNormals){
+    for (size_t i = 0; i < edges.size(); i++) {
+      for (int j=0; j < 2; j++){
+        Vertex& vertex = edges[i].vertex(j);
+        vertex.setNormal(vertex.getNormal() + edgeWeightedNormals.col(i));
       }
     }
   }
 
   if (_dimensions == 3){
     // Compute triangle centers, radius, and normals
-    for (Triangle& triangle : _content.triangles()) {
+    Eigen::Matrix3Xd triangleNormals(3, computeNormals ? triangles.size() : 0);
+    utils::parallelFor(0, triangles.size(), GRAIN_SIZE, [&](size_t i) {
+      Triangle& triangle = triangles[i];
       assertion(not math::equals(triangle.vertex(0).getCoords(), triangle.vertex(1).getCoords()),
                 triangle.vertex(0).getCoords(),
                 triangle.getID());
@@ -356,7 +367,7 @@ void Mesh:: computeState()
 
       // Compute barycenter by using edge centers, since vertex order is not
       // guaranteed.
-      auto center = triangle.edge(0).getCenter();
+      Eigen::Vector3d center = triangle.edge(0).getCenter();
       center += triangle.edge(1).getCenter();
       center += triangle.edge(2).getCenter();
       center /= 3.0;
@@ -370,9 +381,6 @@ void Mesh:: computeState()
       toCenter = triangle.getCenter() - triangle.vertex(2).getCoords();
       double distance2 = toCenter.norm();
       double maxDistance = std::max( {distance0, distance1, distance2} );
-      // maxDistance = distance1 > maxDistance ? distance1 : maxDistance;
-      // maxDistance = distance2 > maxDistance ? distance2 : maxDistance;
-      
       triangle.setEnclosingRadius(maxDistance);
 
       // Compute normals
@@ -380,26 +388,24 @@ void Mesh:: computeState()
         Eigen::Vector3d vectorA = triangle.edge(1).getCenter() - triangle.edge(0).getCenter(); // edge() is faster than vertex()
         Eigen::Vector3d vectorB = triangle.edge(2).getCenter() - triangle.edge(0).getCenter();
         // Compute cross-product of vector A and vector B
-        auto normal = vectorA.cross(vectorB);
+        Eigen::Vector3d normal = vectorA.cross(vectorB);
         if ( _flipNormals ){
           normal *= -1.0; // Invert direction if counterclockwise
         }
-
-        // Accumulate area-weighted normal in associated vertices and edges
-        for (int i=0; i < 3; i++){
-          triangle.edge(i).setNormal(triangle.edge(i).getNormal() + normal);
-          triangle.vertex(i).setNormal(triangle.vertex(i).getNormal() + normal);
-        }
+        // Area-weighted normal, accumulated below
+        triangleNormals.col(i) = normal;
 
         // Normalize triangle normal
         double length = normal.norm();
         normal /= length;
         triangle.setNormal(normal);
       }
-    }
+    });
 
     // Compute quad centers, radius, and normals
-    for (Quad& quad : _content.quads()) {
+    Eigen::Matrix3Xd quadNormals(3, computeNormals ? quads.size() : 0);
+    utils::parallelFor(0, quads.size(), GRAIN_SIZE, [&](size_t i) {
+      Quad& quad = quads[i];
       assertion(not math::equals(quad.vertex(0).getCoords(), quad.vertex(1).getCoords()),
                 quad.vertex(0).getCoords(),
                 quad.getID());
@@ -432,12 +438,8 @@ void Mesh:: computeState()
       toCenter = quad.getCenter() - quad.vertex(3).getCoords();
       double distance3 = toCenter.norm();
       double maxDistance = std::max( {distance0, distance1, distance2, distance3} );
-      // maxDistance = distance1 > maxDistance ? distance1 : maxDistance;
-      // maxDistance = distance2 > maxDistance ? distance2 : maxDistance;
-      // maxDistance = distance3 > maxDistance ? distance3 : maxDistance;
       quad.setEnclosingRadius(maxDistance);
 
-
       // Compute normals (assuming all vertices are on same plane)
       if (computeNormals){
         // Two triangles are thought by splitting the quad from vertex 0 to 2.
@@ -450,12 +452,12 @@ void Mesh:: computeState()
         Eigen::Vector3d vectorA = quad.vertex(2).getCoords() - quad.vertex(1).getCoords();
         Eigen::Vector3d vectorB = quad.vertex(0).getCoords() - quad.vertex(1).getCoords();
         // Compute cross-product of vector A and vector B
-        auto normal = vectorA.cross(vectorB);
-        
+        Eigen::Vector3d normal = vectorA.cross(vectorB);
+
         vectorA = quad.vertex(0).getCoords() - quad.vertex(3).getCoords();
         vectorB = quad.vertex(2).getCoords() - quad.vertex(3).getCoords();
-        auto normalSecondPart = vectorA.cross(vectorB);
-        
+        Eigen::Vector3d normalSecondPart = vectorA.cross(vectorB);
+
         assertion(math::equals(normal.normalized(), normalSecondPart.normalized()),
                   normal, normalSecondPart);
         normal += normalSecondPart;
@@ -464,47 +466,61 @@ void Mesh:: computeState()
         if ( _flipNormals ){
           normal *= -1.0; // Invert direction if counterclockwise
         }
-
-        // Accumulate area-weighted normal in associated vertices and edges
-        for (int i=0; i < 4; i++){
-          quad.edge(i).setNormal(quad.edge(i).getNormal() + normal);
-          quad.vertex(i).setNormal(quad.vertex(i).getNormal() + normal);
-        }
+        // Area-weighted normal, accumulated below
+        quadNormals.col(i) = normal;
 
         // Normalize quad normal
-        // double length = normal.norm();
-        // normal /= length;
         normal = normal.normalized();
         quad.setNormal(normal);
       }
-    }
+    });
 
-    // Normalize edge normals (only done in 3D)
     if (computeNormals){
-      for (Edge& edge : _content.edges()) {
+      // Accumulate area-weighted normals in associated vertices and edges
+      for (size_t i = 0; i < triangles.size(); i++) {
+        Triangle& triangle = triangles[i];
+        for (int j=0; j < 3; j++){
+          triangle.edge(j).setNormal(triangle.edge(j).getNormal() + triangleNormals.col(i));
+          triangle.vertex(j).setNormal(triangle.vertex(j).getNormal() + triangleNormals.col(i));
+        }
+      }
+      for (size_t i = 0; i < quads.size(); i++) {
+        Quad& quad = quads[i];
+        for (int j=0; j < 4; j++){
+          quad.edge(j).setNormal(quad.edge(j).getNormal() + quadNormals.col(i));
+          quad.vertex(j).setNormal(quad.vertex(j).getNormal() + quadNormals.col(i));
+        }
+      }
+
+      // Normalize edge normals (only done in 3D)
+      utils::parallelFor(0, edges.size(), GRAIN_SIZE, [&](size_t i) {
+        Edge& edge = edges[i];
         double length = edge.getNormal().norm();
         // there can be cases when an edge has no adjacent triangle though triangles exist in general (e.g. after filtering)
         if(math::greater(length,0.0)){
           edge.setNormal(edge.getNormal() / length);
         }
-      }
+      });
     }
   }
 
   // Normalize vertex normals & compute bounding box
-  _boundingBox = BoundingBox (_dimensions,
-                              std::make_pair(std::numeric_limits<double>::max(),
-                                             std::numeric_limits<double>::lowest()));
-
-  for (Vertex& vertex : _content.vertices()) {
-    if (computeNormals) {
+  auto& vertices = _content.vertices();
+  if (computeNormals) {
+    utils::parallelFor(0, vertices.size(), GRAIN_SIZE, [&](size_t i) {
+      Vertex& vertex = vertices[i];
       double length = vertex.getNormal().norm();
       // there can be cases when a vertex has no edge though edges exist in general (e.g. after filtering)
       if(math::greater(length,0.0)){
         vertex.setNormal(vertex.getNormal() / length);
       }
-    }
-    
+    });
+  }
+
+  _boundingBox = BoundingBox (_dimensions,
+                              std::make_pair(std::numeric_limits<double>::max(),
+                                             std::numeric_limits<double>::lowest()));
+  for (const Vertex& vertex : vertices) {
     for (int d = 0; d < _dimensions; d++) {
       _boundingBox[d].first  = std::min(vertex.getCoords()[d], _boundingBox[d].first);
       _boundingBox[d].second = std::max(vertex.getCoords()[d], _boundingBox[d].second);
@@ -515,14 +531,17 @@ void Mesh:: computeState()
     
 void Mesh:: clear()
 {
-  _content.triangles().deleteElements();
-  _content.edges().deleteElements();
-  _content.vertices().deleteElements();
+  // Keeps the memory of the pools for rebuilding the mesh
+  _quadPool.clear();
+  _trianglePool.clear();
+  _edgePool.clear();
+  _vertexPool.clear();
   _propertyContainers.deleteElements();
 
   _content.clear();
   _propertyContainers.clear();
 
+  _manageQuadIDs.resetIDs();
   _manageTriangleIDs.resetIDs();
   _manageEdgeIDs.resetIDs();
   _manageVertexIDs.resetIDs();
@@ -541,8 +560,14 @@ void Mesh:: addMesh(
   TRACE();
   assertion(_dimensions==deltaMesh.getDimensions());
 
-  std::map<int, Vertex*> vertexMap;
-  std::map<int, Edge*> edgeMap;
+  IDMap<Vertex> vertexMap;
+  IDMap<Edge> edgeMap;
+  vertexMap.reserve(deltaMesh.vertices().size());
+  edgeMap.reserve(deltaMesh.edges().size());
+
+  _manageVertexIDs.reserveCapacity(deltaMesh.vertices().size());
+  _manageEdgeIDs.reserveCapacity(deltaMesh.edges().size());
+  _manageTriangleIDs.reserveCapacity(deltaMesh.triangles().size());
 
   Eigen::VectorXd coords(_dimensions);
   for ( const Vertex& vertex : deltaMesh.vertices() ){
@@ -552,7 +577,7 @@ void Mesh:: addMesh(
     if(vertex.isTagged()) v.tag();
     v.setOwner(vertex.isOwner());
     assertion ( vertex.getID() >= 0, vertex.getID() );
-    vertexMap[vertex.getID()] = &v;
+    vertexMap.insert(vertex.getID(), &v);
   }
 
   // you cannot just take the vertices from the edge and add them,
@@ -561,10 +586,8 @@ void Mesh:: addMesh(
   for (const Edge& edge : deltaMesh.edges()) {
     int vertexIndex1 = edge.vertex(0).getID();
     int vertexIndex2 = edge.vertex(1).getID();
-    assertion ( vertexMap.find(vertexIndex1) != vertexMap.end() );
-    assertion ( vertexMap.find(vertexIndex2) != vertexMap.end() );
-    Edge& e = createEdge(*vertexMap[vertexIndex1], *vertexMap[vertexIndex2]);
-    edgeMap[edge.getID()] = &e;
+    Edge& e = createEdge(vertexMap[vertexIndex1], vertexMap[vertexIndex2]);
+    edgeMap.insert(edge.getID(), &e);
   }
 
   if(_dimensions==3){
@@ -572,16 +595,13 @@ void Mesh:: addMesh(
       int edgeIndex1 = triangle.edge(0).getID();
       int edgeIndex2 = triangle.edge(1).getID();
       int edgeIndex3 = triangle.edge(2).getID();
-      assertion ( edgeMap.find(edgeIndex1) != edgeMap.end() );
-      assertion ( edgeMap.find(edgeIndex2) != edgeMap.end() );
-      assertion ( edgeMap.find(edgeIndex3) != edgeMap.end() );
-      createTriangle(*edgeMap[edgeIndex1],*edgeMap[edgeIndex2],*edgeMap[edgeIndex3]);
+      createTriangle(edgeMap[edgeIndex1],edgeMap[edgeIndex2],edgeMap[edgeIndex3]);
     }
   }
   meshChanged(*this);
 }
 
-const Mesh::BoundingBox Mesh::getBoundingBox() const
+const Mesh::BoundingBox& Mesh::getBoundingBox() const
 {
   return _boundingBox;
 }
@@ -6,6 +6,7 @@
 #include "mesh/Vertex.hpp"
 #include "utils/PointerVector.hpp"
 #include "utils/ManageUniqueIDs.hpp"
+#include "utils/ObjectPool.hpp"
 #include <boost/noncopyable.hpp>
 #include <map>
 #include <list>
@@ -125,7 +126,7 @@ public:
   Vertex& createVertex ( const VECTOR_T& coords )
   {
     assertion(coords.size() == _dimensions, coords.size(), _dimensions);
-    Vertex* newVertex = new Vertex(coords, _manageVertexIDs.getFreeID(), *this);
+    Vertex* newVertex = _vertexPool.create(coords, _manageVertexIDs.getFreeID(), *this);
     newVertex->addParent(*this);
     _content.add(newVertex);
     return *newVertex;
@@ -227,6 +228,9 @@ public:
    * normalization of the vertex normals.
    *
    * Circumcircles of edges and triangles are computed.
+   *
+   * The elements are processed by the threads of utils::parallelFor(), the results do not
+   * depend on the number of threads.
    */
   void computeState();
 
@@ -270,7 +274,7 @@ public:
    * BoundingBox is a vector of pairs (min, max), one pair for each dimension.
    * computeState() has to be called after setting the mesh.
    */
-  const BoundingBox getBoundingBox() const;
+  const BoundingBox& getBoundingBox() const;
 
   /**
    * @brief Returns the Center Of Gravity of the mesh
@@ -303,6 +307,15 @@ private:
   /// Holds vertices, edges, and triangles.
   Group _content;
 
+  /// Own the vertices, edges, triangles and quads of the mesh, see clear().
+  utils::ObjectPool<Vertex> _vertexPool;
+
+  utils::ObjectPool<Edge> _edgePool;
+
+  utils::ObjectPool<Triangle> _trianglePool;
+
+  utils::ObjectPool<Quad> _quadPool;
+
   /// All property containers created by the mesh.
   PropertyContainerContainer _propertyContainers;
 
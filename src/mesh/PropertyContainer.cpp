@@ -13,30 +13,54 @@ logging::Logger PropertyContainer::_log("precice::mesh::PropertyContainer");
 utils::ManageUniqueIDs *PropertyContainer::_manageUniqueIDs = nullptr;
 
 PropertyContainer::PropertyContainer()
-    : _properties(),
-      _parents()
+    : _parent(nullptr),
+      _storage()
 {
 }
 
+PropertyContainer::PropertyContainer(const PropertyContainer &other)
+    : _parent(other._parent),
+      _storage(other._storage ? new Storage(*other._storage) : nullptr)
+{
+}
+
+PropertyContainer &PropertyContainer::operator=(const PropertyContainer &other)
+{
+  if (this != &other) {
+    _parent = other._parent;
+    _storage.reset(other._storage ? new Storage(*other._storage) : nullptr);
+  }
+  return *this;
+}
+
 const PropertyContainer &PropertyContainer::getParent(size_t index) const
 {
-  return *_parents.at(index);
+  if (index == 0 && _parent != nullptr) {
+    return *_parent;
+  }
+  assertion(_storage && index > 0, index);
+  return *_storage->parents.at(index - 1);
 }
 
 bool PropertyContainer::deleteProperty(int propertyID)
 {
-  if (_properties.count(propertyID) > 0) {
-    _properties.erase(propertyID);
-    return true;
+  if (_storage) {
+    auto &properties = _storage->properties;
+    for (auto iter = properties.begin(); iter != properties.end(); iter++) {
+      if (iter->first == propertyID) {
+        properties.erase(iter);
+        return true;
+      }
+    }
   }
   return false;
 }
 
 bool PropertyContainer::hasProperty(int propertyID) const
 {
-  if (_properties.find(propertyID) == _properties.end()) {
-    for (const auto &elem : _parents) {
-      if (elem->hasProperty(propertyID)) {
+  if (findProperty(propertyID) == nullptr) {
+    for (int i = 0; i < getParentCount(); i++) {
+      if (getParent(i).hasProperty(propertyID)) {
         return true;
       }
     }
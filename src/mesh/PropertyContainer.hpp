@@ -2,7 +2,8 @@
 
 #include "utils/assertion.hpp"
 #include <boost/any.hpp>
-#include <map>
+#include <memory>
+#include <utility>
 #include <vector>
 
 namespace precice
@@ -28,12 +29,20 @@ namespace mesh
  * are created and deleted dynamically. Hierarchical behavior is introduced by
  * parent pointers to higher level PropertyContainers. There can be multiple
  * parents.
+ *
+ * Mesh elements usually have no own properties and a single parent, their mesh. Hence, the first
+ * parent is stored inline and the properties and further parents are only allocated when needed.
+ * An element without own properties thereby costs two pointers and no heap allocation.
  */
 class PropertyContainer
 {
 public:
   PropertyContainer();
 
+  PropertyContainer(const PropertyContainer &other);
+
+  PropertyContainer &operator=(const PropertyContainer &other);
+
   virtual ~PropertyContainer(){};
 
   // Shortform for the type of a property.
@@ -56,13 +65,20 @@ public:
   /// Enables hierarchical property behavior.
   void addParent(PropertyContainer &parent)
   {
-    _parents.push_back(&parent);
+    if (_parent == nullptr) {
+      _parent = &parent;
+    } else {
+      storage().parents.push_back(&parent);
+    }
   }
 
   /// Returns the number of parents.
   int getParentCount() const
   {
-    return (int) _parents.size();
+    if (_parent == nullptr) {
+      return 0;
+    }
+    return 1 + (_storage ? (int) _storage->parents.size() : 0);
   }
 
   /// Returns the parent corresponding to the given index (0 ... count).
@@ -77,7 +93,12 @@ public:
   template <typename value_t>
   void setProperty(int propertyID, const value_t &value)
   {
-    _properties[propertyID] = value;
+    PropertyType *property = findProperty(propertyID);
+    if (property == nullptr) {
+      storage().properties.emplace_back(propertyID, value);
+    } else {
+      *property = value;
+    }
   }
 
   /**
@@ -116,16 +137,50 @@ public:
   void getProperties(int propertyID, std::vector<value_t> &properties);
 
 private:
+  /// Properties and all parents but the first, allocated on first use.
+  struct Storage {
+    /// Properties (local for every instance), few per instance, hence searched linearly
+    std::vector<std::pair<int, PropertyType>> properties;
+
+    /// Parents added after the first one
+    std::vector<PropertyContainer *> parents;
+  };
+
   static logging::Logger _log;
 
   /// Manager to ensure unique identification of all properties.
   static utils::ManageUniqueIDs *_manageUniqueIDs;
 
-  /// Properties (local for every instance)
-  std::map<int, PropertyType> _properties;
+  /// First parent, must be set if hierarchical properties are wanted
+  PropertyContainer *_parent = nullptr;
+
+  std::unique_ptr<Storage> _storage;
 
-  /// Must be set, if hierarchical properties are wanted
-  std::vector<PropertyContainer *> _parents;
+  Storage &storage()
+  {
+    if (not _storage) {
+      _storage.reset(new Storage());
+    }
+    return *_storage;
+  }
+
+  /// Returns the own property with given ID, or nullptr if it is not set.
+  const PropertyType *findProperty(int propertyID) const
+  {
+    if (_storage) {
+      for (const auto &property : _storage->properties) {
+        if (property.first == propertyID) {
+          return &property.second;
+        }
+      }
+    }
+    return nullptr;
+  }
+
+  PropertyType *findProperty(int propertyID)
+  {
+    return const_cast<PropertyType *>(static_cast<const PropertyContainer *>(this)->findProperty(propertyID));
+  }
 };
 
 // --------------------------------------------------------- HEADER DEFINITIONS
@@ -133,35 +188,37 @@ private:
 template <typename value_t>
 const value_t &PropertyContainer::getProperty(int propertyID) const
 {
-  std::map<int, PropertyType>::const_iterator iter;
-  iter = _properties.find(propertyID);
-  if (iter == _properties.end()) {
-    for (const auto &prop : _parents) {
-      if (prop->hasProperty(propertyID)) {
-        return prop->getProperty<value_t>(propertyID);
+  const PropertyType *property = findProperty(propertyID);
+  if (property == nullptr) {
+    for (int i = 0; i < getParentCount(); i++) {
+      const PropertyContainer &parent = getParent(i);
+      if (parent.hasProperty(propertyID)) {
+        return parent.getProperty<value_t>(propertyID);
       }
     }
     ERROR("No property with id = " << propertyID);
   }
-  assertion(not iter->second.empty());
+  assertion(not property->empty());
   // When the type of value_t does not match that of the any, NULL is returned.
-  assertion(boost::any_cast<value_t>(&iter->second) != NULL);
-  return *boost::any_cast<value_t>(&iter->second);
+  assertion(boost::any_cast<value_t>(property) != NULL);
+  return *boost::any_cast<value_t>(property);
 }
 
 template <typename value_t>
 void PropertyContainer::getProperties(int propertyID, std::vector<value_t> &properties)
 {
-  std::map<int, PropertyType>::const_iterator iter;
-  iter = _properties.find(propertyID);
-  if (iter != _properties.end()) {
-    assertion(not iter->second.empty());
+  const PropertyType *property = findProperty(propertyID);
+  if (property != nullptr) {
+    assertion(not property->empty());
     // When the type of value_t does not match that of the any, NULL is returned.
-    assertion(boost::any_cast<value_t>(&iter->second) != NULL);
-    properties.push_back(boost::any_cast<value_t>(iter->second));
-  } else {
-    for (size_t i = 0; i < _parents.size(); i++) {
-      _parents[i]->getProperties(propertyID, properties);
+    assertion(boost::any_cast<value_t>(property) != NULL);
+    properties.push_back(*boost::any_cast<value_t>(property));
+  } else if (_parent != nullptr) {
+    _parent->getProperties(propertyID, properties);
+    if (_storage) {
+      for (PropertyContainer *parent : _storage->parents) {
+        parent->getProperties(propertyID, properties);
+      }
     }
   }
 }
@@ -1,27 +1,34 @@
 #include "RTree.hpp"
+#include <boost/iterator/counting_iterator.hpp>
 
 namespace precice {
 namespace mesh {
 
 // Initialize static member
-std::map<int, rtree::PtrRTree> precice::mesh::rtree::trees;
+std::map<int, rtree::CachedTree> precice::mesh::rtree::trees;
+
+namespace {
+
+rtree::Point toPoint(const Vertex & vertex)
+{
+  namespace bg = boost::geometry;
+  return rtree::Point(bg::get<0>(vertex), bg::get<1>(vertex), bg::get<2>(vertex));
+}
+
+} // namespace
 
 rtree::PtrRTree rtree::getVertexRTree(PtrMesh mesh)
 {
-  RTreeParameters params;
-  VertexIndexGetter ind(mesh->vertices());
-    
-  auto result = trees.emplace(std::piecewise_construct,
-                              std::forward_as_tuple(mesh->getID()),
-                              std::forward_as_tuple(std::make_shared<VertexRTree>(params, ind)));
-    
-  PtrRTree tree = std::get<0>(result)->second;
-    
+  auto result = trees.emplace(mesh->getID(), CachedTree());
+  CachedTree & cached = std::get<0>(result)->second;
+
   if (std::get<1>(result)) // insertion took place, fill tree
-    for (size_t i = 0; i < mesh->vertices().size(); ++i)
-      tree->insert(i);
-    
-  return tree;
+    build(cached, *mesh);
+  // Vertices may be created or moved without a signal of the mesh, hence the positions are always compared
+  else
+    update(cached, *mesh);
+
+  return cached.tree;
 }
 
 
@@ -31,6 +38,57 @@ void rtree::clear(Mesh & mesh)
 }
 
 
+void rtree::build(CachedTree & cached, const Mesh & mesh)
+{
+  cached.points = std::make_shared<std::vector<Point>>();
+  cached.points->reserve(mesh.vertices().size());
+  for (const Vertex & vertex : mesh.vertices())
+    cached.points->push_back(toPoint(vertex));
+
+  // The range constructor packs the tree, which is faster and gives a better tree than inserting one by one
+  boost::counting_iterator<size_t> first(0), last(cached.points->size());
+  cached.tree = std::make_shared<VertexRTree>(first, last, RTreeParameters(), VertexIndexGetter(cached.points));
+}
+
+
+void rtree::update(CachedTree & cached, const Mesh & mesh)
+{
+  namespace bg = boost::geometry;
+  std::vector<Point> & points = *cached.points;
+  size_t oldSize = points.size();
+  size_t newSize = mesh.vertices().size();
+  size_t commonSize = std::min(oldSize, newSize);
+
+  std::vector<size_t> moved;
+  for (size_t i = 0; i < commonSize; ++i) {
+    if (not bg::equals(points[i], toPoint(mesh.vertices()[i])))
+      moved.push_back(i);
+  }
+
+  // Updating a large part of the tree is more expensive than building it anew
+  size_t changes = moved.size() + std::max(oldSize, newSize) - commonSize;
+  if (changes > newSize / 4) {
+    // The tree holds its own reference to the old positions, other owners of it are not affected
+    build(cached, mesh);
+    return;
+  }
+
+  // The tree locates a vertex by its stored position, hence it is removed before the position is updated
+  for (size_t i = newSize; i < oldSize; ++i)
+    cached.tree->remove(i);
+  points.resize(newSize);
+  for (size_t i : moved) {
+    cached.tree->remove(i);
+    points[i] = toPoint(mesh.vertices()[i]);
+    cached.tree->insert(i);
+  }
+  for (size_t i = oldSize; i < newSize; ++i) {
+    points[i] = toPoint(mesh.vertices()[i]);
+    cached.tree->insert(i);
+  }
+}
+
+
 Box3d getEnclosingBox(Vertex const & middlePoint, double sphereRadius)
 {
   namespace bg = boost::geometry;
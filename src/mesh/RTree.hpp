@@ -1,6 +1,8 @@
 #pragma once
 
 #include <map>
+#include <memory>
+#include <vector>
 #include "mesh/impl/RTreeAdapter.hpp"
 #include "mesh/Mesh.hpp"
 #include <boost/geometry.hpp>
@@ -10,6 +12,7 @@
 namespace MeshTests {
 namespace RTree {
 struct CacheClearing;
+struct IncrementalUpdate;
 }}
 
 
@@ -18,7 +21,9 @@ namespace mesh {
 
 class rtree {
 public:
-  using VertexIndexGetter = impl::PtrVectorIndexable<Mesh::VertexContainer>;
+  /// Position of a vertex as stored in the tree
+  using Point             = boost::geometry::model::point<double, 3, boost::geometry::cs::cartesian>;
+  using VertexIndexGetter = impl::SharedVectorIndexable<std::vector<Point>>;
   using RTreeParameters   = boost::geometry::index::rstar<16>;
   using VertexRTree       = boost::geometry::index::rtree<Mesh::VertexContainer::container::size_type,
                                                           RTreeParameters,
@@ -28,6 +33,9 @@ public:
   /// Returns the pointer to boost::geometry::rtree for the given mesh
   /*
    * Creates and fills the tree, if it wasn't requested before, otherwise it returns the cached tree.
+   * The cached tree is compared with the vertices of the mesh and updated first: vertices that moved
+   * are reinserted, new vertices are inserted and removed vertices are removed. If most vertices
+   * changed, the tree is rebuilt by bulk loading instead.
    */
   static PtrRTree getVertexRTree(PtrMesh mesh);
   
@@ -35,9 +43,23 @@ public:
   static void clear(Mesh & mesh);
 
   friend struct MeshTests::RTree::CacheClearing;
+  friend struct MeshTests::RTree::IncrementalUpdate;
   
 private:
-  static std::map<int, PtrRTree> trees;
+  /// Tree of a mesh together with the vertex positions it was built from
+  struct CachedTree {
+    PtrRTree tree;
+    /// Positions of the vertices in the tree, indexed by vertex index
+    std::shared_ptr<std::vector<Point>> points;
+  };
+
+  static std::map<int, CachedTree> trees;
+
+  /// Fills the tree of the cache entry with all vertices of the mesh by bulk loading
+  static void build(CachedTree & cached, const Mesh & mesh);
+
+  /// Updates the tree of the cache entry to the vertices of the mesh
+  static void update(CachedTree & cached, const Mesh & mesh);
 };
 
 
@@ -0,0 +1,56 @@
+#include "mesh/Mesh.hpp"
+#include "testing/Benchmark.hpp"
+#include "testing/BenchmarkMeshes.hpp"
+
+using namespace precice;
+using precice::testing::BenchmarkState;
+
+namespace
+{
+
+/// Builds a triangulated grid mesh from scratch, i.e. vertices, edges and triangles with their IDs.
+void benchmarkBuildMesh(BenchmarkState& state, int vertices)
+{
+  int elements = 0;
+  while (state.keepRunning()) {
+    mesh::PtrMesh mesh = testing::createGridMesh("Mesh", vertices, true);
+    state.pauseTiming();
+    elements = mesh->vertices().size() + mesh->edges().size() + mesh->triangles().size();
+    mesh.reset();
+    state.resumeTiming();
+  }
+  state.setItemsProcessed(static_cast<double>(state.iterations()) * elements);
+  state.setCounter("elements", elements);
+}
+
+/// Merges a triangulated grid mesh into an empty mesh, as done when gathering partitions.
+void benchmarkAddMesh(BenchmarkState& state, int vertices)
+{
+  mesh::PtrMesh deltaMesh = testing::createGridMesh("Delta", vertices, true);
+  mesh::Mesh    mesh("Mesh", 3, false);
+  while (state.keepRunning()) {
+    mesh.addMesh(*deltaMesh);
+    state.pauseTiming();
+    mesh.clear();
+    state.resumeTiming();
+  }
+  int elements = deltaMesh->vertices().size() + deltaMesh->edges().size() + deltaMesh->triangles().size();
+  state.setItemsProcessed(static_cast<double>(state.iterations()) * elements);
+  state.setCounter("elements", elements);
+}
+
+bool registered = [] {
+  for (int vertices : {10000, 100000, 1000000}) {
+    testing::registerBenchmark(
+        "BuildMesh/" + std::to_string(vertices),
+        [vertices](BenchmarkState& state) { benchmarkBuildMesh(state, vertices); },
+        std::max(1, 1000000 / vertices));
+    testing::registerBenchmark(
+        "AddMesh/" + std::to_string(vertices),
+        [vertices](BenchmarkState& state) { benchmarkAddMesh(state, vertices); },
+        std::max(1, 1000000 / vertices));
+  }
+  return true;
+}();
+
+} // namespace
@@ -0,0 +1,30 @@
+#include "testing/Testing.hpp"
+#include "mesh/IDMap.hpp"
+
+using namespace precice::mesh;
+
+BOOST_AUTO_TEST_SUITE(MeshTests)
+BOOST_AUTO_TEST_SUITE(IDMapTests)
+
+BOOST_AUTO_TEST_CASE(InsertAndFind)
+{
+  int values[3] = {10, 11, 12};
+  IDMap<int> map;
+  map.reserve(2);
+  BOOST_TEST(not map.contains(0));
+  BOOST_TEST(map.find(-1) == nullptr);
+
+  map.insert(0, &values[0]);
+  map.insert(5, &values[1]);
+  BOOST_TEST(map.contains(0));
+  BOOST_TEST(not map.contains(1));
+  BOOST_TEST(map.find(4) == nullptr);
+  BOOST_TEST(map[5] == 11);
+  BOOST_TEST(map.find(6) == nullptr);
+
+  map.insert(5, &values[2]);
+  BOOST_TEST(map[5] == 12);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // IDMapTests
+BOOST_AUTO_TEST_SUITE_END() // Mesh
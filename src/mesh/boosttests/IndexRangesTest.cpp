@@ -0,0 +1,70 @@
+#include "mesh/IndexRanges.hpp"
+#include "testing/Testing.hpp"
+
+using namespace precice::mesh;
+
+BOOST_AUTO_TEST_SUITE(MeshTests)
+
+BOOST_AUTO_TEST_SUITE(IndexRangesTests)
+
+BOOST_AUTO_TEST_CASE(Contiguous)
+{
+  IndexRanges ranges({5, 3, 4, 6, 4, 10, 11});
+  BOOST_TEST(ranges.isCompressed());
+  BOOST_TEST(ranges.size() == 6);
+  BOOST_TEST(ranges.min() == 3);
+  BOOST_TEST(ranges.max() == 11);
+  BOOST_TEST(not ranges.contains(2));
+  BOOST_TEST(ranges.contains(3));
+  BOOST_TEST(ranges.contains(6));
+  BOOST_TEST(not ranges.contains(7));
+  BOOST_TEST(not ranges.contains(9));
+  BOOST_TEST(ranges.contains(10));
+  BOOST_TEST(ranges.contains(11));
+  BOOST_TEST(not ranges.contains(12));
+
+  std::vector<int> expected {3, 4, 5, 6, 10, 11};
+  BOOST_TEST(ranges.toVector() == expected, boost::test_tools::per_element());
+
+  // Two ranges are stored as four values plus the flag
+  BOOST_TEST(ranges.serialize().size() == 5);
+  IndexRanges restored = IndexRanges::deserialize(ranges.serialize());
+  BOOST_TEST(restored.isCompressed());
+  BOOST_TEST(restored.size() == 6);
+  BOOST_TEST(restored.toVector() == expected, boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(Fragmented)
+{
+  IndexRanges ranges({7, 1, 3, 5});
+  BOOST_TEST(not ranges.isCompressed());
+  BOOST_TEST(ranges.size() == 4);
+  BOOST_TEST(ranges.min() == 1);
+  BOOST_TEST(ranges.max() == 7);
+  BOOST_TEST(ranges.contains(5));
+  BOOST_TEST(not ranges.contains(4));
+
+  IndexRanges restored = IndexRanges::deserialize(ranges.serialize());
+  BOOST_TEST(not restored.isCompressed());
+  std::vector<int> expected {1, 3, 5, 7};
+  BOOST_TEST(restored.toVector() == expected, boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(Overlaps)
+{
+  IndexRanges empty;
+  IndexRanges low({0, 1, 2});
+  IndexRanges high({2, 3});
+  IndexRanges higher({5});
+  BOOST_TEST(empty.empty());
+  BOOST_TEST(not empty.contains(0));
+  BOOST_TEST(not empty.overlaps(low));
+  BOOST_TEST(low.overlaps(high));
+  BOOST_TEST(high.overlaps(low));
+  BOOST_TEST(not low.overlaps(higher));
+  BOOST_TEST(IndexRanges::deserialize(empty.serialize()).empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // IndexRanges
+
+BOOST_AUTO_TEST_SUITE_END() // Mesh
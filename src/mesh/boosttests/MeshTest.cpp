@@ -7,8 +7,10 @@
 #include "mesh/Data.hpp"
 #include "utils/Parallel.hpp"
 #include "utils/MasterSlave.hpp"
+#include "utils/Threads.hpp"
 #include "com/MPIDirectCommunication.hpp"
 #include <Eigen/Core>
+#include <cmath>
 #include "testing/Testing.hpp"
 
 using namespace precice;
@@ -273,6 +275,51 @@ BOOST_AUTO_TEST_CASE(BoundingBoxCOG_3D)
 }
 
 
+BOOST_AUTO_TEST_CASE(ComputeStateThreadCount)
+{
+  // Curved surface with more elements than computeState processes per thread
+  auto computeWavyMesh = [](int threads) {
+    utils::setThreadCount(threads);
+    const int n = 64;
+    PtrMesh mesh(new Mesh("WavyMesh", 3, false));
+    std::vector<Vertex*> vertices;
+    for (int j = 0; j < n; j++) {
+      for (int i = 0; i < n; i++) {
+        double x = 0.1 * i, y = 0.1 * j;
+        vertices.push_back(&mesh->createVertex(Vector3d(x, y, std::sin(x) * std::cos(y))));
+      }
+    }
+    auto vertex = [&](int i, int j) -> Vertex& { return *vertices[j * n + i]; };
+    for (int j = 0; j < n - 1; j++) {
+      for (int i = 0; i < n - 1; i++) {
+        Edge& bottom   = mesh->createEdge(vertex(i, j), vertex(i + 1, j));
+        Edge& left     = mesh->createEdge(vertex(i, j), vertex(i, j + 1));
+        Edge& right    = mesh->createEdge(vertex(i + 1, j), vertex(i + 1, j + 1));
+        Edge& top      = mesh->createEdge(vertex(i, j + 1), vertex(i + 1, j + 1));
+        Edge& diagonal = mesh->createEdge(vertex(i + 1, j), vertex(i, j + 1));
+        mesh->createTriangle(bottom, diagonal, left);
+        mesh->createTriangle(right, top, diagonal);
+      }
+    }
+    mesh->computeState();
+    utils::setThreadCount(0);
+    return mesh;
+  };
+
+  PtrMesh serial   = computeWavyMesh(1);
+  PtrMesh parallel = computeWavyMesh(4);
+
+  BOOST_TEST_REQUIRE(serial->vertices().size() == parallel->vertices().size());
+  for (size_t i = 0; i < serial->vertices().size(); i++) {
+    BOOST_TEST((serial->vertices()[i].getNormal() == parallel->vertices()[i].getNormal()));
+  }
+  for (size_t i = 0; i < serial->triangles().size(); i++) {
+    BOOST_TEST((serial->triangles()[i].getNormal() == parallel->triangles()[i].getNormal()));
+  }
+  BOOST_TEST((serial->getBoundingBox() == parallel->getBoundingBox()));
+}
+
+
 BOOST_AUTO_TEST_CASE(Demonstration)
 {
   for ( int dim=2; dim <= 3; dim++ ){
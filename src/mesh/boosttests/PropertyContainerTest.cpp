@@ -75,6 +75,25 @@ BOOST_AUTO_TEST_CASE(MultipleParents)
   BOOST_TEST( properties.size() == 2 );
   BOOST_TEST( properties[0] == 0 );
   BOOST_TEST( properties[1] == 1 );
+
+  BOOST_TEST( child.getParentCount() == 2 );
+  BOOST_TEST( &child.getParent(0) == &parent0 );
+  BOOST_TEST( &child.getParent(1) == &parent1 );
+}
+
+BOOST_AUTO_TEST_CASE(MultipleProperties)
+{
+  PropertyContainer propertyContainer;
+  propertyContainer.setProperty(0, 1);
+  propertyContainer.setProperty(1, 2.0);
+  propertyContainer.setProperty(0, 3);
+  BOOST_TEST( propertyContainer.getProperty<int>(0) == 3 );
+  BOOST_TEST( propertyContainer.getProperty<double>(1) == 2.0 );
+
+  BOOST_CHECK( propertyContainer.deleteProperty(0) );
+  BOOST_CHECK( not propertyContainer.deleteProperty(0) );
+  BOOST_CHECK( not propertyContainer.hasProperty(0) );
+  BOOST_TEST( propertyContainer.getProperty<double>(1) == 2.0 );
 }
 
 BOOST_AUTO_TEST_SUITE_END() // PropertyContainerTEst
@@ -148,16 +148,59 @@ BOOST_AUTO_TEST_CASE(CacheClearing)
   
   auto tree1 = rtree::getVertexRTree(mesh);
   BOOST_TEST(rtree::trees.size() == 1);
-  mesh->meshChanged(*mesh); // Emit signal, that mesh has changed
-  BOOST_TEST(rtree::trees.size() == 0);
+  mesh->meshChanged(*mesh); // Emit signal, that mesh has changed, the tree is kept
+  BOOST_TEST(rtree::trees.size() == 1);
   
   auto tree2 = rtree::getVertexRTree(mesh);
   BOOST_TEST(rtree::trees.size() == 1);
+  BOOST_TEST(tree2 == tree1);
   mesh.reset(); // Destroy mesh object, signal is emitted to clear cache
   BOOST_TEST(rtree::trees.size() == 0);
   
 }
 
 
+BOOST_AUTO_TEST_CASE(IncrementalUpdate)
+{
+  PtrMesh mesh(new precice::mesh::Mesh("MyMesh", 2, false));
+  for (int i = 0; i < 10; i++) {
+    mesh->createVertex(Eigen::Vector2d(i, 0));
+  }
+  auto tree = rtree::getVertexRTree(mesh);
+  BOOST_TEST(tree->size() == 10);
+
+  // Moving a single vertex updates the cached tree in place, also without a signal of the mesh
+  mesh->vertices()[3].setCoords(Eigen::Vector2d(3, 5));
+  BOOST_TEST(rtree::getVertexRTree(mesh) == tree);
+  BOOST_TEST(tree->size() == 10);
+  BOOST_TEST(bg::equals(rtree::trees.at(mesh->getID()).points->at(3), rtree::Point(3, 5, 0)));
+
+  Eigen::VectorXd searchVector(Eigen::Vector2d(3, 4.9));
+  std::vector<size_t> results;
+  tree->query(bgi::nearest(searchVector, 1), std::back_inserter(results));
+  BOOST_TEST(results.size() == 1);
+  BOOST_TEST(results[0] == 3);
+
+  // Resetting the mesh with the same vertices keeps the tree
+  mesh->clear();
+  for (int i = 0; i < 10; i++) {
+    mesh->createVertex(Eigen::Vector2d(i, i == 3 ? 5 : 0));
+  }
+  BOOST_TEST(rtree::getVertexRTree(mesh) == tree);
+
+  // Moving most vertices rebuilds the tree
+  for (auto& vertex : mesh->vertices()) {
+    vertex.setCoords(vertex.getCoords() + Eigen::Vector2d(0, 1));
+  }
+  auto rebuilt = rtree::getVertexRTree(mesh);
+  BOOST_TEST(rebuilt != tree);
+  BOOST_TEST(rebuilt->size() == 10);
+  results.clear();
+  searchVector = Eigen::Vector2d(0, 1);
+  rebuilt->query(bgi::nearest(searchVector, 1), std::back_inserter(results));
+  BOOST_TEST(results.size() == 1);
+  BOOST_TEST(results[0] == 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // RTree
 BOOST_AUTO_TEST_SUITE_END() // Mesh
@@ -2,6 +2,7 @@
 
 #include <boost/geometry.hpp>
 #include <Eigen/Core>
+#include <memory>
 #include "mesh/Vertex.hpp"
 
 using precice::mesh::Vertex;
@@ -70,23 +71,26 @@ namespace precice {
 namespace mesh {
 namespace impl {
 
-/// Makes a utils::PtrVector indexable and thus be usable in boost::geometry::rtree
+/// Makes the indices of a shared std::vector indexable and thus be usable in boost::geometry::rtree
+/*
+ * The vector is shared, such that it outlives the tree and can be modified together with the tree.
+ */
 template <typename Container>
-class PtrVectorIndexable
+class SharedVectorIndexable
 {
-  using size_type = typename Container::container::size_type;
+  using size_type = typename Container::size_type;
   using cref = const typename Container::value_type&;
-  Container const& container;
+  std::shared_ptr<const Container> container;
 
 public:
   using result_type = cref;
 
-  explicit PtrVectorIndexable(Container const& c) : container(c)
+  explicit SharedVectorIndexable(std::shared_ptr<const Container> c) : container(std::move(c))
   {}
 
   result_type operator()(size_type i) const
   {
-    return container[i];
+    return (*container)[i];
   }
 };
 
@@ -1,4 +1,6 @@
 #include "partition/Partition.hpp"
+#include "com/CommunicateMesh.hpp"
+#include "m2n/M2N.hpp"
 #include "mesh/Mesh.hpp"
 #include "utils/Globals.hpp"
 #include "com/Communication.hpp"
@@ -42,5 +44,102 @@ void Partition:: computeVertexOffsets(){
   }
 }
 
+std::vector<mesh::Mesh::BoundingBox> Partition:: exchangeBoundingBoxes
+(
+  const mesh::Mesh::BoundingBox& localBB,
+  bool                           sendFirst)
+{
+  TRACE(sendFirst);
+  int dimensions = _mesh->getDimensions();
+  assertion((int) localBB.size() == dimensions);
+
+  // Gather local bounding boxes at the master, as min and max per dimension
+  std::vector<double> localBBs;
+  int size = 1;
+  if (utils::MasterSlave::_slaveMode) {
+    com::CommunicateMesh(utils::MasterSlave::_communication).sendBoundingBox(localBB, 0);
+  }
+  else {
+    if (utils::MasterSlave::_masterMode) {
+      size = utils::MasterSlave::_size;
+    }
+    localBBs.reserve(size * 2 * dimensions);
+    mesh::Mesh::BoundingBox bb = localBB;
+    for (int rank = 0; rank < size; rank++) {
+      if (rank > 0) {
+        com::CommunicateMesh(utils::MasterSlave::_communication).receiveBoundingBox(bb, rank);
+      }
+      for (int d = 0; d < dimensions; d++) {
+        localBBs.push_back(bb[d].first);
+        localBBs.push_back(bb[d].second);
+      }
+    }
+  }
+
+  // Exchange with the remote master
+  int remoteSize = -1;
+  std::vector<double> remoteBBs;
+  if (not utils::MasterSlave::_slaveMode) {
+    com::PtrCommunication communication = _m2n->getMasterCommunication();
+    auto sendLocal = [&] {
+      communication->send(size, 0);
+      communication->send(localBBs.data(), localBBs.size(), 0);
+    };
+    auto receiveRemote = [&] {
+      communication->receive(remoteSize, 0);
+      remoteBBs.resize(remoteSize * 2 * dimensions);
+      communication->receive(remoteBBs.data(), remoteBBs.size(), 0);
+    };
+    if (sendFirst) {
+      sendLocal();
+      receiveRemote();
+    }
+    else {
+      receiveRemote();
+      sendLocal();
+    }
+  }
+
+  // Broadcast the remote bounding boxes to all slaves
+  if (utils::MasterSlave::_slaveMode) {
+    utils::MasterSlave::_communication->broadcast(remoteSize, 0);
+    remoteBBs.resize(remoteSize * 2 * dimensions);
+  }
+  else if (utils::MasterSlave::_masterMode) {
+    utils::MasterSlave::_communication->broadcast(remoteSize);
+  }
+  utils::MasterSlave::broadcast(remoteBBs.data(), remoteBBs.size());
+  assertion(remoteSize > 0, remoteSize);
+
+  std::vector<mesh::Mesh::BoundingBox> result(remoteSize, mesh::Mesh::BoundingBox(dimensions));
+  for (int rank = 0; rank < remoteSize; rank++) {
+    for (int d = 0; d < dimensions; d++) {
+      result[rank][d].first  = remoteBBs[(rank * dimensions + d) * 2];
+      result[rank][d].second = remoteBBs[(rank * dimensions + d) * 2 + 1];
+    }
+  }
+  return result;
+}
+
+std::set<int> Partition:: overlappingRanks
+(
+  const mesh::Mesh::BoundingBox&              localBB,
+  const std::vector<mesh::Mesh::BoundingBox>& remoteBBs) const
+{
+  std::set<int> ranks;
+  for (size_t rank = 0; rank < remoteBBs.size(); rank++) {
+    bool overlapping = true;
+    for (size_t d = 0; d < localBB.size(); d++) {
+      if (localBB[d].first > remoteBBs[rank][d].second || remoteBBs[rank][d].first > localBB[d].second) {
+        overlapping = false;
+        break;
+      }
+    }
+    if (overlapping) {
+      ranks.insert(rank);
+    }
+  }
+  return ranks;
+}
 
 }}
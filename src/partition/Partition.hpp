@@ -4,6 +4,9 @@
 #include "mapping/SharedPointer.hpp"
 #include "mesh/SharedPointer.hpp"
 #include "m2n/SharedPointer.hpp"
+#include "mesh/Mesh.hpp"
+#include <set>
+#include <vector>
 
 
 // ----------------------------------------------------------- CLASS DEFINITION
@@ -69,6 +72,21 @@ protected:
   /// Generate vertex offsets from the vertexDistribution, broadcast it to all slaves
   void computeVertexOffsets();
 
+  /**
+   * @brief Exchanges the bounding boxes of all ranks with the remote participant.
+   *
+   * The local bounding boxes are gathered at the master and exchanged with the remote master,
+   * the remote ones are broadcast to all slaves. A serial participant counts as a single rank.
+   * One participant has to send first, the other one has to receive first.
+   *
+   * @return The bounding boxes of all remote ranks, indexed by rank.
+   */
+  std::vector<mesh::Mesh::BoundingBox> exchangeBoundingBoxes(const mesh::Mesh::BoundingBox& localBB, bool sendFirst);
+
+  /// Returns the ranks of the remote participant whose bounding box overlaps the given one.
+  std::set<int> overlappingRanks(const mesh::Mesh::BoundingBox& localBB,
+                                 const std::vector<mesh::Mesh::BoundingBox>& remoteBBs) const;
+
 private:
 
   static logging::Logger _log;
@@ -15,10 +15,12 @@ logging::Logger ProvidedPartition:: _log ( "precice::partition::ProvidedPartitio
 ProvidedPartition::ProvidedPartition
 (
     mesh::PtrMesh mesh,
-    bool hasToSend)
+    bool hasToSend,
+    bool sendDistributed)
 :
     Partition (mesh),
-    _hasToSend(hasToSend)
+    _hasToSend(hasToSend),
+    _sendDistributed(sendDistributed)
 {}
 
 void ProvidedPartition::communicate()
@@ -27,7 +29,10 @@ void ProvidedPartition::communicate()
 
   //TODO communication to more than one participant
 
-  if(_hasToSend){
+  if(_hasToSend && _sendDistributed){
+    communicateDistributed();
+  }
+  else if(_hasToSend){
     Event e1("gather mesh");
 
     // Temporary globalMesh such that the master also keeps his local mesh
@@ -77,6 +82,53 @@ void ProvidedPartition::communicate()
   } //_hasToSend
 }
 
+void ProvidedPartition::communicateDistributed()
+{
+  TRACE();
+  INFO("Send mesh " << _mesh->getName() << " in a distributed way");
+  Event e("send mesh partitions");
+
+  // Set global indices as compute() does, i.e. numbered consecutively by rank
+  int numberOfVertices = _mesh->vertices().size();
+  int globalOffset = 0;
+  int globalNumberOfVertices = numberOfVertices;
+  if (utils::MasterSlave::_slaveMode) {
+    utils::MasterSlave::_communication->send(numberOfVertices,0);
+    utils::MasterSlave::_communication->receive(globalOffset,0);
+  }
+  else if (utils::MasterSlave::_masterMode) {
+    for (int rankSlave = 1; rankSlave < utils::MasterSlave::_size; rankSlave++){
+      int numberOfSlaveVertices = -1;
+      utils::MasterSlave::_communication->receive(numberOfSlaveVertices,rankSlave);
+      utils::MasterSlave::_communication->send(globalNumberOfVertices,rankSlave);
+      globalNumberOfVertices += numberOfSlaveVertices;
+    }
+  }
+  for (int i=0; i<numberOfVertices; i++){
+    _mesh->vertices()[i].setGlobalIndex(globalOffset+i);
+  }
+
+  if (not utils::MasterSlave::_slaveMode) {
+    CHECK(globalNumberOfVertices > 0, "The provided mesh " << _mesh->getName() << " is invalid (possibly empty).");
+    _m2n->getMasterCommunication()->send(globalNumberOfVertices, 0);
+  }
+
+  // The bounding box of the local mesh is computed before the partitions are communicated
+  std::vector<mesh::Mesh::BoundingBox> remoteBBs = exchangeBoundingBoxes(_mesh->getBoundingBox(), true);
+  std::set<int> remoteRanks = overlappingRanks(_mesh->getBoundingBox(), remoteBBs);
+  DEBUG("Send local mesh to " << remoteRanks.size() << " remote ranks");
+
+  // Connections are sorted by remote rank and the remote ranks receive sorted by rank, which
+  // avoids cyclic waits
+  auto connections = _m2n->connectRanks(_mesh->getID(), remoteRanks);
+  for (const auto& connection : connections) {
+    com::CommunicateMesh(connection.communication).sendMesh(*_mesh, connection.communicationRank);
+  }
+  for (const auto& connection : connections) {
+    connection.communication->closeConnection();
+  }
+}
+
 void ProvidedPartition::compute()
 {
   TRACE();
@@ -13,13 +13,17 @@ namespace partition {
  * The participant already provides a partition by calling setMeshVertices etc.
  * If required the mesh needs to be sent to another participant.
  * Furthermore, distribution data structures need to be set up.
+ *
+ * If the receiving participant filters in a distributed way, each rank sends its part
+ * of the mesh directly to the remote ranks whose bounding boxes overlap its own one. Else,
+ * the mesh is gathered at the master and sent to the remote master.
  */
 class ProvidedPartition : public Partition
 {
 public:
 
    /// Constructor
-   ProvidedPartition (mesh::PtrMesh mesh, bool hasToSend);
+   ProvidedPartition (mesh::PtrMesh mesh, bool hasToSend, bool sendDistributed = false);
 
    virtual ~ProvidedPartition() {}
 
@@ -33,10 +37,15 @@ private:
 
    virtual void createOwnerInformation();
 
+   /// Sends the local part of the mesh to all overlapping remote ranks, no rank holds the global mesh.
+   void communicateDistributed();
+
    static logging::Logger _log;
 
    bool _hasToSend;
 
+   bool _sendDistributed;
+
 };
 
 }} // namespace precice, partition
@@ -8,11 +8,15 @@
 #include "mesh/Mesh.hpp"
 #include "mesh/Vertex.hpp"
 #include "mesh/Edge.hpp"
+#include "mesh/IDMap.hpp"
 #include "mesh/Triangle.hpp"
 #include "utils/Helpers.hpp"
 #include "utils/Globals.hpp"
 #include "utils/MasterSlave.hpp"
 
+#include <algorithm>
+#include <map>
+
 
 using precice::utils::Event;
 
@@ -35,6 +39,10 @@ ReceivedPartition::ReceivedPartition
 void ReceivedPartition::communicate()
 {
   TRACE();
+  if (_geometricFilter == DISTRIBUTED) {
+    communicateDistributed();
+    return;
+  }
   INFO("Receive global mesh " << _mesh->getName());
   Event e("receive global mesh");
   if (not utils::MasterSlave::_slaveMode) {
@@ -43,6 +51,49 @@ void ReceivedPartition::communicate()
   }
 }
 
+void ReceivedPartition::communicateDistributed()
+{
+  TRACE();
+  INFO("Receive mesh " << _mesh->getName() << " in a distributed way");
+  Event e("receive mesh partitions");
+  assertion(_mesh->vertices().size() == 0);
+
+  int globalNumberOfVertices = -1;
+  if (not utils::MasterSlave::_slaveMode) {
+    _m2n->getMasterCommunication()->receive(globalNumberOfVertices, 0);
+  }
+  if (utils::MasterSlave::_slaveMode) {
+    utils::MasterSlave::_communication->broadcast(globalNumberOfVertices, 0);
+  }
+  else if (utils::MasterSlave::_masterMode) {
+    utils::MasterSlave::_communication->broadcast(globalNumberOfVertices);
+  }
+  assertion(globalNumberOfVertices != -1);
+  _mesh->setGlobalNumberOfVertices(globalNumberOfVertices);
+
+  if (utils::MasterSlave::_slaveMode || utils::MasterSlave::_masterMode) {
+    prepareBoundingBox();
+  }
+  else {
+    // A serial participant is not re-partitioned and needs the complete mesh
+    _bb.assign(_dimensions, std::make_pair(std::numeric_limits<double>::lowest(), std::numeric_limits<double>::max()));
+  }
+
+  std::vector<mesh::Mesh::BoundingBox> remoteBBs = exchangeBoundingBoxes(_bb, false);
+  std::set<int> remoteRanks = overlappingRanks(_bb, remoteBBs);
+  DEBUG("Receive mesh parts from " << remoteRanks.size() << " remote ranks");
+
+  // Receive sorted by remote rank, as the remote ranks send sorted by rank
+  auto connections = _m2n->connectRanks(_mesh->getID(), remoteRanks);
+  for (const auto& connection : connections) {
+    com::CommunicateMesh(connection.communication).receiveMesh(*_mesh, connection.communicationRank);
+  }
+  for (const auto& connection : connections) {
+    connection.communication->closeConnection();
+  }
+  DEBUG("Received " << _mesh->vertices().size() << " vertices");
+}
+
 void ReceivedPartition::compute()
 {
   TRACE(_geometricFilter);
@@ -57,8 +108,8 @@ void ReceivedPartition::compute()
     return;
   }
 
-  // (0) set global number of vertices before filtering
-  if (utils::MasterSlave::_masterMode) {
+  // (0) set global number of vertices before filtering, in the distributed case already received
+  if (utils::MasterSlave::_masterMode && _geometricFilter != DISTRIBUTED) {
     _mesh->setGlobalNumberOfVertices(_mesh->vertices().size());
   }
 
@@ -125,21 +176,23 @@ void ReceivedPartition::compute()
     }
   }
   else {
-    INFO("Broadcast mesh " << _mesh->getName() );
-    Event e1("broadcast mesh");
+    if(_geometricFilter != DISTRIBUTED){ // in the distributed case, each rank already received its part
+      INFO("Broadcast mesh " << _mesh->getName() );
+      Event e1("broadcast mesh");
 
-    if (utils::MasterSlave::_slaveMode) {
-      com::CommunicateMesh(utils::MasterSlave::_communication).broadcastReceiveMesh (*_mesh);
-    }
-    else{ // Master
-      assertion(utils::MasterSlave::_rank==0);
-      assertion(utils::MasterSlave::_size>1);
-      com::CommunicateMesh(utils::MasterSlave::_communication).broadcastSendMesh (*_mesh);
-    }
+      if (utils::MasterSlave::_slaveMode) {
+        com::CommunicateMesh(utils::MasterSlave::_communication).broadcastReceiveMesh (*_mesh);
+      }
+      else{ // Master
+        assertion(utils::MasterSlave::_rank==0);
+        assertion(utils::MasterSlave::_size>1);
+        com::CommunicateMesh(utils::MasterSlave::_communication).broadcastSendMesh (*_mesh);
+      }
 
-    e1.stop();
+      e1.stop();
+    }
 
-    if(_geometricFilter == BROADCAST_FILTER){
+    if(_geometricFilter == BROADCAST_FILTER || _geometricFilter == DISTRIBUTED){
 
       INFO("Filter mesh " << _mesh->getName() << " by bounding-box");
       Event e2("filter mesh by bounding box");
@@ -248,8 +301,10 @@ void ReceivedPartition:: filterMesh(mesh::Mesh& filteredMesh, const bool filterB
                <<", #edges: " << _mesh->edges().size()
                <<", #triangles: " << _mesh->triangles().size() << ", rank: " << utils::MasterSlave::_rank);
 
-  std::map<int, mesh::Vertex*> vertexMap;
-  std::map<int, mesh::Edge*> edgeMap;
+  mesh::IDMap<mesh::Vertex> vertexMap;
+  mesh::IDMap<mesh::Edge> edgeMap;
+  vertexMap.reserve(_mesh->vertices().size());
+  edgeMap.reserve(_mesh->edges().size());
   int vertexCounter = 0;
 
   for (const mesh::Vertex& vertex : _mesh->vertices()) {
@@ -259,7 +314,7 @@ void ReceivedPartition:: filterMesh(mesh::Mesh& filteredMesh, const bool filterB
       v.setGlobalIndex(vertex.getGlobalIndex());
       if(vertex.isTagged()) v.tag();
       v.setOwner(vertex.isOwner());
-      vertexMap[vertex.getID()] = &v;
+      vertexMap.insert(vertex.getID(), &v);
     }
     vertexCounter++;
   }
@@ -268,10 +323,9 @@ void ReceivedPartition:: filterMesh(mesh::Mesh& filteredMesh, const bool filterB
   for (mesh::Edge& edge : _mesh->edges()) {
     int vertexIndex1 = edge.vertex(0).getID();
     int vertexIndex2 = edge.vertex(1).getID();
-    if (utils::contained(vertexIndex1, vertexMap) &&
-        utils::contained(vertexIndex2, vertexMap)) {
-      mesh::Edge& e = filteredMesh.createEdge(*vertexMap[vertexIndex1], *vertexMap[vertexIndex2]);
-      edgeMap[edge.getID()] = &e;
+    if (vertexMap.contains(vertexIndex1) && vertexMap.contains(vertexIndex2)) {
+      mesh::Edge& e = filteredMesh.createEdge(vertexMap[vertexIndex1], vertexMap[vertexIndex2]);
+      edgeMap.insert(edge.getID(), &e);
     }
   }
 
@@ -281,10 +335,10 @@ void ReceivedPartition:: filterMesh(mesh::Mesh& filteredMesh, const bool filterB
       int edgeIndex1 = triangle.edge(0).getID();
       int edgeIndex2 = triangle.edge(1).getID();
       int edgeIndex3 = triangle.edge(2).getID();
-      if (utils::contained(edgeIndex1, edgeMap) &&
-          utils::contained(edgeIndex2, edgeMap) &&
-          utils::contained(edgeIndex3, edgeMap)) {
-        filteredMesh.createTriangle(*edgeMap[edgeIndex1],*edgeMap[edgeIndex2],*edgeMap[edgeIndex3]);
+      if (edgeMap.contains(edgeIndex1) &&
+          edgeMap.contains(edgeIndex2) &&
+          edgeMap.contains(edgeIndex3)) {
+        filteredMesh.createTriangle(edgeMap[edgeIndex1],edgeMap[edgeIndex2],edgeMap[edgeIndex3]);
       }
     }
   }
@@ -296,7 +350,8 @@ void ReceivedPartition:: filterMesh(mesh::Mesh& filteredMesh, const bool filterB
 
 void ReceivedPartition::prepareBoundingBox(){
 
-  _bb.resize(_dimensions, std::make_pair(std::numeric_limits<double>::max(), std::numeric_limits<double>::lowest()));
+  // Starts from an empty box, this function is called more than once for the distributed filter
+  _bb.assign(_dimensions, std::make_pair(std::numeric_limits<double>::max(), std::numeric_limits<double>::lowest()));
 
   //create BB around both "other" meshes
   if (_fromMapping.use_count()>0) {
@@ -337,136 +392,165 @@ bool ReceivedPartition::isVertexInBB(const mesh::Vertex& vertex){
 void ReceivedPartition:: createOwnerInformation(){
   TRACE();
 
-  if (utils::MasterSlave::_slaveMode) {
-    int numberOfVertices = _mesh->vertices().size();
-    utils::MasterSlave::_communication->send(numberOfVertices,0);
-
-    if (numberOfVertices!=0) {
-      std::vector<int> tags(numberOfVertices, -1);
-      std::vector<int> globalIDs(numberOfVertices, -1);
-      bool atInterface = false;
-      for(int i=0; i<numberOfVertices; i++){
-        globalIDs[i] = _mesh->vertices()[i].getGlobalIndex();
-        if(_mesh->vertices()[i].isTagged()){
-          tags[i] = 1;
-          atInterface = true;
-        }
-        else{
-          tags[i] = 0;
-        }
+  // Only tagged vertices can be owned. A tagged vertex is shared with another rank only if it lies
+  // in the bounding box of the tagged vertices of that rank. All other tagged vertices are owned
+  // locally, only the shared ones are resolved by the master. Thus, no rank handles information of
+  // global size.
+  int numberOfVertices = _mesh->vertices().size();
+  mesh::Mesh::BoundingBox taggedBB(_dimensions, std::make_pair(std::numeric_limits<double>::max(),
+                                                               std::numeric_limits<double>::lowest()));
+  for (const mesh::Vertex& vertex : _mesh->vertices()) {
+    if (vertex.isTagged()) {
+      for (int d=0; d<_dimensions; d++) {
+        taggedBB[d].first = std::min(taggedBB[d].first, vertex.getCoords()[d]);
+        taggedBB[d].second = std::max(taggedBB[d].second, vertex.getCoords()[d]);
       }
-      DEBUG("My tags: " << tags);
-      DEBUG("My global IDs: " << globalIDs);
-      utils::MasterSlave::_communication->send(tags.data(),numberOfVertices,0);
-      utils::MasterSlave::_communication->send(globalIDs.data(),numberOfVertices,0);
-      utils::MasterSlave::_communication->send(atInterface,0);
-
-      std::vector<int> ownerVec(numberOfVertices, -1);
-      utils::MasterSlave::_communication->receive(ownerVec.data(),numberOfVertices,0);
-      DEBUG("My owner information: " << ownerVec);
-      setOwnerInformation(ownerVec);
     }
   }
 
+  // All ranks get the bounding boxes of all ranks, as min and max per dimension
+  int size = utils::MasterSlave::_size;
+  std::vector<double> taggedBBs(size * 2 * _dimensions);
+  if (utils::MasterSlave::_slaveMode) {
+    com::CommunicateMesh(utils::MasterSlave::_communication).sendBoundingBox(taggedBB, 0);
+  }
+  else {
+    mesh::Mesh::BoundingBox bb = taggedBB;
+    for (int rank = 0; rank < size; rank++) {
+      if (rank > 0) {
+        com::CommunicateMesh(utils::MasterSlave::_communication).receiveBoundingBox(bb, rank);
+      }
+      for (int d=0; d<_dimensions; d++) {
+        taggedBBs[(rank * _dimensions + d) * 2] = bb[d].first;
+        taggedBBs[(rank * _dimensions + d) * 2 + 1] = bb[d].second;
+      }
+    }
+  }
+  utils::MasterSlave::broadcast(taggedBBs.data(), taggedBBs.size());
 
-  else if (utils::MasterSlave::_masterMode) {
-    std::vector<int> globalOwnerVec(_mesh->getGlobalNumberOfVertices(),0); //to temporary store which vertices already have an owner
-    std::vector<std::vector<int> > slaveOwnerVecs; // the same per rank
-    std::vector<std::vector<int> > slaveGlobalIDs; // global IDs per rank
-    std::vector<std::vector<int> > slaveTags; // tag information per rank
-
-    slaveOwnerVecs.resize(utils::MasterSlave::_size);
-    slaveGlobalIDs.resize(utils::MasterSlave::_size);
-    slaveTags.resize(utils::MasterSlave::_size);
-
-    // fill master data
-
-    bool masterAtInterface = false;
-    slaveOwnerVecs[0].resize(_mesh->vertices().size());
-    slaveGlobalIDs[0].resize(_mesh->vertices().size());
-    slaveTags[0].resize(_mesh->vertices().size());
-    for(size_t i=0; i<_mesh->vertices().size(); i++){
-      slaveGlobalIDs[0][i] = _mesh->vertices()[i].getGlobalIndex();
-      if(_mesh->vertices()[i].isTagged()){
-        masterAtInterface = true;
-        slaveTags[0][i] = 1;
+  auto isInBB = [&](const mesh::Vertex& vertex, int rank) {
+    for (int d=0; d<_dimensions; d++) {
+      if (vertex.getCoords()[d] < taggedBBs[(rank * _dimensions + d) * 2] ||
+          vertex.getCoords()[d] > taggedBBs[(rank * _dimensions + d) * 2 + 1]) {
+        return false;
       }
-      else{
-        slaveTags[0][i] = 0;
+    }
+    return true;
+  };
+
+  // Only ranks whose bounding box overlaps the local one can share vertices
+  std::vector<int> neighborRanks;
+  for (int rank = 0; rank < size; rank++) {
+    if (rank == utils::MasterSlave::_rank) continue;
+    bool overlapping = true;
+    for (int d=0; d<_dimensions; d++) {
+      if (taggedBB[d].first > taggedBBs[(rank * _dimensions + d) * 2 + 1] ||
+          taggedBBs[(rank * _dimensions + d) * 2] > taggedBB[d].second) {
+        overlapping = false;
       }
     }
-    DEBUG("My tags: " << slaveTags[0]);
-
-    // receive slave data
-    int ranksAtInterface = 0;
-    if(masterAtInterface) ranksAtInterface++;
-
-    for (int rank = 1; rank < utils::MasterSlave::_size; rank++){
-      int localNumberOfVertices = -1;
-      utils::MasterSlave::_communication->receive(localNumberOfVertices,rank);
-      DEBUG("Rank " << rank << " has " << localNumberOfVertices << " vertices.");
-      slaveOwnerVecs[rank].resize(localNumberOfVertices, 0);
-      slaveTags[rank].resize(localNumberOfVertices, -1);
-      slaveGlobalIDs[rank].resize(localNumberOfVertices, -1);
-
-      if (localNumberOfVertices!=0) {
-        utils::MasterSlave::_communication->receive(slaveTags[rank].data(),localNumberOfVertices,rank);
-        utils::MasterSlave::_communication->receive(slaveGlobalIDs[rank].data(),localNumberOfVertices,rank);
-        DEBUG("Rank " << rank << " has this tags " << slaveTags[rank]);
-        DEBUG("Rank " << rank << " has this global IDs " << slaveGlobalIDs[rank]);
-        bool atInterface = false;
-        utils::MasterSlave::_communication->receive(atInterface,rank);
-        if(atInterface) ranksAtInterface++;
+    if (overlapping) neighborRanks.push_back(rank);
+  }
+  DEBUG("Ranks possibly sharing vertices: " << neighborRanks);
+
+  std::vector<int> ownerVec(numberOfVertices, 0);
+  std::vector<int> sharedIndices; // local indices of shared vertices
+  std::vector<int> sharedGlobalIDs;
+  int numberOfOwned = 0;
+  for (int i=0; i<numberOfVertices; i++) {
+    const mesh::Vertex& vertex = _mesh->vertices()[i];
+    if (not vertex.isTagged()) continue;
+    bool shared = false;
+    for (int rank : neighborRanks) {
+      if (isInBB(vertex, rank)) {
+        shared = true;
+        break;
       }
     }
+    if (shared) {
+      sharedIndices.push_back(i);
+      sharedGlobalIDs.push_back(vertex.getGlobalIndex());
+    }
+    else {
+      ownerVec[i] = 1;
+      numberOfOwned++;
+    }
+  }
+  DEBUG("Exclusively owned vertices: " << numberOfOwned << ", shared vertices: " << sharedGlobalIDs.size());
 
-    // decide upon owners,
-    int localGuess = _mesh->getGlobalNumberOfVertices() / ranksAtInterface; //guess for a decent load balancing
-    //first round: every slave gets localGuess vertices
-    for (int rank = 0; rank < utils::MasterSlave::_size; rank++){
-      int counter = 0;
-      for (size_t i=0; i < slaveOwnerVecs[rank].size(); i++) {
-        if (globalOwnerVec[slaveGlobalIDs[rank][i]] == 0 && slaveTags[rank][i]==1) { // Vertex has no owner yet and rank could be owner
-          slaveOwnerVecs[rank][i] = 1; // Now rank is owner
-          globalOwnerVec[slaveGlobalIDs[rank][i]] = 1; //vertex now has owner
-          counter++;
-          if(counter==localGuess) break;
-        }
+  // Resolve the shared vertices at the master
+  int numberOfShared = sharedGlobalIDs.size();
+  std::vector<int> sharedOwnerVec(numberOfShared, 0);
+  if (utils::MasterSlave::_slaveMode) {
+    utils::MasterSlave::_communication->send(numberOfOwned, 0);
+    utils::MasterSlave::_communication->send(numberOfShared, 0);
+    if (numberOfShared != 0) {
+      utils::MasterSlave::_communication->send(sharedGlobalIDs.data(), numberOfShared, 0);
+      utils::MasterSlave::_communication->receive(sharedOwnerVec.data(), numberOfShared, 0);
+    }
+  }
+  else {
+    assertion(utils::MasterSlave::_masterMode);
+    std::vector<int> ownedCounts(size, 0);
+    std::vector<std::vector<int>> rankGlobalIDs(size);
+    std::map<int, std::vector<int>> sharingRanks; // global ID -> ranks holding the vertex tagged
+    ownedCounts[0] = numberOfOwned;
+    rankGlobalIDs[0] = sharedGlobalIDs;
+    for (int rank = 1; rank < size; rank++) {
+      int numberOfSlaveShared = -1;
+      utils::MasterSlave::_communication->receive(ownedCounts[rank], rank);
+      utils::MasterSlave::_communication->receive(numberOfSlaveShared, rank);
+      rankGlobalIDs[rank].resize(numberOfSlaveShared);
+      if (numberOfSlaveShared != 0) {
+        utils::MasterSlave::_communication->receive(rankGlobalIDs[rank].data(), numberOfSlaveShared, rank);
       }
     }
-
-    //second round: distribute all other vertices in a greedy way
-    for (int rank = 0; rank < utils::MasterSlave::_size; rank++) {
-      for(size_t i=0; i < slaveOwnerVecs[rank].size(); i++){
-        if(globalOwnerVec[slaveGlobalIDs[rank][i]] == 0 && slaveTags[rank][i]==1){
-          slaveOwnerVecs[rank][i] = 1;
-          globalOwnerVec[slaveGlobalIDs[rank][i]] = rank + 1;
-        }
+    for (int rank = 0; rank < size; rank++) {
+      for (int globalID : rankGlobalIDs[rank]) {
+        sharingRanks[globalID].push_back(rank);
       }
     }
 
-    // send information back to slaves
-    for (int rank = 1; rank < utils::MasterSlave::_size; rank++){
-      int localNumberOfVertices = slaveTags[rank].size();
-      if (localNumberOfVertices!=0) {
-        utils::MasterSlave::_communication->send(slaveOwnerVecs[rank].data(),localNumberOfVertices,rank);
+    // Each shared vertex goes to the sharing rank which owns the fewest vertices so far
+    std::map<int, int> owners;
+    for (const auto& pair : sharingRanks) {
+      int owner = pair.second.front();
+      for (int rank : pair.second) {
+        if (ownedCounts[rank] < ownedCounts[owner]) owner = rank;
       }
+      ownedCounts[owner]++;
+      owners[pair.first] = owner;
     }
-    // master data
-    DEBUG("My owner information: " << slaveOwnerVecs[0]);
-    setOwnerInformation(slaveOwnerVecs[0]);
+    DEBUG("Owned vertices per rank: " << ownedCounts);
 
+    for (int rank = 0; rank < size; rank++) {
+      std::vector<int> rankOwnerVec(rankGlobalIDs[rank].size(), 0);
+      for (size_t i=0; i < rankGlobalIDs[rank].size(); i++) {
+        rankOwnerVec[i] = owners[rankGlobalIDs[rank][i]] == rank ? 1 : 0;
+      }
+      if (rank == 0) {
+        sharedOwnerVec = rankOwnerVec;
+      }
+      else if (not rankOwnerVec.empty()) {
+        utils::MasterSlave::_communication->send(rankOwnerVec.data(), rankOwnerVec.size(), rank);
+      }
+    }
 
-#     ifndef NDEBUG
-    for(size_t i=0;i<globalOwnerVec.size();i++){
-      if(globalOwnerVec[i]==0){
-        WARN( "The Vertex with global index " << i << " of mesh: " << _mesh->getName()
-                       << " was completely filtered out, since it has no influence on any mapping.");
-          }
+#   ifndef NDEBUG
+    int totalOwned = 0;
+    for (int count : ownedCounts) totalOwned += count;
+    if (totalOwned < _mesh->getGlobalNumberOfVertices()) {
+      WARN(_mesh->getGlobalNumberOfVertices() - totalOwned << " vertices of mesh " << _mesh->getName()
+           << " were completely filtered out, since they have no influence on any mapping.");
     }
-#     endif
+#   endif
+  }
 
+  for (int i=0; i<numberOfShared; i++) {
+    ownerVec[sharedIndices[i]] = sharedOwnerVec[i];
   }
+  DEBUG("My owner information: " << ownerVec);
+  setOwnerInformation(ownerVec);
 }
 
 void ReceivedPartition:: setOwnerInformation(const std::vector<int> &ownerVec){
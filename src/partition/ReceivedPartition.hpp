@@ -6,6 +6,12 @@
 #include "mesh/Vertex.hpp"
 #include "mesh/Mesh.hpp"
 
+// Forward declaration to friend the boost test struct
+namespace PartitionTests {
+namespace ReceivedPartitionTests {
+struct RepeatedBoundingBox;
+}}
+
 namespace precice {
 namespace partition {
 
@@ -15,6 +21,10 @@ namespace partition {
  *
  * A mesh is received by the master rank and re-partitioned among all slave ranks.
  * Afterwards necessary distribution data structures are set up.
+ *
+ * With the geometric filter DISTRIBUTED, the ranks of both participants exchange their bounding
+ * boxes instead and every rank receives the parts of the mesh directly from the provider ranks
+ * whose bounding boxes overlap its own one. No rank holds the global mesh.
  */
 class ReceivedPartition : public Partition
 {
@@ -29,7 +39,9 @@ public:
     // @brief Filter at master and communicate only filtered mesh.
     FILTER_FIRST,
     // @brief Broadcast first and filter then
-    BROADCAST_FILTER
+    BROADCAST_FILTER,
+    // @brief Receive the parts of the mesh directly from all overlapping provider ranks and filter then
+    DISTRIBUTED
   };
 
    /// Constructor
@@ -45,6 +57,11 @@ public:
 
 private:
 
+   friend struct PartitionTests::ReceivedPartitionTests::RepeatedBoundingBox;
+
+   /// Receives the parts of the mesh from all overlapping remote ranks.
+   void communicateDistributed();
+
    void filterMesh(mesh::Mesh& filteredMesh, const bool filterByBB);
 
    void prepareBoundingBox();
@@ -11,6 +11,8 @@
 #include "m2n/M2N.hpp"
 #include "utils/MasterSlave.hpp"
 #include "m2n/GatherScatterComFactory.hpp"
+#include "m2n/PointToPointComFactory.hpp"
+#include "com/MPIPortsCommunicationFactory.hpp"
 #include "mapping/SharedPointer.hpp"
 #include "mapping/NearestProjectionMapping.hpp"
 #include "mapping/NearestNeighborMapping.hpp"
@@ -70,6 +72,44 @@ void setupParallelEnvironmentTwoParticipants(m2n::PtrM2N m2n){
   }
 }
 
+/// Like setupParallelEnvironmentTwoParticipants, but all ranks take part in the m2n master connection.
+void setupParallelEnvironmentTwoParticipantsAllRanks(m2n::PtrM2N m2n){
+  assertion(utils::Parallel::getCommunicatorSize() == 4);
+
+  com::PtrCommunication masterSlaveCom = com::PtrCommunication(new com::MPIDirectCommunication());
+  utils::MasterSlave::_communication = masterSlaveCom;
+
+  if (utils::Parallel::getProcessRank() == 0){ //SOLIDZ
+    utils::Parallel::splitCommunicator( "Solid" );
+    utils::MasterSlave::_slaveMode = false;
+    utils::MasterSlave::_masterMode = false;
+  }
+  else if(utils::Parallel::getProcessRank() == 1){//Master
+    utils::Parallel::splitCommunicator( "FluidMaster" );
+    utils::MasterSlave::_rank = 0;
+    utils::MasterSlave::_size = 3;
+    utils::MasterSlave::_slaveMode = false;
+    utils::MasterSlave::_masterMode = true;
+    masterSlaveCom->acceptConnection ( "FluidMaster", "FluidSlaves", 0, 1);
+    masterSlaveCom->setRankOffset(1);
+  }
+  else {//Slaves
+    utils::Parallel::splitCommunicator( "FluidSlaves");
+    utils::MasterSlave::_rank = utils::Parallel::getProcessRank() - 1;
+    utils::MasterSlave::_size = 3;
+    utils::MasterSlave::_slaveMode = true;
+    utils::MasterSlave::_masterMode = false;
+    masterSlaveCom->requestConnection( "FluidMaster", "FluidSlaves", utils::MasterSlave::_rank - 1, 2 );
+  }
+
+  if (utils::Parallel::getProcessRank() == 0){
+    m2n->acceptMasterConnection ( "Solid", "FluidMaster");
+  }
+  else {
+    m2n->requestMasterConnection ( "Solid", "FluidMaster");
+  }
+}
+
 void setupParallelEnvironmentOneParticipant(){
   assertion(utils::Parallel::getCommunicatorSize() == 4);
   com::PtrCommunication masterSlaveCom = com::PtrCommunication(new com::MPIDirectCommunication());
@@ -320,6 +360,86 @@ BOOST_AUTO_TEST_CASE(RePartitionNNBroadcastFilter2D, * testing::OnSize(4))
   tearDownParallelEnvironment();
 }
 
+BOOST_AUTO_TEST_CASE(RePartitionNNDistributed2D, * testing::OnSize(4))
+{
+  utils::Parallel::setGlobalCommunicator(utils::Parallel::getRestrictedCommunicator({0,1,2,3}));
+  assertion(utils::Parallel::getCommunicatorSize() == 4);
+  com::PtrCommunication participantCom =
+      com::PtrCommunication(new com::MPIDirectCommunication());
+  m2n::DistributedComFactory::SharedPointer distrFactory = m2n::DistributedComFactory::SharedPointer(
+      new m2n::PointToPointComFactory(com::PtrCommunicationFactory(new com::MPIPortsCommunicationFactory())));
+  m2n::PtrM2N m2n = m2n::PtrM2N(new m2n::M2N(participantCom, distrFactory));
+
+  setupParallelEnvironmentTwoParticipantsAllRanks(m2n);
+
+  int dimensions = 2;
+  bool flipNormals = false;
+
+  if (utils::Parallel::getProcessRank() == 0){ //SOLIDZ
+    mesh::PtrMesh pSolidzMesh(new mesh::Mesh("SolidzMesh", dimensions, flipNormals));
+    m2n->createDistributedCommunication(pSolidzMesh);
+    createSolidzMesh2D(pSolidzMesh);
+    pSolidzMesh->computeState();
+    bool hasToSend = true;
+    bool sendDistributed = true;
+    ProvidedPartition part(pSolidzMesh, hasToSend, sendDistributed);
+    part.setm2n(m2n);
+    part.communicate();
+  }
+  else{
+    mesh::PtrMesh pNastinMesh(new mesh::Mesh("NastinMesh", dimensions, flipNormals));
+    mesh::PtrMesh pSolidzMesh(new mesh::Mesh("SolidzMesh", dimensions, flipNormals));
+    m2n->createDistributedCommunication(pSolidzMesh);
+
+    mapping::PtrMapping boundingFromMapping = mapping::PtrMapping (
+        new mapping::NearestNeighborMapping(mapping::Mapping::CONSISTENT, dimensions) );
+    mapping::PtrMapping boundingToMapping = mapping::PtrMapping (
+        new mapping::NearestNeighborMapping(mapping::Mapping::CONSERVATIVE, dimensions) );
+    boundingFromMapping->setMeshes(pSolidzMesh,pNastinMesh);
+    boundingToMapping->setMeshes(pNastinMesh,pSolidzMesh);
+
+    createNastinMesh2D(pNastinMesh);
+    pNastinMesh->computeState();
+
+    double safetyFactor = 0.1;
+
+    ReceivedPartition part(pSolidzMesh, ReceivedPartition::DISTRIBUTED, safetyFactor);
+    part.setm2n(m2n);
+    part.setFromMapping(boundingFromMapping);
+    part.setToMapping(boundingToMapping);
+    part.communicate();
+
+    // only ranks whose bounding box overlaps the provided mesh receive a part of it
+    if(utils::Parallel::getProcessRank() == 2){//Slave1
+      BOOST_TEST(pSolidzMesh->vertices().size()==0);
+    }
+    else {
+      BOOST_TEST(pSolidzMesh->vertices().size()==6);
+    }
+
+    part.compute();
+
+    // same result as with the other filters
+    BOOST_TEST(pSolidzMesh->getGlobalNumberOfVertices()==6);
+    if(utils::Parallel::getProcessRank() == 1){//Master
+      BOOST_TEST(pSolidzMesh->vertices().size()==2);
+      BOOST_TEST(pSolidzMesh->edges().size()==1);
+      BOOST_TEST(pSolidzMesh->getVertexDistribution()[0].size()==2);
+      BOOST_TEST(pSolidzMesh->getVertexDistribution()[2].size()==2);
+    }
+    else if(utils::Parallel::getProcessRank() == 2){//Slave1
+      BOOST_TEST(pSolidzMesh->vertices().size()==0);
+      BOOST_TEST(pSolidzMesh->edges().size()==0);
+    }
+    else if(utils::Parallel::getProcessRank() == 3){//Slave2
+      BOOST_TEST(pSolidzMesh->vertices().size()==2);
+      BOOST_TEST(pSolidzMesh->edges().size()==1);
+    }
+  }
+
+  tearDownParallelEnvironment();
+}
+
 BOOST_AUTO_TEST_CASE(RePartitionNNDoubleNode2D, * testing::OnSize(4))
 {
   utils::Parallel::setGlobalCommunicator(utils::Parallel::getRestrictedCommunicator({0,1,2,3}));
@@ -978,6 +1098,49 @@ BOOST_AUTO_TEST_CASE(TestRepartitionAndDistribution2D,
   tearDownParallelEnvironment();
 }
 
+BOOST_AUTO_TEST_CASE(TestBalancedOwnership2D, * testing::OnSize(4))
+{
+  setupParallelEnvironmentOneParticipant();
+
+  int dimensions = 2;
+  bool flipNormals = false;
+  mesh::PtrMesh pMesh(new mesh::Mesh("MyMesh", dimensions, flipNormals));
+  mesh::PtrMesh pOtherMesh(new mesh::Mesh("OtherMesh", dimensions, flipNormals));
+
+  mapping::PtrMapping boundingFromMapping = mapping::PtrMapping (
+      new mapping::NearestNeighborMapping(mapping::Mapping::CONSISTENT, dimensions) );
+  boundingFromMapping->setMeshes(pMesh, pOtherMesh);
+
+  // All ranks need all vertices
+  Eigen::VectorXd position(dimensions);
+  for (int i = 0; i < 4; i++) {
+    position << i, 0.0;
+    if (utils::Parallel::getProcessRank() == 0) { //Master
+      mesh::Vertex& v = pMesh->createVertex(position);
+      v.setGlobalIndex(i);
+    }
+    pOtherMesh->createVertex(position);
+  }
+
+  pOtherMesh->computeState();
+  double safetyFactor = 0.1;
+  ReceivedPartition part(pMesh, ReceivedPartition::FILTER_FIRST, safetyFactor);
+  part.setFromMapping(boundingFromMapping);
+  part.compute();
+
+  BOOST_TEST(pMesh->vertices().size() == 4);
+  int owned = 0;
+  for (const mesh::Vertex& vertex : pMesh->vertices()) {
+    if (vertex.isOwner()) {
+      owned++;
+      BOOST_TEST(vertex.getGlobalIndex() == utils::Parallel::getProcessRank());
+    }
+  }
+  BOOST_TEST(owned == 1);
+
+  tearDownParallelEnvironment();
+}
+
 BOOST_AUTO_TEST_CASE(ProvideAndReceiveCouplingMode, * testing::MinRanks(2))
 {
   MPI_Comm comm = utils::Parallel::getRestrictedCommunicator({0,1});
@@ -1070,6 +1233,34 @@ BOOST_AUTO_TEST_CASE(ProvideAndReceiveCouplingMode, * testing::MinRanks(2))
 
 
 
+BOOST_AUTO_TEST_CASE(RepeatedBoundingBox, * testing::OnMaster())
+{
+  int dimensions = 2;
+  mesh::PtrMesh pMesh(new mesh::Mesh("SolidzMesh", dimensions, false));
+  mesh::PtrMesh pOtherMesh(new mesh::Mesh("NastinMesh", dimensions, false));
+  pOtherMesh->createVertex(Eigen::Vector2d(0.0, 1.0));
+  pOtherMesh->createVertex(Eigen::Vector2d(2.0, 5.0));
+  pOtherMesh->computeState();
+
+  mapping::PtrMapping boundingFromMapping = mapping::PtrMapping (
+      new mapping::NearestNeighborMapping(mapping::Mapping::CONSISTENT, dimensions) );
+  boundingFromMapping->setMeshes(pMesh, pOtherMesh);
+
+  double safetyFactor = 0.5;
+  ReceivedPartition part(pMesh, ReceivedPartition::DISTRIBUTED, safetyFactor);
+  part.setFromMapping(boundingFromMapping);
+
+  // The distributed filter prepares the bounding box in communicate() and again in compute()
+  part.prepareBoundingBox();
+  mesh::Mesh::BoundingBox first = part._bb;
+  part.prepareBoundingBox();
+  BOOST_TEST(part._bb == first);
+  BOOST_TEST(part._bb[0].first == -1.0);
+  BOOST_TEST(part._bb[0].second == 3.0);
+  BOOST_TEST(part._bb[1].first == -1.0);
+  BOOST_TEST(part._bb[1].second == 7.0);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
 
@@ -324,6 +324,23 @@ void SolverInterface:: readScalarData
   return _impl->readScalarData ( dataID, valueIndex, value );
 }
 
+void SolverInterface:: setDataBuffer
+(
+  int     dataID,
+  int     size,
+  int*    valueIndices,
+  double* values )
+{
+  _impl->setDataBuffer(dataID, size, valueIndices, values);
+}
+
+void SolverInterface:: removeDataBuffer
+(
+  int dataID )
+{
+  _impl->removeDataBuffer(dataID);
+}
+
 MeshHandle SolverInterface:: getMeshHandle
 (
   const std::string & meshName )
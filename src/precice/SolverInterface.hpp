@@ -539,6 +539,36 @@ public:
     int     valueIndex,
     double& value );
 
+  /**
+   * @brief Registers an array of the solver as storage of the values of data.
+   *
+   * Instead of calling the block write and read methods, preCICE takes the values of
+   * written data from the array at the beginning of initializeData() and advance(), and
+   * stores the values of read data into the array at the end of initialize(),
+   * initializeData() and advance(). The values have the same layout as in
+   * writeBlockVectorData() and writeBlockScalarData(). Registering again replaces the
+   * previous array of the data.
+   *
+   * The array is owned by the solver. It has to stay valid and must not be resized until
+   * it is removed by removeDataBuffer() or finalize() is called.
+   *
+   * @param[in] dataID ID of the data, written or read by this participant.
+   * @param[in] size Number n of vertices of the array, not size of array values.
+   * @param[in] valueIndices Indizes of the vertices of the values, from SolverInterface::setMeshVertex() e.g.
+   *                         They are copied on registration. If nullptr, value i belongs to vertex i.
+   * @param[in] values Array of the data values.
+   */
+  void setDataBuffer (
+    int     dataID,
+    int     size,
+    int*    valueIndices,
+    double* values );
+
+  /**
+   * @brief Removes the array registered by setDataBuffer() for the data.
+   */
+  void removeDataBuffer ( int dataID );
+
   /**
    * @brief Returns a handle to a created mesh.
    */
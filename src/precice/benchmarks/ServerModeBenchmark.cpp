@@ -0,0 +1,118 @@
+#ifndef PRECICE_NO_MPI
+
+#include "m2n/CommunicationStatistics.hpp"
+#include "precice/SolverInterface.hpp"
+#include "precice/impl/SolverInterfaceImpl.hpp"
+#include "testing/Benchmark.hpp"
+#include "utils/EventTimings.hpp"
+#include "utils/Globals.hpp"
+#include "utils/MasterSlave.hpp"
+#include "utils/Parallel.hpp"
+
+#include <vector>
+
+using namespace precice;
+using precice::testing::BenchmarkState;
+
+namespace
+{
+
+/// Runs SolverOne on rank 0, SolverTwo as clients on the next ranks and its server on the last rank.
+/**
+ * SolverOne provides a mesh with the given number of vertices, each client of SolverTwo reads the
+ * forces of an equal share of the vertices and writes displacements, such that the server handles
+ * one read and one write request per client and time step. One benchmark iteration is one time
+ * step, the throughput is given in vertices handled by the server per second.
+ */
+void benchmarkServer(BenchmarkState& state, const std::string& configFile, int clients, int vertices)
+{
+  int rank = utils::Parallel::getProcessRank();
+  bool isServer = rank == clients + 1;
+  std::string localName = rank == 0 ? "SolverOne" : (isServer ? "SolverTwoServer" : "SolverTwo");
+  utils::Parallel::splitCommunicator(localName);
+  utils::Parallel::setGlobalCommunicator(utils::Parallel::getLocalCommunicator());
+  utils::Parallel::clearGroups();
+
+  if (isServer) {
+    impl::SolverInterfaceImpl server("SolverTwo", 0, 1, true);
+    server.configure(configFile);
+    server.runServer();
+    // The time step loop is measured on rank 0
+    while (state.keepRunning()) {
+    }
+  }
+  else if (rank == 0) {
+    std::vector<double> positions(3 * vertices);
+    for (int i = 0; i < vertices; i++) {
+      positions[3 * i] = i;
+    }
+    std::vector<int>    vertexIDs(vertices);
+    std::vector<double> forces(3 * vertices, 1.0);
+    std::vector<double> displacements(3 * vertices);
+
+    SolverInterface interface("SolverOne", 0, 1);
+    interface.configure(configFile);
+    int meshID = interface.getMeshID("MeshOne");
+    int forcesID = interface.getDataID("Forces", meshID);
+    int displacementsID = interface.getDataID("Displacements", meshID);
+    interface.setMeshVertices(meshID, vertices, positions.data(), vertexIDs.data());
+    double dt = interface.initialize();
+    while (state.keepRunning()) {
+      interface.writeBlockVectorData(forcesID, vertices, vertexIDs.data(), forces.data());
+      dt = interface.advance(dt);
+      interface.readBlockVectorData(displacementsID, vertices, vertexIDs.data(), displacements.data());
+    }
+    interface.finalize();
+  }
+  else {
+    int client = rank - 1;
+    int begin = vertices * client / clients;
+    int size = vertices * (client + 1) / clients - begin;
+    std::vector<int> vertexIDs(size);
+    for (int i = 0; i < size; i++) {
+      vertexIDs[i] = begin + i;
+    }
+    std::vector<double> values(3 * size);
+
+    SolverInterface interface("SolverTwo", client, clients);
+    interface.configure(configFile);
+    int meshID = interface.getMeshID("MeshOne");
+    int forcesID = interface.getDataID("Forces", meshID);
+    int displacementsID = interface.getDataID("Displacements", meshID);
+    double dt = interface.initialize();
+    while (state.keepRunning()) {
+      interface.readBlockVectorData(forcesID, size, vertexIDs.data(), values.data());
+      interface.writeBlockVectorData(displacementsID, size, vertexIDs.data(), values.data());
+      dt = interface.advance(dt);
+    }
+    interface.finalize();
+  }
+
+  utils::EventRegistry::clear();
+  utils::MasterSlave::reset();
+  m2n::CommunicationStatistics::clear();
+
+  state.setItemsProcessed(static_cast<double>(state.iterations()) * vertices);
+  state.setCounter("clients", clients);
+  state.setCounter("vertices", vertices);
+}
+
+bool registered = [] {
+  const int vertices = 100000;
+  for (int clients : {1, 2, 4, 8}) {
+    for (std::string threading : {"Serial", "Threaded"}) {
+      testing::registerBenchmark(
+          "ServerMode/" + threading + "/" + std::to_string(clients),
+          [threading, clients](BenchmarkState& state) {
+            benchmarkServer(state, utils::getPathToSources() + "/precice/benchmarks/Server" + threading + ".xml",
+                            clients, vertices);
+          },
+          50, clients + 2);
+    }
+  }
+  return true;
+}();
+
+} // namespace
+
+#endif // not PRECICE_NO_MPI
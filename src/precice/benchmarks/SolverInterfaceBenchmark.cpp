@@ -0,0 +1,185 @@
+#ifndef PRECICE_NO_MPI
+
+#include "m2n/CommunicationStatistics.hpp"
+#include "precice/Constants.hpp"
+#include "precice/SolverInterface.hpp"
+#include "testing/Benchmark.hpp"
+#include "utils/EventTimings.hpp"
+#include "utils/Globals.hpp"
+#include "utils/MasterSlave.hpp"
+#include "utils/Parallel.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+using namespace precice;
+using precice::testing::BenchmarkState;
+
+namespace
+{
+
+/// Phases of SolverInterface::advance(), reported per time step as <phase>_seconds_per_iteration.
+const std::vector<std::string> phases = {"map", "communicate", "post-process", "export"};
+
+/// Returns the total duration in seconds of the event with the given hierarchical path.
+double eventSeconds(const std::string& path)
+{
+  const auto& hierarchy = utils::EventRegistry::getHierarchy();
+  auto event = hierarchy.find(path);
+  if (event == hierarchy.end()) {
+    return 0.0;
+  }
+  return std::chrono::duration<double>(event->second.getTotalDuration()).count();
+}
+
+/// Runs SolverOne on rank 0 and SolverTwo on rank 1, coupled as configured by the given file.
+/**
+ * The configuration has to define the participants SolverOne and SolverTwo with their meshes
+ * MeshOne and MeshTwo, SolverOne writes Forces and reads Displacements, SolverTwo does the
+ * opposite. Both participants define a planar grid mesh with the given number of vertices, the
+ * meshes are shifted against each other.
+ *
+ * The solvers are replaced by a deterministic linear contraction, such that implicit coupling
+ * schemes converge in the same number of iterations in every run. One benchmark iteration is one
+ * time step, including all coupling iterations. The time spent in the phases of advance(), taken
+ * from the EventRegistry, and the number of coupling iterations are reported as counters.
+ *
+ * With dataBuffers, the solvers register their arrays by setDataBuffer() instead of calling the
+ * block write and read methods in every iteration.
+ */
+void benchmarkCoupling(BenchmarkState& state, const std::string& configFile, int vertices, bool dataBuffers)
+{
+  int         rank            = utils::Parallel::getProcessRank();
+  std::string participantName = rank == 0 ? "SolverOne" : "SolverTwo";
+  std::string meshName        = rank == 0 ? "MeshOne" : "MeshTwo";
+  std::string writeDataName   = rank == 0 ? "Forces" : "Displacements";
+  std::string readDataName    = rank == 0 ? "Displacements" : "Forces";
+
+  utils::Parallel::splitCommunicator(participantName);
+  utils::Parallel::setGlobalCommunicator(utils::Parallel::getLocalCommunicator());
+  utils::Parallel::clearGroups();
+
+  int n = static_cast<int>(std::sqrt(static_cast<double>(vertices)));
+  double h = 1.0 / (n - 1);
+  double shift = rank == 0 ? 0.0 : 0.25 * h;
+  std::vector<double> positions;
+  positions.reserve(3 * n * n);
+  for (int j = 0; j < n; j++) {
+    for (int i = 0; i < n; i++) {
+      positions.push_back(i * h + shift);
+      positions.push_back(j * h + shift);
+      positions.push_back(0.0);
+    }
+  }
+  int size = n * n;
+  std::vector<int>    vertexIDs(size);
+  std::vector<double> writeValues(3 * size);
+  std::vector<double> readValues(3 * size, 0.0);
+
+  // Fixed point of forces = load - 0.5 * displacements, displacements = 0.5 * forces
+  std::vector<double> load(3 * size);
+  for (int i = 0; i < 3 * size; i++) {
+    load[i] = rank == 0 ? 1.0 + 0.1 * (i % 7) : 0.0;
+  }
+  double factor = rank == 0 ? -0.5 : 0.5;
+
+  const std::string& writeCheckpoint = constants::actionWriteIterationCheckpoint();
+  const std::string& readCheckpoint  = constants::actionReadIterationCheckpoint();
+  long long couplingIterations = 0;
+  {
+    SolverInterface interface(participantName, 0, 1);
+    interface.configure(configFile);
+    int meshID = interface.getMeshID(meshName);
+    int writeDataID = interface.getDataID(writeDataName, meshID);
+    int readDataID = interface.getDataID(readDataName, meshID);
+    interface.setMeshVertices(meshID, size, positions.data(), vertexIDs.data());
+    if (dataBuffers) {
+      interface.setDataBuffer(writeDataID, size, vertexIDs.data(), writeValues.data());
+      interface.setDataBuffer(readDataID, size, vertexIDs.data(), readValues.data());
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    double dt = interface.initialize();
+    state.setCounter("initialize_seconds",
+                     std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+
+    while (state.keepRunning()) {
+      do {
+        if (interface.isActionRequired(writeCheckpoint)) {
+          interface.fulfilledAction(writeCheckpoint);
+        }
+        for (int i = 0; i < 3 * size; i++) {
+          writeValues[i] = load[i] + factor * readValues[i];
+        }
+        if (not dataBuffers) {
+          interface.writeBlockVectorData(writeDataID, size, vertexIDs.data(), writeValues.data());
+        }
+        dt = interface.advance(dt);
+        if (not dataBuffers) {
+          interface.readBlockVectorData(readDataID, size, vertexIDs.data(), readValues.data());
+        }
+        if (interface.isActionRequired(readCheckpoint)) {
+          interface.fulfilledAction(readCheckpoint);
+        }
+        couplingIterations++;
+      } while (not interface.isTimestepComplete());
+    }
+
+    double iterations = static_cast<double>(state.iterations());
+    state.setCounter("advance_seconds_per_iteration", eventSeconds("advance") / iterations);
+    for (const std::string& phase : phases) {
+      state.setCounter(phase + "_seconds_per_iteration", eventSeconds("advance/" + phase) / iterations);
+    }
+    state.setCounter("coupling_iterations_per_iteration", couplingIterations / iterations);
+    interface.finalize();
+  }
+
+  utils::EventRegistry::clear();
+  utils::MasterSlave::reset();
+  m2n::CommunicationStatistics::clear();
+
+  state.setItemsProcessed(static_cast<double>(couplingIterations) * size);
+  state.setCounter("vertices", size);
+}
+
+/// Registers a case per size for a coupling configuration.
+/**
+ * Bundled configuration files are given by their name and looked up in the sources when the case
+ * runs, since the location of the sources is not known at registration.
+ */
+void registerCoupling(const std::string& name, const std::string& configFile, bool bundled,
+                      const std::vector<int>& sizes, long long iterations, bool dataBuffers = false)
+{
+  for (int vertices : sizes) {
+    testing::registerBenchmark(
+        "SolverInterfaceCoupling/" + name + "/" + std::to_string(vertices),
+        [configFile, bundled, vertices, dataBuffers](BenchmarkState& state) {
+          std::string path = bundled ? utils::getPathToSources() + "/precice/benchmarks/" + configFile : configFile;
+          benchmarkCoupling(state, path, vertices, dataBuffers);
+        },
+        std::max(2LL, iterations * sizes.front() / vertices), 2);
+  }
+}
+
+bool registered = [] {
+  registerCoupling("SerialExplicit", "SerialExplicit.xml", true, {10000, 100000, 1000000}, 100);
+  registerCoupling("SerialExplicitDataBuffers", "SerialExplicit.xml", true, {10000, 100000, 1000000}, 100, true);
+  registerCoupling("ParallelExplicit", "ParallelExplicit.xml", true, {10000, 100000}, 100);
+  registerCoupling("SerialImplicitIQNILS", "SerialImplicitIQNILS.xml", true, {10000, 100000}, 20);
+  registerCoupling("ParallelImplicitIQNILS", "ParallelImplicitIQNILS.xml", true, {10000, 100000}, 20);
+  // The multi-vector method builds a dense Jacobian of the size of the coupling data squared.
+  registerCoupling("ParallelImplicitMVQN", "ParallelImplicitMVQN.xml", true, {250, 500}, 20);
+
+  // Further configurations can be benchmarked without recompiling
+  if (const char* configFile = std::getenv("PRECICE_BENCHMARK_CONFIG")) {
+    const char* vertices = std::getenv("PRECICE_BENCHMARK_VERTICES");
+    registerCoupling("Custom", configFile, false, {vertices ? std::atoi(vertices) : 10000}, 20);
+  }
+  return true;
+}();
+
+} // namespace
+
+#endif // not PRECICE_NO_MPI
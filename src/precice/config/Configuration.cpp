@@ -1,5 +1,7 @@
 #include "Configuration.hpp"
 #include "utils/Globals.hpp"
+#include "utils/EventTimings.hpp"
+#include "xml/XMLAttribute.hpp"
 
 namespace precice {
 namespace config {
@@ -21,6 +23,23 @@ Configuration:: Configuration()
   _tag.addNamespace("server");
   _tag.addNamespace("coupling-scheme");
   _tag.addNamespace("post-processing");
+
+  xml::XMLTag tagTimings(*this, "event-timings", xml::XMLTag::OCCUR_NOT_OR_ONCE);
+  tagTimings.setDocumentation("Configures the recording of event timings.");
+
+  xml::XMLAttribute<bool> attrTrace("trace");
+  attrTrace.setDocumentation("Records every single event and writes the timeline of each rank to "
+                             "EventTimings-Participant-Rank.json in the Chrome trace event format.");
+  attrTrace.setDefaultValue(false);
+  tagTimings.addAttribute(attrTrace);
+
+  xml::XMLAttribute<int> attrTraceCapacity("trace-capacity");
+  attrTraceCapacity.setDocumentation("Maximum number of events recorded per rank. The buffer is allocated "
+                                     "upfront, further events are not recorded.");
+  attrTraceCapacity.setDefaultValue(100000);
+  tagTimings.addAttribute(attrTraceCapacity);
+
+  _tag.addSubtag(tagTimings);
 }
 
 xml::XMLTag& Configuration:: getXMLTag()
@@ -33,6 +52,12 @@ void Configuration:: xmlTagCallback
   xml::XMLTag& tag )
 {
   TRACE(tag.getName());
+  if (tag.getName() == "event-timings") {
+    int capacity = tag.getIntAttributeValue("trace-capacity");
+    CHECK(capacity >= 0, "Attribute trace-capacity of tag <event-timings> has to be non-negative!");
+    if (tag.getBooleanAttributeValue("trace"))
+      utils::EventRegistry::enableTimeline(capacity);
+  }
 }
 
 void Configuration:: xmlEndTagCallback
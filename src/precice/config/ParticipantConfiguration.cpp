@@ -57,9 +57,11 @@ ParticipantConfiguration:: ParticipantConfiguration
   ATTR_CONTEXT("context"),
   ATTR_NETWORK("network"),
   ATTR_EXCHANGE_DIRECTORY("exchange-directory"),
+  ATTR_THREADS("threads"),
   VALUE_FILTER_FIRST("filter-first"),
   VALUE_BROADCAST_FILTER("broadcast-filter"),
   VALUE_NO_FILTER("no-filter"),
+  VALUE_DISTRIBUTED("distributed"),
   VALUE_VTK ( "vtk" ),
   VALUE_VRML ( "vrml" ),
   _dimensions(0),
@@ -172,11 +174,15 @@ ParticipantConfiguration:: ParticipantConfiguration
   doc += "\"broadcast/filter\" strategy, which performs better for a very high number of ";
   doc += "processors. Both result in the same distribution (if the safety factor is sufficiently large).";
   doc += "For very asymmetric cases, the filter can also be switched off completely (\"no-filter\").";
+  doc += "For huge meshes, the \"distributed\" strategy avoids the global mesh on the master: ";
+  doc += "all ranks exchange bounding boxes and receive the mesh parts directly from the overlapping ranks ";
+  doc += "of the providing participant. It requires the distribution-type point-to-point.";
   attrGeoFilter.setDocumentation(doc);
   ValidatorEquals<std::string> valid1 ( VALUE_FILTER_FIRST );
   ValidatorEquals<std::string> valid2 ( VALUE_BROADCAST_FILTER);
   ValidatorEquals<std::string> valid3 ( VALUE_NO_FILTER);
-  attrGeoFilter.setValidator ( valid1 || valid2 || valid3);
+  ValidatorEquals<std::string> valid4 ( VALUE_DISTRIBUTED);
+  attrGeoFilter.setValidator ( valid1 || valid2 || valid3 || valid4);
   attrGeoFilter.setDefaultValue(VALUE_BROADCAST_FILTER);
   tagUseMesh.addAttribute(attrGeoFilter);
 
@@ -221,6 +227,14 @@ ParticipantConfiguration:: ParticipantConfiguration
     attrExchangeDirectory.setDefaultValue("");
     tagServer.addAttribute(attrExchangeDirectory);
 
+    XMLAttribute<int> attrThreads(ATTR_THREADS);
+    doc = "Number of threads of the server, which handle requests of different client ";
+    doc += "processes concurrently. Coupling operations, e.g. advance, are still executed ";
+    doc += "once all client processes requested them.";
+    attrThreads.setDocumentation(doc);
+    attrThreads.setDefaultValue(1);
+    tagServer.addAttribute(attrThreads);
+
     serverTags.push_back(tagServer);
   }
   {
@@ -239,6 +253,14 @@ ParticipantConfiguration:: ParticipantConfiguration
     attrExchangeDirectory.setDefaultValue("");
     tagServer.addAttribute(attrExchangeDirectory);
 
+    XMLAttribute<int> attrThreads(ATTR_THREADS);
+    doc = "Number of threads of the server, which handle requests of different client ";
+    doc += "processes concurrently. Requires an MPI library initialized with ";
+    doc += "MPI_THREAD_MULTIPLE, otherwise the server uses one thread.";
+    attrThreads.setDocumentation(doc);
+    attrThreads.setDefaultValue(1);
+    tagServer.addAttribute(attrThreads);
+
     serverTags.push_back(tagServer);
   }
   {
@@ -414,6 +436,12 @@ void ParticipantConfiguration:: xmlTagCallback
     com::CommunicationConfiguration comConfig;
     com::PtrCommunication com = comConfig.createCommunication(tag);
     _participants.back()->setClientServerCommunication(com);
+    if (tag.hasAttribute(ATTR_THREADS)){
+      int threads = tag.getIntAttributeValue(ATTR_THREADS);
+      CHECK(threads > 0, "Attribute \"" << ATTR_THREADS << "\" of tag <server:"
+            << tag.getName() << "/> has to be positive, but is " << threads);
+      _participants.back()->setServerThreads(threads);
+    }
   }
   else if (tag.getNamespace() == TAG_MASTER){
     com::CommunicationConfiguration comConfig;
@@ -457,6 +485,9 @@ partition::ReceivedPartition::GeometricFilter ParticipantConfiguration:: getGeoF
   else if (geoFilter == VALUE_BROADCAST_FILTER){
     return partition::ReceivedPartition::GeometricFilter::BROADCAST_FILTER;
   }
+  else if (geoFilter == VALUE_DISTRIBUTED){
+    return partition::ReceivedPartition::GeometricFilter::DISTRIBUTED;
+  }
   else {
     assertion(geoFilter == VALUE_NO_FILTER);
     return partition::ReceivedPartition::GeometricFilter::NO_FILTER;
@@ -101,10 +101,12 @@ private:
   const std::string ATTR_CONTEXT;
   const std::string ATTR_NETWORK;
   const std::string ATTR_EXCHANGE_DIRECTORY;
+  const std::string ATTR_THREADS;
 
   const std::string VALUE_FILTER_FIRST;
   const std::string VALUE_BROADCAST_FILTER;
   const std::string VALUE_NO_FILTER;
+  const std::string VALUE_DISTRIBUTED;
 
   const std::string VALUE_VTK;
   const std::string VALUE_VRML;
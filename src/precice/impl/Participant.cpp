@@ -37,6 +37,7 @@ Participant:: Participant
   _writeDataContexts (),
   _readDataContexts (),
   _clientServerCommunication (),
+  _serverThreads(1),
   _useMaster(false)
 {
   _participantsSize ++;
@@ -318,6 +319,19 @@ com::PtrCommunication Participant:: getClientServerCommunication() const
   return _clientServerCommunication;
 }
 
+void Participant:: setServerThreads
+(
+  int threads )
+{
+  assertion ( threads > 0, threads );
+  _serverThreads = threads;
+}
+
+int Participant:: getServerThreads() const
+{
+  return _serverThreads;
+}
+
 bool Participant:: useMaster()
 {
   return _useMaster;
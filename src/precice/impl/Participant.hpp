@@ -132,6 +132,11 @@ public:
 
   com::PtrCommunication getClientServerCommunication() const;
 
+  /// Sets the number of threads handling requests of different client ranks on the server.
+  void setServerThreads ( int threads );
+
+  int getServerThreads() const;
+
   /// Returns true, if the participant uses a master process.
   bool useMaster();
 
@@ -183,6 +188,8 @@ private:
 
   com::PtrCommunication _clientServerCommunication;
 
+  int _serverThreads;
+
   bool _useMaster;
 
   template<typename ELEMENT_T>
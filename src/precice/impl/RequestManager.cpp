@@ -3,10 +3,122 @@
 #include "cplscheme/CouplingScheme.hpp"
 #include "precice/impl/SolverInterfaceImpl.hpp"
 #include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <thread>
 
 namespace precice {
 namespace impl {
 
+namespace {
+
+/// Threads which handle single requests of client ranks, while the main thread polls for requests.
+/**
+ * Each client rank has at most one request posted at a time, since it waits for the server before
+ * sending the next request. Ranks whose request has been handled are collected by the main thread,
+ * which opens the receive of their next request ID.
+ */
+class RequestWorkers
+{
+public:
+  RequestWorkers (
+    int                           threads,
+    std::function<void(int,int)>  handler )
+  :
+    _handler(handler)
+  {
+    for (int i = 0; i < threads; i++){
+      _threads.emplace_back([this]{ work(); });
+    }
+  }
+
+  ~RequestWorkers()
+  {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _stop = true;
+    }
+    _posted.notify_all();
+    for (std::thread& thread : _threads){
+      thread.join();
+    }
+  }
+
+  /// Handles the request with given ID from the given client rank on the next free thread.
+  void post ( int requestID, int rankSender )
+  {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _tasks.emplace_back(requestID, rankSender);
+      _pending++;
+    }
+    _posted.notify_one();
+  }
+
+  /// Returns the client ranks whose requests have been handled since the last call.
+  std::vector<int> collectFinished()
+  {
+    std::vector<int> finished;
+    std::lock_guard<std::mutex> lock(_mutex);
+    std::swap(finished, _finished);
+    return finished;
+  }
+
+  /// Blocks until all posted requests are handled.
+  void waitIdle()
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _idle.wait(lock, [this]{ return _pending == 0; });
+  }
+
+private:
+  std::function<void(int,int)> _handler;
+
+  std::vector<std::thread> _threads;
+
+  std::mutex _mutex;
+
+  std::condition_variable _posted;
+
+  std::condition_variable _idle;
+
+  /// Pairs of request ID and client rank.
+  std::deque<std::pair<int,int>> _tasks;
+
+  std::vector<int> _finished;
+
+  int _pending = 0;
+
+  bool _stop = false;
+
+  void work()
+  {
+    while (true){
+      std::pair<int,int> task;
+      {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _posted.wait(lock, [this]{ return _stop || not _tasks.empty(); });
+        if (_tasks.empty()){
+          return;
+        }
+        task = _tasks.front();
+        _tasks.pop_front();
+      }
+      _handler(task.first, task.second);
+      {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _finished.push_back(task.second);
+        _pending--;
+      }
+      _idle.notify_all();
+    }
+  }
+};
+
+}
+
 logging::Logger RequestManager::_log("impl::RequestManager");
 
 RequestManager:: RequestManager
@@ -20,9 +132,11 @@ RequestManager:: RequestManager
   _couplingScheme(couplingScheme)
 {}
 
-void RequestManager:: handleRequests()
+void RequestManager:: handleRequests
+(
+  int threads )
 {
-  TRACE();
+  TRACE(threads);
   int clientCommSize = _com->getRemoteCommunicatorSize();
   int clientCounter = 0;
   std::list<int> clientRanks;
@@ -35,13 +149,32 @@ void RequestManager:: handleRequests()
      requests[clientRank] = _com->aReceive(&(requestIDs[clientRank]), clientRank);
   }
 
+  // Single requests of different client ranks are handled concurrently, collective
+  // requests only when all ranks have requested them and no single request is pending.
+  std::unique_ptr<RequestWorkers> workers;
+  if (std::min(threads, clientCommSize) > 1){
+    DEBUG("Handle requests on " << std::min(threads, clientCommSize) << " threads");
+    workers.reset(new RequestWorkers(std::min(threads, clientCommSize),
+                                     [this](int requestID, int rankSender){
+                                       handleSingleRequest(requestID, rankSender);
+                                     }));
+  }
+  std::vector<bool> busy(clientCommSize, false);
+
   int rankSender = 0;
   int requestID = -1;
   bool collectiveRequest = false;
   bool singleRequest = false;
   while(true){
+    if (workers){
+      for (int rank : workers->collectFinished()){
+        requestIDs[rank] = -1;
+        requests[rank] = _com->aReceive(&(requestIDs[rank]), rank);
+        busy[rank] = false;
+      }
+    }
     if((std::find(clientRanks.begin(), clientRanks.end(), rankSender) == clientRanks.end()) &&
-                       requests[rankSender]->test()){
+       not busy[rankSender] && requests[rankSender]->test()){
       requestID = requestIDs[rankSender];
       preciceCheck(requestID != -1, "handleRequest()", "Receiving of request ID failed");
       DEBUG("Received request ID " << requestID << " from rank " << rankSender);
@@ -59,6 +192,7 @@ void RequestManager:: handleRequests()
       assertion(clientCounter <= clientCommSize, clientCounter, clientCommSize);
       clientRanks.push_front(rankSender);
       if (clientCounter == clientCommSize){
+        if (workers) workers->waitIdle();
         handleRequestInitialze(clientRanks);
         collectiveRequest = true;
       }
@@ -69,6 +203,7 @@ void RequestManager:: handleRequests()
       assertion(clientCounter <= clientCommSize, clientCounter, clientCommSize);
       clientRanks.push_front(rankSender);
       if (clientCounter == clientCommSize){
+        if (workers) workers->waitIdle();
         handleRequestInitialzeData(clientRanks);
         collectiveRequest = true;
       }
@@ -79,6 +214,7 @@ void RequestManager:: handleRequests()
       assertion(clientCounter <= clientCommSize, clientCounter, clientCommSize);
       clientRanks.push_front(rankSender);
       if (clientCounter == clientCommSize){
+        if (workers) workers->waitIdle();
         handleRequestAdvance(clientRanks);
         collectiveRequest = true;
       }
@@ -89,97 +225,20 @@ void RequestManager:: handleRequests()
       assertion(clientCounter <= clientCommSize, clientCounter, clientCommSize);
       clientRanks.push_front(rankSender);
       if (clientCounter == clientCommSize){
+        if (workers) workers->waitIdle();
         handleRequestFinalize();
         clientCounter = 0;
         clientRanks.clear();
         return;
       }
       break;
-    case REQUEST_FULFILLED_ACTION:
-      handleRequestFulfilledAction(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_SET_MESH_VERTEX:
-      handleRequestSetMeshVertex(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_GET_MESH_VERTEX_SIZE:
-      handleRequestGetMeshVertexSize(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_RESET_MESH:
-      handleRequestResetMesh(rankSender);
-      break;
-    case REQUEST_SET_MESH_VERTICES:
-      handleRequestSetMeshVertices(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_GET_MESH_VERTICES:
-      handleRequestGetMeshVertices(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_GET_MESH_VERTEX_IDS_FROM_POSITIONS:
-      handleRequestGetMeshVertexIDsFromPositions(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_SET_MESH_EDGE:
-      handleRequestSetMeshEdge(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_SET_MESH_TRIANGLE:
-      handleRequestSetMeshTriangle(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_SET_MESH_TRIANGLE_WITH_EDGES:
-      handleRequestSetMeshTriangleWithEdges(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_SET_MESH_QUAD:
-      handleRequestSetMeshQuad(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_SET_MESH_QUAD_WITH_EDGES:
-      handleRequestSetMeshQuadWithEdges(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_WRITE_BLOCK_SCALAR_DATA:
-      handleRequestWriteBlockScalarData(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_WRITE_SCALAR_DATA:
-      handleRequestWriteScalarData(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_WRITE_BLOCK_VECTOR_DATA:
-      handleRequestWriteBlockVectorData(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_WRITE_VECTOR_DATA:
-      handleRequestWriteVectorData(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_READ_BLOCK_SCALAR_DATA:
-      handleRequestReadBlockScalarData(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_READ_SCALAR_DATA:
-      handleRequestReadScalarData(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_READ_VETOR_DATA:
-      handleRequestReadVectorData(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_READ_BLOCK_VECTOR_DATA:
-      handleRequestReadBlockVectorData(rankSender);
-      singleRequest = true;
-      break;
     case REQUEST_MAP_WRITE_DATA_FROM:
       DEBUG("Request map written data by rank " << rankSender);
       clientCounter++;
       assertion(clientCounter <= clientCommSize, clientCounter, clientCommSize);
       clientRanks.push_front(rankSender);
       if (clientCounter == clientCommSize){
+        if (workers) workers->waitIdle();
         handleRequestMapWriteDataFrom(clientRanks);
         collectiveRequest = true;
       }
@@ -190,17 +249,20 @@ void RequestManager:: handleRequests()
       assertion(clientCounter <= clientCommSize, clientCounter, clientCommSize);
       clientRanks.push_front(rankSender);
       if (clientCounter == clientCommSize){
+        if (workers) workers->waitIdle();
         handleRequestMapReadDataTo(clientRanks);
         collectiveRequest = true;
       }
       break;
-    case REQUEST_PING:
-      //bool ping = true;
-      _com->send(true, rankSender);
-      singleRequest = true;
-      break;
     default:
-      ERROR("Unknown RequestID \"" << requestID << "\"");
+      if (workers){
+        busy[rankSender] = true;
+        workers->post(requestID, rankSender);
+      }
+      else {
+        handleSingleRequest(requestID, rankSender);
+        singleRequest = true;
+      }
       break;
     }
 
@@ -226,10 +288,63 @@ void RequestManager:: handleRequests()
     if(rankSender==clientCommSize) rankSender = 0;
   }
 }
+
+void RequestManager:: handleSingleRequest
+(
+  int requestID,
+  int rankSender )
+{
+  switch (requestID){
+  case REQUEST_FULFILLED_ACTION:
+    handleRequestFulfilledAction(rankSender);
+    break;
+  case REQUEST_SET_MESH_VERTEX:
+    handleRequestSetMeshVertex(rankSender);
+    break;
+  case REQUEST_GET_MESH_VERTEX_SIZE:
+    handleRequestGetMeshVertexSize(rankSender);
+    break;
+  case REQUEST_SET_MESH_VERTICES:
+    handleRequestSetMeshVertices(rankSender);
+    break;
+  case REQUEST_GET_MESH_VERTICES:
+    handleRequestGetMeshVertices(rankSender);
+    break;
+  case REQUEST_GET_MESH_VERTEX_IDS_FROM_POSITIONS:
+    handleRequestGetMeshVertexIDsFromPositions(rankSender);
+    break;
+  case REQUEST_BATCH:
+    handleRequestBatch(rankSender);
+    break;
+  case REQUEST_SET_MESH_EDGE:
+    handleRequestSetMeshEdge(rankSender);
+    break;
+  case REQUEST_READ_BLOCK_SCALAR_DATA:
+    handleRequestReadBlockScalarData(rankSender);
+    break;
+  case REQUEST_READ_SCALAR_DATA:
+    handleRequestReadScalarData(rankSender);
+    break;
+  case REQUEST_READ_VETOR_DATA:
+    handleRequestReadVectorData(rankSender);
+    break;
+  case REQUEST_READ_BLOCK_VECTOR_DATA:
+    handleRequestReadBlockVectorData(rankSender);
+    break;
+  case REQUEST_PING:
+    //bool ping = true;
+    _com->send(true, rankSender);
+    break;
+  default:
+    ERROR("Unknown RequestID \"" << requestID << "\"");
+    break;
+  }
+}
+
 void RequestManager:: requestPing()
 {
   TRACE();
-  _com->send(REQUEST_PING, 0);
+  sendRequest(REQUEST_PING);
   int dummy = 0;
   _com->receive(dummy, 0);
 }
@@ -237,14 +352,14 @@ void RequestManager:: requestPing()
 void RequestManager:: requestInitialize()
 {
   TRACE();
-  _com->send(REQUEST_INITIALIZE, 0);
+  sendRequest(REQUEST_INITIALIZE);
   _couplingScheme->receiveState(_com, 0);
 }
 
 void RequestManager:: requestInitialzeData()
 {
   TRACE();
-  _com->send(REQUEST_INITIALIZE_DATA, 0);
+  sendRequest(REQUEST_INITIALIZE_DATA);
   _couplingScheme->receiveState(_com, 0);
 }
 
@@ -253,7 +368,7 @@ void RequestManager:: requestAdvance
   double dt )
 {
   TRACE();
-  _com->send(REQUEST_ADVANCE, 0);
+  sendRequest(REQUEST_ADVANCE);
   _com->send(dt, 0);
   _couplingScheme->receiveState(_com, 0);
 }
@@ -261,7 +376,7 @@ void RequestManager:: requestAdvance
 void RequestManager:: requestFinalize()
 {
   TRACE();
-  _com->send(REQUEST_FINALIZE, 0);
+  sendRequest(REQUEST_FINALIZE);
 }
 
 
@@ -270,7 +385,7 @@ void RequestManager:: requestFulfilledAction
   const std::string& action )
 {
   TRACE();
-  _com->send(REQUEST_FULFILLED_ACTION, 0);
+  sendRequest(REQUEST_FULFILLED_ACTION);
   _com->send(action, 0);
 }
 
@@ -280,7 +395,7 @@ int RequestManager:: requestSetMeshVertex
   Eigen::VectorXd& position )
 {
   TRACE();
-  _com->send(REQUEST_SET_MESH_VERTEX, 0);
+  sendRequest(REQUEST_SET_MESH_VERTEX);
   _com->send(meshID, 0);
   _com->send(position.data(), position.size(), 0);
   int index = -1;
@@ -293,7 +408,7 @@ int RequestManager:: requestGetMeshVertexSize
   int meshID )
 {
   TRACE(meshID);
-  _com->send(REQUEST_GET_MESH_VERTEX_SIZE, 0);
+  sendRequest(REQUEST_GET_MESH_VERTEX_SIZE);
   _com->send(meshID, 0);
   int size = -1;
   _com->receive(size, 0);
@@ -305,8 +420,9 @@ void RequestManager:: requestResetMesh
   int meshID )
 {
   TRACE(meshID);
-  _com->send(REQUEST_RESET_MESH, 0);
-  _com->send(meshID, 0);
+  _batchInts.push_back(REQUEST_RESET_MESH);
+  _batchInts.push_back(meshID);
+  queueRequest();
 }
 
 void RequestManager:: requestSetMeshVertices
@@ -317,7 +433,7 @@ void RequestManager:: requestSetMeshVertices
   int*    ids )
 {
   TRACE();
-  _com->send(REQUEST_SET_MESH_VERTICES, 0);
+  sendRequest(REQUEST_SET_MESH_VERTICES);
   _com->send(meshID, 0);
   _com->send(size, 0);
   _com->send(positions, size*_interface.getDimensions(), 0);
@@ -332,7 +448,7 @@ void RequestManager:: requestGetMeshVertices
   double* positions )
 {
   TRACE();
-  _com->send(REQUEST_GET_MESH_VERTICES, 0);
+  sendRequest(REQUEST_GET_MESH_VERTICES);
   _com->send(meshID, 0);
   _com->send(size, 0);
   _com->send(ids, size, 0);
@@ -347,7 +463,7 @@ void RequestManager:: requestGetMeshVertexIDsFromPositions
   int*    ids )
 {
   TRACE(size);
-  _com->send(REQUEST_GET_MESH_VERTEX_IDS_FROM_POSITIONS, 0);
+  sendRequest(REQUEST_GET_MESH_VERTEX_IDS_FROM_POSITIONS);
   _com->send(meshID, 0);
   _com->send(size, 0);
   _com->send(positions, size*_interface.getDimensions(), 0);
@@ -362,7 +478,7 @@ int RequestManager:: requestSetMeshEdge
   int secondVertexID )
 {
   TRACE(meshID, firstVertexID, secondVertexID);
-  _com->send(REQUEST_SET_MESH_EDGE, 0);
+  sendRequest(REQUEST_SET_MESH_EDGE);
   int data[3] = { meshID, firstVertexID, secondVertexID };
   _com->send(data, 3, 0);
   int createdEdgeID = -1;
@@ -378,9 +494,8 @@ void RequestManager:: requestSetMeshTriangle
   int thirdEdgeID )
 {
   TRACE(meshID, firstEdgeID, secondEdgeID, thirdEdgeID);
-  _com->send(REQUEST_SET_MESH_TRIANGLE, 0);
-  int data[4] = {meshID, firstEdgeID, secondEdgeID, thirdEdgeID};
-  _com->send(data, 4, 0);
+  _batchInts.insert(_batchInts.end(), {REQUEST_SET_MESH_TRIANGLE, meshID, firstEdgeID, secondEdgeID, thirdEdgeID});
+  queueRequest();
 }
 
 void RequestManager:: requestSetMeshTriangleWithEdges
@@ -392,9 +507,8 @@ void RequestManager:: requestSetMeshTriangleWithEdges
 {
   TRACE(meshID, firstVertexID,
                 secondVertexID, thirdVertexID);
-  _com->send(REQUEST_SET_MESH_TRIANGLE_WITH_EDGES, 0);
-  int data[4] = {meshID, firstVertexID, secondVertexID, thirdVertexID};
-  _com->send(data, 4, 0);
+  _batchInts.insert(_batchInts.end(), {REQUEST_SET_MESH_TRIANGLE_WITH_EDGES, meshID, firstVertexID, secondVertexID, thirdVertexID});
+  queueRequest();
 }
 
 void RequestManager:: requestSetMeshQuad
@@ -406,9 +520,8 @@ void RequestManager:: requestSetMeshQuad
   int fourthEdgeID )
 {
   TRACE(meshID, firstEdgeID, secondEdgeID, thirdEdgeID, fourthEdgeID);
-  _com->send(REQUEST_SET_MESH_QUAD, 0);
-  int data[5] = {meshID, firstEdgeID, secondEdgeID, thirdEdgeID, fourthEdgeID};
-  _com->send(data, 5, 0);
+  _batchInts.insert(_batchInts.end(), {REQUEST_SET_MESH_QUAD, meshID, firstEdgeID, secondEdgeID, thirdEdgeID, fourthEdgeID});
+  queueRequest();
 }
 
 void RequestManager:: requestSetMeshQuadWithEdges
@@ -420,9 +533,8 @@ void RequestManager:: requestSetMeshQuadWithEdges
   int fourthVertexID )
 {
   TRACE(meshID, firstVertexID, secondVertexID, thirdVertexID, fourthVertexID);
-  _com->send(REQUEST_SET_MESH_QUAD_WITH_EDGES, 0);
-  int data[5] = {meshID, firstVertexID, secondVertexID, thirdVertexID, fourthVertexID};
-  _com->send(data, 5, 0);
+  _batchInts.insert(_batchInts.end(), {REQUEST_SET_MESH_QUAD_WITH_EDGES, meshID, firstVertexID, secondVertexID, thirdVertexID, fourthVertexID});
+  queueRequest();
 }
 
 void RequestManager:: requestWriteBlockScalarData (
@@ -432,11 +544,10 @@ void RequestManager:: requestWriteBlockScalarData (
   double* values )
 {
   TRACE(dataID, size);
-  _com->send(REQUEST_WRITE_BLOCK_SCALAR_DATA, 0);
-  _com->send(dataID, 0);
-  _com->send(size, 0);
-  _com->send(valueIndices, size, 0);
-  _com->send(values, size, 0);
+  _batchInts.insert(_batchInts.end(), {REQUEST_WRITE_BLOCK_SCALAR_DATA, dataID, size});
+  _batchInts.insert(_batchInts.end(), valueIndices, valueIndices + size);
+  _batchDoubles.insert(_batchDoubles.end(), values, values + size);
+  queueRequest();
 }
 
 void RequestManager:: requestWriteScalarData
@@ -446,10 +557,9 @@ void RequestManager:: requestWriteScalarData
   double value )
 {
   TRACE();
-  _com->send(REQUEST_WRITE_SCALAR_DATA, 0);
-  _com->send(dataID, 0);
-  _com->send(valueIndex, 0);
-  _com->send(value, 0);
+  _batchInts.insert(_batchInts.end(), {REQUEST_WRITE_SCALAR_DATA, dataID, valueIndex});
+  _batchDoubles.push_back(value);
+  queueRequest();
 }
 
 void RequestManager:: requestWriteBlockVectorData (
@@ -459,11 +569,10 @@ void RequestManager:: requestWriteBlockVectorData (
   double* values )
 {
   TRACE(dataID);
-  _com->send(REQUEST_WRITE_BLOCK_VECTOR_DATA, 0);
-  _com->send(dataID, 0);
-  _com->send(size, 0);
-  _com->send(valueIndices, size, 0);
-  _com->send(values, size*_interface.getDimensions(), 0);
+  _batchInts.insert(_batchInts.end(), {REQUEST_WRITE_BLOCK_VECTOR_DATA, dataID, size});
+  _batchInts.insert(_batchInts.end(), valueIndices, valueIndices + size);
+  _batchDoubles.insert(_batchDoubles.end(), values, values + size*_interface.getDimensions());
+  queueRequest();
 }
 
 void RequestManager:: requestWriteVectorData
@@ -473,10 +582,9 @@ void RequestManager:: requestWriteVectorData
   double* value )
 {
   TRACE();
-  _com->send(REQUEST_WRITE_VECTOR_DATA, 0);
-  _com->send(dataID, 0);
-  _com->send(valueIndex, 0);
-  _com->send(value, _interface.getDimensions(), 0);
+  _batchInts.insert(_batchInts.end(), {REQUEST_WRITE_VECTOR_DATA, dataID, valueIndex});
+  _batchDoubles.insert(_batchDoubles.end(), value, value + _interface.getDimensions());
+  queueRequest();
 }
 
 void RequestManager:: requestReadBlockScalarData (
@@ -486,7 +594,7 @@ void RequestManager:: requestReadBlockScalarData (
   double* values )
 {
   TRACE(dataID, size);
-  _com->send(REQUEST_READ_BLOCK_SCALAR_DATA, 0);
+  sendRequest(REQUEST_READ_BLOCK_SCALAR_DATA);
   _com->send(dataID, 0);
   _com->send(size, 0);
   _com->send(valueIndices, size, 0);
@@ -500,7 +608,7 @@ void RequestManager:: requestReadScalarData
   double& value )
 {
   TRACE();
-  _com->send(REQUEST_READ_SCALAR_DATA, 0);
+  sendRequest(REQUEST_READ_SCALAR_DATA);
   _com->send(dataID, 0);
   _com->send(valueIndex, 0);
   _com->receive(value, 0);
@@ -514,7 +622,7 @@ void RequestManager:: requestReadBlockVectorData
   double* values )
 {
   TRACE(dataID, size);
-  _com->send(REQUEST_READ_BLOCK_VECTOR_DATA, 0);
+  sendRequest(REQUEST_READ_BLOCK_VECTOR_DATA);
   _com->send(dataID, 0);
   _com->send(size, 0);
   _com->send(valueIndices, size, 0);
@@ -528,7 +636,7 @@ void RequestManager:: requestReadVectorData
   double* value )
 {
   TRACE();
-  _com->send(REQUEST_READ_VETOR_DATA, 0);
+  sendRequest(REQUEST_READ_VETOR_DATA);
   _com->send(dataID, 0);
   _com->send(valueIndex, 0);
   _com->receive(value, _interface.getDimensions(), 0);
@@ -539,7 +647,7 @@ void RequestManager:: requestMapWriteDataFrom
   int fromMeshID )
 {
   TRACE(fromMeshID);
-  _com->send(REQUEST_MAP_WRITE_DATA_FROM, 0);
+  sendRequest(REQUEST_MAP_WRITE_DATA_FROM);
   int ping;
   _com->receive(ping, 0);
   _com->send(fromMeshID, 0);
@@ -550,12 +658,46 @@ void RequestManager:: requestMapReadDataTo
   int toMeshID )
 {
   TRACE(toMeshID);
-  _com->send(REQUEST_MAP_READ_DATA_TO, 0);
+  sendRequest(REQUEST_MAP_READ_DATA_TO);
   int ping;
   _com->receive(ping, 0);
   _com->send(toMeshID, 0);
 }
 
+void RequestManager:: queueRequest()
+{
+  // Bounds the memory of the queue, if no request with result follows for long
+  const size_t maxBatchSize = 1 << 16;
+  if (_batchInts.size() + _batchDoubles.size() > maxBatchSize){
+    flushBatch();
+  }
+}
+
+void RequestManager:: sendRequest
+(
+  int requestID )
+{
+  flushBatch();
+  _com->send(requestID, 0);
+}
+
+void RequestManager:: flushBatch()
+{
+  if (_batchInts.empty()){
+    return;
+  }
+  TRACE(_batchInts.size(), _batchDoubles.size());
+  _com->send(REQUEST_BATCH, 0);
+  int sizes[2] = {(int) _batchInts.size(), (int) _batchDoubles.size()};
+  _com->send(sizes, 2, 0);
+  _com->send(_batchInts.data(), sizes[0], 0);
+  if (sizes[1] > 0){
+    _com->send(_batchDoubles.data(), sizes[1], 0);
+  }
+  _batchInts.clear();
+  _batchDoubles.clear();
+}
+
 void RequestManager:: handleRequestInitialze
 (
   const std::list<int>& clientRanks )
@@ -613,6 +755,7 @@ void RequestManager:: handleRequestFulfilledAction
   TRACE(rankSender);
   std::string action;
   _com->receive(action, rankSender);
+  std::lock_guard<std::mutex> lock(_interfaceMutex);
   _interface.fulfilledAction(action);
 }
 
@@ -625,7 +768,9 @@ void RequestManager:: handleRequestSetMeshVertex
   _com->receive(meshID, rankSender);
   double position[_interface.getDimensions()];
   _com->receive(position, _interface.getDimensions(), rankSender);
+  std::unique_lock<std::mutex> lock(_interfaceMutex);
   int index = _interface.setMeshVertex(meshID, position);
+  lock.unlock();
   _com->send(index, rankSender);
 }
 
@@ -636,20 +781,12 @@ void RequestManager:: handleRequestGetMeshVertexSize
   TRACE(rankSender);
   int meshID = -1;
   _com->receive(meshID, rankSender);
+  std::unique_lock<std::mutex> lock(_interfaceMutex);
   int size = _interface.getMeshVertexSize(meshID);
+  lock.unlock();
   _com->send(size, rankSender);
 }
 
-void RequestManager:: handleRequestResetMesh
-(
-  int rankSender )
-{
-  TRACE(rankSender);
-  int meshID = -1;
-  _com->receive(meshID, rankSender);
-  _interface.resetMesh(meshID);
-}
-
 
 void RequestManager:: handleRequestSetMeshVertices
 (
@@ -665,7 +802,9 @@ void RequestManager:: handleRequestSetMeshVertices
   double* positions = new double[size*_interface.getDimensions()];
   _com->receive(positions, size*_interface.getDimensions(), rankSender);
   int* ids = new int[size];
+  std::unique_lock<std::mutex> lock(_interfaceMutex);
   _interface.setMeshVertices(meshID, size, positions, ids);
+  lock.unlock();
   _com->send(ids, size, rankSender);
   delete[] positions;
   delete[] ids;
@@ -684,7 +823,9 @@ void RequestManager:: handleRequestGetMeshVertices
   int* ids = new int[size];
   double* positions = new double[size*_interface.getDimensions()];
   _com->receive(ids, size, rankSender);
+  std::unique_lock<std::mutex> lock(_interfaceMutex);
   _interface.getMeshVertices(meshID, size, ids, positions);
+  lock.unlock();
   _com->send(positions, size*_interface.getDimensions(), rankSender);
   delete[] ids;
   delete[] positions;
@@ -703,7 +844,9 @@ void RequestManager:: handleRequestGetMeshVertexIDsFromPositions
   int* ids = new int[size];
   double* positions = new double[size*_interface.getDimensions()];
   _com->receive(positions, size*_interface.getDimensions(), rankSender);
+  std::unique_lock<std::mutex> lock(_interfaceMutex);
   _interface.getMeshVertexIDsFromPositions(meshID, size, positions, ids);
+  lock.unlock();
   _com->send(ids, size, rankSender);
   delete[] ids;
   delete[] positions;
@@ -716,112 +859,83 @@ void RequestManager:: handleRequestSetMeshEdge
   TRACE(rankSender);
   int data[3]; // 0: meshID, 1: firstVertexID, 2: secondVertexID
   _com->receive(data, 3, rankSender);
+  std::unique_lock<std::mutex> lock(_interfaceMutex);
   int createEdgeID = _interface.setMeshEdge(data[0], data[1], data[2]);
+  lock.unlock();
   _com->send(createEdgeID, rankSender);
 }
 
-void RequestManager:: handleRequestSetMeshTriangle
-(
-  int rankSender )
-{
-  TRACE(rankSender);
-  int data[4]; // 0: meshID, 1,2,3: edge IDs
-  _com->receive(data, 4, rankSender);
-  _interface.setMeshTriangle(data[0], data[1], data[2], data[3]);
-}
-
-void RequestManager:: handleRequestSetMeshTriangleWithEdges
-(
-  int rankSender )
-{
-  TRACE(rankSender);
-  int data[4]; // 0: meshID, 1,2,3: vertex IDs
-  _com->receive(data, 4, rankSender);
-  _interface.setMeshTriangleWithEdges(data[0], data[1], data[2], data[3]);
-}
-
-void RequestManager:: handleRequestSetMeshQuad
-(
-  int rankSender )
-{
-  TRACE(rankSender);
-  int data[5]; // 0: meshID, 1,2,3,4: edge IDs
-  _com->receive(data, 5, rankSender);
-  _interface.setMeshQuad(data[0], data[1], data[2], data[3], data[4]);
-}
-
-void RequestManager:: handleRequestSetMeshQuadWithEdges
-(
-  int rankSender )
-{
-  TRACE(rankSender);
-  int data[5]; // 0: meshID, 1,2,3,4: vertex IDs
-  _com->receive(data, 5, rankSender);
-  _interface.setMeshQuadWithEdges(data[0], data[1], data[2], data[3], data[4]);
-}
-
-void RequestManager:: handleRequestWriteScalarData
-(
-  int rankSender )
-{
-  TRACE(rankSender);
-  int dataID = -1;
-  _com->receive(dataID, rankSender);
-  int index = -1;
-  _com->receive(index, rankSender);
-  double data;
-  _com->receive(data, rankSender);
-  _interface.writeScalarData(dataID, index, data);
-}
-
-void RequestManager:: handleRequestWriteBlockScalarData
-(
-  int rankSender )
-{
-  TRACE(rankSender);
-  int dataID = -1;
-  _com->receive(dataID, rankSender);
-  int size = -1;
-  _com->receive(size, rankSender);
-  int* indices = new int[size];
-  _com->receive(indices, size, rankSender);
-  double* data = new double[size];
-  _com->receive(data, size, rankSender);
-  _interface.writeBlockScalarData(dataID, size, indices, data);
-  delete[] indices;
-  delete[] data;
-}
-
-void RequestManager:: handleRequestWriteBlockVectorData
+void RequestManager:: handleRequestBatch
 (
   int rankSender )
 {
   TRACE(rankSender);
-  int dataID = -1;
-  _com->receive(dataID, rankSender);
-  int size = -1;
-  _com->receive(size, rankSender);
-  int* indices = new int[size];
-  _com->receive(indices, size, rankSender);
-  double* data = new double[size*_interface.getDimensions()];
-  _com->receive(data, size*_interface.getDimensions(), rankSender);
-  _interface.writeBlockVectorData(dataID, size, indices, data);
-  delete[] indices;
-  delete[] data;
-}
-
-void RequestManager:: handleRequestWriteVectorData
-(
-  int rankSender )
-{
-  TRACE(rankSender);
-  int dataID = -1;
-  _com->receive(dataID, rankSender);
-  int index = -1;
-  _com->receive( index, rankSender);
-  double data[_interface.getDimensions()];
-  _com->receive(data, _interface.getDimensions(), rankSender);
-  _interface.writeVectorData(dataID, index, data);
+  int sizes[2]; // 0: number of ints, 1: number of doubles
+  _com->receive(sizes, 2, rankSender);
+  std::vector<int> ints(sizes[0]);
+  _com->receive(ints.data(), sizes[0], rankSender);
+  std::vector<double> doubles(sizes[1]);
+  if (sizes[1] > 0){
+    _com->receive(doubles.data(), sizes[1], rankSender);
+  }
+  int dim = _interface.getDimensions();
+  int* in = ints.data();
+  int* inEnd = in + ints.size();
+  double* values = doubles.data();
+  std::lock_guard<std::mutex> lock(_interfaceMutex);
+  while (in != inEnd){
+    int requestID = *in++;
+    switch (requestID){
+    case REQUEST_RESET_MESH:
+      _interface.resetMesh(in[0]);
+      in += 1;
+      break;
+    case REQUEST_SET_MESH_TRIANGLE:
+      _interface.setMeshTriangle(in[0], in[1], in[2], in[3]);
+      in += 4;
+      break;
+    case REQUEST_SET_MESH_TRIANGLE_WITH_EDGES:
+      _interface.setMeshTriangleWithEdges(in[0], in[1], in[2], in[3]);
+      in += 4;
+      break;
+    case REQUEST_SET_MESH_QUAD:
+      _interface.setMeshQuad(in[0], in[1], in[2], in[3], in[4]);
+      in += 5;
+      break;
+    case REQUEST_SET_MESH_QUAD_WITH_EDGES:
+      _interface.setMeshQuadWithEdges(in[0], in[1], in[2], in[3], in[4]);
+      in += 5;
+      break;
+    case REQUEST_WRITE_SCALAR_DATA:
+      _interface.writeScalarData(in[0], in[1], *values);
+      in += 2;
+      values += 1;
+      break;
+    case REQUEST_WRITE_VECTOR_DATA:
+      _interface.writeVectorData(in[0], in[1], values);
+      in += 2;
+      values += dim;
+      break;
+    case REQUEST_WRITE_BLOCK_SCALAR_DATA: {
+      int size = in[1];
+      _interface.writeBlockScalarData(in[0], size, in + 2, values);
+      in += 2 + size;
+      values += size;
+      break;
+    }
+    case REQUEST_WRITE_BLOCK_VECTOR_DATA: {
+      int size = in[1];
+      _interface.writeBlockVectorData(in[0], size, in + 2, values);
+      in += 2 + size;
+      values += size * dim;
+      break;
+    }
+    default:
+      ERROR("Unknown RequestID \"" << requestID << "\" in batch from client " << rankSender);
+    }
+    assertion(in <= inEnd);
+  }
+  assertion(values == doubles.data() + doubles.size());
 }
 
 void RequestManager:: handleRequestReadScalarData
@@ -834,7 +948,9 @@ void RequestManager:: handleRequestReadScalarData
   int index = -1;
   _com->receive(index, rankSender);
   double data;
+  std::unique_lock<std::mutex> lock(_interfaceMutex);
   _interface.readScalarData(dataID, index, data);
+  lock.unlock();
   _com->send(data, rankSender); // Send back result
 }
 
@@ -850,7 +966,9 @@ void RequestManager:: handleRequestReadBlockScalarData
   int* indices = new int[size];
   _com->receive(indices, size, rankSender);
   double* data = new double[size];
+  std::unique_lock<std::mutex> lock(_interfaceMutex);
   _interface.readBlockScalarData(dataID, size, indices, data);
+  lock.unlock();
   _com->send(data, size, rankSender);
   delete[] indices;
   delete[] data;
@@ -868,7 +986,9 @@ void RequestManager:: handleRequestReadBlockVectorData
   int* indices = new int[size];
   _com->receive(indices, size, rankSender);
   double* data = new double[size*_interface.getDimensions()];
+  std::unique_lock<std::mutex> lock(_interfaceMutex);
   _interface.readBlockVectorData(dataID, size, indices, data);
+  lock.unlock();
   _com->send(data, size*_interface.getDimensions(), rankSender);
   delete[] indices;
   delete[] data;
@@ -884,7 +1004,9 @@ void RequestManager:: handleRequestReadVectorData
   int index = -1;
   _com->receive(index, rankSender);
   double data[_interface.getDimensions()];
+  std::unique_lock<std::mutex> lock(_interfaceMutex);
   _interface.readVectorData(dataID, index, data);
+  lock.unlock();
   _com->send(data, _interface.getDimensions(), rankSender);
 }
 
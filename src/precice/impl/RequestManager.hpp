@@ -5,6 +5,8 @@
 #include "logging/Logger.hpp"
 #include <set>
 #include <list>
+#include <mutex>
+#include <vector>
 #include <Eigen/Core>
 
 namespace precice {
@@ -17,6 +19,13 @@ namespace precice {
 namespace impl {
 
 /// Takes requests from clients and handles requests on server side.
+/**
+ * Requests without a result, e.g. writing data or setting mesh elements, are
+ * queued on the client and sent as one batch before the next request with a
+ * result or collective request, e.g. advance. The server executes a batch in
+ * one pass. Errors of queued requests are therefore reported by the server
+ * only when the batch is sent.
+ */
 class RequestManager
 {
 public:
@@ -28,8 +37,15 @@ public:
 
   /**
    * @brief Redirects all requests from client to corresponding handle methods.
+   *
+   * With more than one thread, requests of different client ranks are received
+   * and answered concurrently, calls to the solver interface are serialized.
+   * Collective requests, e.g. advance, are handled by the calling thread once
+   * all client ranks requested them and no other request is pending.
+   *
+   * @param[in] threads Number of threads handling requests, at most one per client rank is used.
    */
-  void handleRequests();
+  void handleRequests ( int threads = 1 );
 
   /**
    * @brief Pings server.
@@ -261,6 +277,7 @@ private:
     REQUEST_READ_BLOCK_VECTOR_DATA,
     REQUEST_MAP_WRITE_DATA_FROM,
     REQUEST_MAP_READ_DATA_TO,
+    REQUEST_BATCH,
     REQUEST_PING // Used in tests only
   };
 
@@ -272,6 +289,32 @@ private:
 
   cplscheme::PtrCouplingScheme _couplingScheme;
 
+  /// Integer arguments, starting with the request ID, of the queued requests.
+  std::vector<int> _batchInts;
+
+  /// Floating point arguments of the queued requests.
+  std::vector<double> _batchDoubles;
+
+  /// Serializes calls to the solver interface of requests handled concurrently.
+  std::mutex _interfaceMutex;
+
+  /// Handles a request which involves only the given client rank.
+  void handleSingleRequest ( int requestID, int rankSender );
+
+  /// Sends the queued requests, if the batch has grown large.
+  void queueRequest();
+
+  /// Sends the queued requests, followed by the given request ID.
+  void sendRequest(int requestID);
+
+  /// Sends the queued requests as one batch.
+  void flushBatch();
+
+  /**
+   * @brief Handles a batch of queued requests from client.
+   */
+  void handleRequestBatch ( int rankSender );
+
   /**
    * @brief Handles request initialize from client.
    */
@@ -307,11 +350,6 @@ private:
    */
   void handleRequestGetMeshVertexSize(int rankSender);
 
-  /**
-   * @brief Handles request reset mesh from client.
-   */
-  void handleRequestResetMesh(int rankSender);
-
   /**
    * @brief Handles request set vertex positions from client.
    */
@@ -332,46 +370,6 @@ private:
    */
   void handleRequestSetMeshEdge ( int rankSender );
 
-  /**
-   * @brief Handles request set mesh triangle from client.
-   */
-  void handleRequestSetMeshTriangle ( int rankSender );
-
-  /**
-   * @brief Handles request set mesh triangle with edges from client.
-   */
-  void handleRequestSetMeshTriangleWithEdges ( int rankSender );
-
-  /**
-   * @brief Handles request set mesh quad from client.
-   */
-  void handleRequestSetMeshQuad ( int rankSender );
-
-  /**
-   * @brief Handles request set mesh quad with edges from client.
-   */
-  void handleRequestSetMeshQuadWithEdges ( int rankSender );
-
-  /**
-   * @brief Handles request write block scalar data from client.
-   */
-  void handleRequestWriteBlockScalarData ( int rankSender );
-
-  /**
-   * @brief Handles request write scalar data from client.
-   */
-  void handleRequestWriteScalarData ( int rankSender );
-
-  /**
-   * @brief Handles request write block vector data from client.
-   */
-  void handleRequestWriteBlockVectorData ( int rankSender );
-
-  /**
-   * @brief Handles request write vector data from client.
-   */
-  void handleRequestWriteVectorData ( int rankSender );
-
   /**
    * @brief Handles request read block scalar data from client.
    */
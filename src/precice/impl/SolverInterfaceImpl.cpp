@@ -14,6 +14,7 @@
 #include "mesh/Edge.hpp"
 #include "mesh/Triangle.hpp"
 #include "mesh/Merge.hpp"
+#include "mesh/RTree.hpp"
 #include "io/ExportVRML.hpp"
 #include "io/ExportContext.hpp"
 #include "io/SimulationStateIO.hpp"
@@ -22,17 +23,22 @@
 #include "com/MPIDirectCommunication.hpp"
 #include "m2n/config/M2NConfiguration.hpp"
 #include "m2n/M2N.hpp"
+#include "m2n/CommunicationStatistics.hpp"
 #include "m2n/PointToPointCommunication.hpp"
 #include "cplscheme/CouplingScheme.hpp"
 #include "cplscheme/config/CouplingSchemeConfiguration.hpp"
 #include "utils/EventTimings.hpp"
+#include "utils/EigenHelperFunctions.hpp"
 #include "utils/Globals.hpp"
 #include "utils/SignalHandler.hpp"
 #include "utils/Parallel.hpp"
 #include "utils/Petsc.hpp"
 #include "utils/MasterSlave.hpp"
+#include "utils/Threads.hpp"
 #include "mapping/Mapping.hpp"
 #include <set>
+#include <fstream>
+#include <iterator>
 #include <Eigen/Core>
 #include "partition/ReceivedPartition.hpp"
 #include "partition/ProvidedPartition.hpp"
@@ -113,7 +119,20 @@ void SolverInterfaceImpl:: configure
   Participant::resetParticipantCount();
 
   config::Configuration config;
-  xml::configure(config.getXMLTag(), configurationFileName);
+  if (isConfigurationBroadcastable()) {
+    // Only one rank accesses the file system, the others get the file content
+    std::string content;
+    if (utils::Parallel::getProcessRank() == 0) {
+      std::ifstream ifs(configurationFileName);
+      CHECK(ifs, "File open error: " << configurationFileName);
+      content.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+    }
+    utils::Parallel::broadcast(content);
+    xml::configureFromContent(config.getXMLTag(), content);
+  }
+  else {
+    xml::configure(config.getXMLTag(), configurationFileName);
+  }
   //preciceCheck ( config.isValid(), "configure()", "Invalid configuration file!" );
   if(_accessorProcessRank==0){
     INFO("Configuring preCICE with configuration: \"" << configurationFileName << "\"" );
@@ -121,6 +140,20 @@ void SolverInterfaceImpl:: configure
   configure(config.getSolverInterfaceConfiguration());
 }
 
+bool SolverInterfaceImpl:: isConfigurationBroadcastable()
+{
+#ifndef PRECICE_NO_MPI
+  if (_accessorCommunicatorSize > 1){
+    // A parallel participant initializes MPI anyway. If the global communicator
+    // contains exactly the ranks of this participant, all of them are in configure
+    // now and a collective broadcast is safe.
+    utils::Parallel::initializeMPI(nullptr, nullptr);
+    return utils::Parallel::getCommunicatorSize() == _accessorCommunicatorSize;
+  }
+#endif // not PRECICE_NO_MPI
+  return false;
+}
+
 void SolverInterfaceImpl:: configure
 (
   const config::SolverInterfaceConfiguration& config )
@@ -283,6 +316,7 @@ double SolverInterfaceImpl:: initialize()
 
     INFO(_couplingScheme->printCouplingState());
   }
+  readDataBuffers();
   return _couplingScheme->getNextTimestepMaxLength();
 }
 
@@ -297,6 +331,7 @@ void SolverInterfaceImpl:: initializeData ()
 
   preciceCheck(_couplingScheme->isInitialized(), "initializeData()",
                "initialize() has to be called before initializeData()");
+  writeDataBuffers();
   if (_clientMode){
     _requestManager->requestInitialzeData();
   }
@@ -323,6 +358,7 @@ void SolverInterfaceImpl:: initializeData ()
       }
     }
   }
+  readDataBuffers();
 }
 
 double SolverInterfaceImpl:: advance
@@ -340,6 +376,7 @@ double SolverInterfaceImpl:: advance
   preciceCheck(_couplingScheme->isInitialized(), "advance()",
                "initialize() has to be called before advance()");
   _numberAdvanceCalls++;
+  writeDataBuffers();
   if (_clientMode){
     _requestManager->requestAdvance(computedTimestepLength);
   }
@@ -369,7 +406,10 @@ double SolverInterfaceImpl:: advance
     time = _couplingScheme->getTime();
 
 
-    mapWrittenData();
+    {
+      Event e("map");
+      mapWrittenData();
+    }
 
     std::set<action::Action::Timing> timings;
 
@@ -393,18 +433,23 @@ double SolverInterfaceImpl:: advance
     performDataActions(timings, time, computedTimestepLength, timestepPart, timestepLength);
 
     if (_couplingScheme->hasDataBeenExchanged()){
+      Event e("map");
       mapReadData();
     }
 
     INFO(_couplingScheme->printCouplingState());
 
-    handleExports();
+    {
+      Event e("export");
+      handleExports();
+    }
 
     // deactivated the reset of written data, as it deletes all data that is not communicated
     // within this cycle in the coupling data. This is not wanted forthe manifold mapping.
     //resetWrittenData();
 
   }
+  readDataBuffers();
   return _couplingScheme->getNextTimestepMaxLength();
 }
 
@@ -413,6 +458,7 @@ void SolverInterfaceImpl:: finalize()
   TRACE();
   preciceCheck(_couplingScheme->isInitialized(), "finalize()",
                "initialize() has to be called before finalize()");
+  _dataBuffers.clear();
   _couplingScheme->finalize();
   _couplingScheme.reset();
 
@@ -461,6 +507,15 @@ void SolverInterfaceImpl:: finalize()
       iter.second.m2n->closeConnection();
     }
   }
+  // Stop and print Event logging and communication statistics. Needs to happen before the
+  // master-slave communication is closed, since the master gathers the data of all slaves.
+  precice::utils::EventRegistry::finalize();
+  if (not precice::utils::MasterSlave::_slaveMode) {
+    precice::utils::EventRegistry::printAll();
+  }
+  precice::utils::EventRegistry::writeTrace();
+  m2n::CommunicationStatistics::gatherAndWrite(_accessorName);
+
   if(utils::MasterSlave::_slaveMode || utils::MasterSlave::_masterMode){
     utils::MasterSlave::_communication->closeConnection();
     utils::MasterSlave::_communication = nullptr;
@@ -470,12 +525,6 @@ void SolverInterfaceImpl:: finalize()
     _accessor->getClientServerCommunication()->closeConnection();
   }
 
-  // Stop and print Event logging
-  precice::utils::EventRegistry::finalize();
-  if (not precice::utils::MasterSlave::_slaveMode) {
-    precice::utils::EventRegistry::printAll();
-  }
-
   // Tear down MPI and PETSc
   if (not precice::testMode && not _serverMode ) {
     utils::Petsc::finalize();
@@ -738,22 +787,40 @@ void SolverInterfaceImpl:: getMeshVertexIDsFromPositions (
     MeshContext& context = _accessor->meshContext(meshID);
     mesh::PtrMesh mesh(context.mesh);
     DEBUG("Get IDs");
-    Eigen::VectorXd internalPosition(_dimensions);
-    Eigen::VectorXd position(_dimensions);
     assertion(mesh->vertices().size() <= size, mesh->vertices().size(), size);
-    for (size_t i=0; i < size; i++){
+    // The cached vertex tree of the mesh finds the candidates around each position, such that
+    // only few vertices are compared per position. The queries are independent of each other.
+    namespace bg = boost::geometry;
+    mesh::rtree::PtrRTree tree = mesh::rtree::getVertexRTree(mesh);
+    const double tolerance = 2 * math::NUMERICAL_ZERO_DIFFERENCE;
+    utils::parallelFor(0, size, 1024, [&](size_t i) {
+      Eigen::VectorXd position(_dimensions);
       for (int dim=0; dim < _dimensions; dim++){
         position[dim] = positions[i*_dimensions+dim];
       }
-      size_t j=0;
-      for (j=0; j < mesh->vertices().size(); j++){
-        internalPosition = mesh->vertices()[j].getCoords();
-        if (math::equals(internalPosition, position)){
+      mesh::Box3d box;
+      bg::set<bg::min_corner, 0>(box, bg::get<0>(position) - tolerance);
+      bg::set<bg::min_corner, 1>(box, bg::get<1>(position) - tolerance);
+      bg::set<bg::min_corner, 2>(box, bg::get<2>(position) - tolerance);
+      bg::set<bg::max_corner, 0>(box, bg::get<0>(position) + tolerance);
+      bg::set<bg::max_corner, 1>(box, bg::get<1>(position) + tolerance);
+      bg::set<bg::max_corner, 2>(box, bg::get<2>(position) + tolerance);
+      std::vector<size_t> results;
+      tree->query(bg::index::intersects(box), std::back_inserter(results));
+
+      // Several vertices may be equal to the position, the first one is taken
+      ids[i] = -1;
+      for (size_t j : results){
+        if (math::equals(mesh->vertices()[j].getCoords(), position) and (ids[i] == -1 or static_cast<int>(j) < ids[i])){
           ids[i] = j;
-          break;
         }
       }
-      CHECK(j < mesh->vertices().size(), "Position " << i << "=" << position << " unknown!");
+    });
+    for (size_t i=0; i < size; i++){
+      if (ids[i] == -1){
+        Eigen::Map<const Eigen::VectorXd> position(&positions[i*_dimensions], _dimensions);
+        ERROR("Position " << i << "=" << position << " unknown!");
+      }
     }
   }
 }
@@ -1168,16 +1235,7 @@ void SolverInterfaceImpl:: writeBlockVectorData
     DataContext& context = _accessor->dataContext(fromDataID);
 
     assertion(context.toData.get() != nullptr);
-    auto& valuesInternal = context.fromData->values();
-    for (int i=0; i < size; i++){
-      int offsetInternal = valueIndices[i]*_dimensions;
-      int offset = i*_dimensions;
-      for (int dim=0; dim < _dimensions; dim++){
-        assertion(offset+dim < valuesInternal.size(),
-                   offset+dim, valuesInternal.size());
-        valuesInternal[offsetInternal + dim] = values[offset + dim];
-      }
-    }
+    utils::scatterValues(values, valueIndices, size, _dimensions, context.fromData->values());
   }
 }
 
@@ -1235,11 +1293,7 @@ void SolverInterfaceImpl:: writeBlockScalarData
           "You try to write to data that is not defined for " << _accessor->getName());
     DataContext& context = _accessor->dataContext(fromDataID);
     assertion(context.toData.get() != nullptr);
-    auto& valuesInternal = context.fromData->values();
-    for (int i=0; i < size; i++){
-      assertion(i < valuesInternal.size(), i, valuesInternal.size());
-      valuesInternal[valueIndices[i]] = values[i];
-    }
+    utils::scatterValues(values, valueIndices, size, 1, context.fromData->values());
   }
 }
 
@@ -1287,16 +1341,7 @@ void SolverInterfaceImpl:: readBlockVectorData
                  "You try to read from data that is not defined for " << _accessor->getName());
     DataContext& context = _accessor->dataContext(toDataID);
     assertion(context.fromData.get() != nullptr);
-    auto& valuesInternal = context.toData->values();
-    for (int i=0; i < size; i++){
-      int offsetInternal = valueIndices[i] * _dimensions;
-      int offset = i * _dimensions;
-      for (int dim=0; dim < _dimensions; dim++){
-        assertion(offsetInternal+dim < valuesInternal.size(),
-                   offsetInternal+dim, valuesInternal.size());
-        values[offset + dim] = valuesInternal[offsetInternal + dim];
-      }
-    }
+    utils::gatherValues(context.toData->values(), valueIndices, size, _dimensions, values);
   }
 }
 
@@ -1352,12 +1397,7 @@ void SolverInterfaceImpl:: readBlockScalarData
                      "You try to read from data that is not defined for " << _accessor->getName());
     DataContext& context = _accessor->dataContext(toDataID);
     assertion(context.fromData.get() != nullptr);
-    auto& valuesInternal = context.toData->values();
-    for (int i=0; i < size; i++){
-      assertion(valueIndices[i] < valuesInternal.size(),
-               valueIndices[i], valuesInternal.size());
-      values[i] = valuesInternal[valueIndices[i]];
-    }
+    utils::gatherValues(context.toData->values(), valueIndices, size, 1, values);
   }
 }
 
@@ -1385,6 +1425,104 @@ void SolverInterfaceImpl:: readScalarData
   DEBUG("Read value = " << value);
 }
 
+void SolverInterfaceImpl:: setDataBuffer
+(
+  int     dataID,
+  int     size,
+  int*    valueIndices,
+  double* values )
+{
+  TRACE(dataID, size);
+  preciceCheck(_accessor->isDataUsed(dataID), "setDataBuffer()",
+               "You try to register a buffer for data that is not defined for " << _accessor->getName());
+  assertion(values != nullptr or size == 0);
+  DataBuffer buffer;
+  buffer.values = values;
+  buffer.size = size;
+  buffer.dimensions = _accessor->dataContext(dataID).fromData->getDimensions();
+  buffer.write = false;
+  for (const DataContext& context : _accessor->writeDataContexts()){
+    if (context.fromData->getID() == dataID){
+      buffer.write = true;
+    }
+  }
+  if (valueIndices != nullptr){
+    buffer.valueIndices.assign(valueIndices, valueIndices + size);
+  }
+  else if (_clientMode){
+    // The requests to the server always transfer the indices
+    buffer.valueIndices.resize(size);
+    for (int i=0; i < size; i++){
+      buffer.valueIndices[i] = i;
+    }
+  }
+  _dataBuffers[dataID] = std::move(buffer);
+}
+
+void SolverInterfaceImpl:: removeDataBuffer
+(
+  int dataID )
+{
+  TRACE(dataID);
+  _dataBuffers.erase(dataID);
+}
+
+void SolverInterfaceImpl:: writeDataBuffers()
+{
+  TRACE();
+  for (auto& pair : _dataBuffers){
+    DataBuffer& buffer = pair.second;
+    if (not buffer.write or buffer.size == 0){
+      continue;
+    }
+    if (_clientMode){
+      if (buffer.dimensions == 1){
+        writeBlockScalarData(pair.first, buffer.size, buffer.valueIndices.data(), buffer.values);
+      }
+      else {
+        writeBlockVectorData(pair.first, buffer.size, buffer.valueIndices.data(), buffer.values);
+      }
+      continue;
+    }
+    auto& valuesInternal = _accessor->dataContext(pair.first).fromData->values();
+    if (buffer.valueIndices.empty()){
+      int size = buffer.size * buffer.dimensions;
+      assertion(size <= valuesInternal.size(), size, valuesInternal.size());
+      valuesInternal.head(size) = Eigen::Map<const Eigen::VectorXd>(buffer.values, size);
+      continue;
+    }
+    utils::scatterValues(buffer.values, buffer.valueIndices.data(), buffer.size, buffer.dimensions, valuesInternal);
+  }
+}
+
+void SolverInterfaceImpl:: readDataBuffers()
+{
+  TRACE();
+  for (auto& pair : _dataBuffers){
+    DataBuffer& buffer = pair.second;
+    if (buffer.write or buffer.size == 0){
+      continue;
+    }
+    if (_clientMode){
+      if (buffer.dimensions == 1){
+        readBlockScalarData(pair.first, buffer.size, buffer.valueIndices.data(), buffer.values);
+      }
+      else {
+        readBlockVectorData(pair.first, buffer.size, buffer.valueIndices.data(), buffer.values);
+      }
+      continue;
+    }
+    const auto& valuesInternal = _accessor->dataContext(pair.first).toData->values();
+    if (buffer.valueIndices.empty()){
+      int size = buffer.size * buffer.dimensions;
+      assertion(size <= valuesInternal.size(), size, valuesInternal.size());
+      Eigen::Map<Eigen::VectorXd>(buffer.values, size) = valuesInternal.head(size);
+      continue;
+    }
+    utils::gatherValues(valuesInternal, buffer.valueIndices.data(), buffer.size, buffer.dimensions, buffer.values);
+  }
+}
+
 void SolverInterfaceImpl:: exportMesh
 (
   const std::string& filenameSuffix,
@@ -1427,7 +1565,18 @@ void SolverInterfaceImpl:: runServer()
 {
   assertion(_serverMode);
   initializeClientServerCommunication();
-  _requestManager->handleRequests();
+  int threads = _accessor->getServerThreads();
+# ifndef PRECICE_NO_MPI
+  if (threads > 1 && std::dynamic_pointer_cast<com::MPICommunication>(_accessor->getClientServerCommunication())){
+    int provided = MPI_THREAD_SINGLE;
+    MPI_Query_thread(&provided);
+    if (provided != MPI_THREAD_MULTIPLE){
+      WARN("The server uses one thread, since MPI is not initialized with MPI_THREAD_MULTIPLE");
+      threads = 1;
+    }
+  }
+# endif // not PRECICE_NO_MPI
+  _requestManager->handleRequests(threads);
 }
 
 void SolverInterfaceImpl:: configureM2Ns
@@ -1477,6 +1626,7 @@ void SolverInterfaceImpl:: configurePartitions
 
 
       bool hasToSend = false; //@todo multiple sends
+      bool sendDistributed = false;
       m2n::PtrM2N m2n;
 
       for (PtrParticipant receiver : _participants ) {
@@ -1489,13 +1639,14 @@ void SolverInterfaceImpl:: configurePartitions
             if(receiverContext->meshRequirement > context->meshRequirement){
               context->meshRequirement = receiverContext->meshRequirement;
             }
+            sendDistributed = receiverContext->geoFilter == partition::ReceivedPartition::GeometricFilter::DISTRIBUTED;
             m2n = m2nConfig->getM2N( receiver->getName(), _accessorName );
             m2n->createDistributedCommunication(context->mesh);
           }
         }
       }
       //@todo support offset??
-      context->partition = partition::PtrPartition ( new partition::ProvidedPartition( context->mesh, hasToSend) );
+      context->partition = partition::PtrPartition ( new partition::ProvidedPartition( context->mesh, hasToSend, sendDistributed) );
       if(hasToSend){
         assertion(m2n.use_count()>0);
         context->partition->setm2n(m2n);
@@ -1535,6 +1686,13 @@ void SolverInterfaceImpl:: computePartitions()
         return lhs->mesh->getName() < rhs->mesh->getName();
       } );
 
+  // The distributed mesh exchange needs the bounding boxes of the provided meshes
+  for (MeshContext* meshContext : _accessor->usedMeshContexts()){
+    if (meshContext->provideMesh) {
+      meshContext->mesh->computeState();
+    }
+  }
+
   for (MeshContext* meshContext : _accessor->usedMeshContexts()){
     meshContext->partition->communicate();
   }
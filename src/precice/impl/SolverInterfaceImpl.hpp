@@ -64,6 +64,9 @@ public:
    * Only after the configuration a reasonable state of a SolverInterfaceImpl
    * object is achieved.
    *
+   * If all ranks of the global MPI communicator belong to this participant,
+   * only rank 0 reads the file and broadcasts its content to the other ranks.
+   *
    * @param configurationFileName [IN] Name (with path) of the xml config. file.
    */
   void configure ( const std::string& configurationFileName );
@@ -446,6 +449,16 @@ public:
     int     valueIndex,
     double& value );
 
+  /// See precice::SolverInterface::setDataBuffer().
+  void setDataBuffer (
+    int     dataID,
+    int     size,
+    int*    valueIndices,
+    double* values );
+
+  /// See precice::SolverInterface::removeDataBuffer().
+  void removeDataBuffer ( int dataID );
+
   /**
    * @brief Sets the location for all output of preCICE.
    *
@@ -495,6 +508,18 @@ private:
     bool isRequesting;
   };
 
+  /// Array of the solver registered as storage of data values.
+  struct DataBuffer {
+    double* values;
+    int size;
+    /// Vertex of each value, empty for the identity.
+    std::vector<int> valueIndices;
+    /// Number of components per value.
+    int dimensions;
+    /// True for written data, false for read data.
+    bool write;
+  };
+
   // @brief Used for writing debug information.
   static logging::Logger _log;
 
@@ -537,6 +562,9 @@ private:
   // @brief Counts calls to advance for plotting.
   long int _numberAdvanceCalls;
 
+  /// Registered arrays of the solver by data ID.
+  std::map<int,DataBuffer> _dataBuffers;
+
 //  // @brief Locks the next receive operation of the server to a specific client.
 //  int _lockServerToClient;
 
@@ -547,6 +575,19 @@ private:
   //        is expected.
   //int _expectRequest;
 
+  /**
+   * @brief Returns true, if the configuration file can be read by one rank and broadcast.
+   *
+   * Initializes MPI for parallel participants.
+   */
+  bool isConfigurationBroadcastable();
+
+  /// Takes the values of written data from the registered arrays.
+  void writeDataBuffers();
+
+  /// Stores the values of read data into the registered arrays.
+  void readDataBuffers();
+
   void configureM2Ns ( const m2n::M2NConfiguration::SharedPointer& config );
 
   /**
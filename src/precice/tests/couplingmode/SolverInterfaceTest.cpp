@@ -46,6 +46,7 @@ void SolverInterfaceTest:: run()
       testMethod(testExplicitWithDataExchange);
       testMethod(testExplicitWithDataInitialization);
       testMethod(testExplicitWithBlockDataExchange);
+      testMethod(testExplicitWithDataBuffers);
       testMethod(testExplicitWithSolverGeometry);
       testMethod(testExplicitWithDisplacingGeometry);
       //@todo fails currently as action does not introduce mesh-requirement
@@ -518,6 +519,126 @@ void SolverInterfaceTest:: testExplicitWithBlockDataExchange()
   }
 }
 
+void SolverInterfaceTest:: testExplicitWithDataBuffers()
+{
+  TRACE();
+  assertion(utils::Parallel::getCommunicatorSize() > 1);
+  mesh::Mesh::resetGeometryIDsGlobally();
+  double counter = 0.0;
+  using Eigen::Vector3d;
+
+  if (utils::Parallel::getProcessRank() == 0){
+    SolverInterface cplInterface("SolverOne", 0, 1);
+    configureSolverInterface(_pathToTests + "/explicit-mpi-single-non-inc.xml",
+                             cplInterface);
+    int meshOneID = cplInterface.getMeshID("MeshOne");
+    double maxDt = cplInterface.initialize();
+    int forcesID = cplInterface.getDataID("Forces", meshOneID);
+    int pressuresID = cplInterface.getDataID("Pressures", meshOneID);
+    int velocitiesID = cplInterface.getDataID("Velocities", meshOneID);
+    int temperaturesID = cplInterface.getDataID("Temperatures", meshOneID);
+    VertexHandle vertices = cplInterface.getMeshHandle("Test-Square").vertices();
+    int size = vertices.size();
+    Eigen::VectorXd positions(size*3);
+    Eigen::VectorXd forces(size*3);
+    Eigen::VectorXd pressures(size);
+    Eigen::VectorXd velocities(size*3);
+    Eigen::VectorXd temperatures(size);
+    Eigen::VectorXd expectedVelocities(size*3);
+    Eigen::VectorXd expectedTemperatures(size);
+    Eigen::VectorXi ids(size);
+    for (VertexIterator it = vertices.begin(); it != vertices.end(); it++){
+      for (int dim=0; dim < 3; dim++){
+        positions[it.vertexID()*3 + dim] = it.vertexCoords()[dim];
+      }
+    }
+
+    while (cplInterface.isCouplingOngoing()){
+      cplInterface._impl->resetMesh(meshOneID);
+      cplInterface.setMeshVertices(meshOneID, size, positions.data(), ids.data());
+      for (VertexIterator it = vertices.begin(); it != vertices.end(); it++){
+        Vector3d force ( Vector3d::Constant(counter) +
+                         Eigen::Map<const Vector3d>(it.vertexCoords()) );
+        for (int dim=0; dim<3; dim++) forces[it.vertexID()*3+dim] = force[dim];
+        pressures[it.vertexID()] = counter + it.vertexCoords()[0];
+      }
+      cplInterface.writeBlockVectorData(forcesID, size, ids.data(), forces.data());
+      cplInterface.writeBlockScalarData(pressuresID, size, ids.data(), pressures.data());
+      maxDt = cplInterface.advance(maxDt);
+      if (cplInterface.isCouplingOngoing()){
+        for (VertexIterator it = vertices.begin(); it != vertices.end(); it++){
+          for (int dim=0; dim < 3; dim++){
+            expectedVelocities[it.vertexID()*3+dim] = counter + it.vertexCoords()[dim];
+          }
+          expectedTemperatures[it.vertexID()] = counter + it.vertexCoords()[0];
+        }
+        cplInterface._impl->resetMesh(meshOneID);
+        cplInterface.setMeshVertices(meshOneID, size, positions.data(), ids.data());
+        cplInterface.mapReadDataTo(meshOneID);
+        cplInterface.readBlockVectorData(velocitiesID, size, ids.data(), velocities.data());
+        cplInterface.readBlockScalarData(temperaturesID, size, ids.data(), temperatures.data());
+        validateWithParams2(math::equals(velocities, expectedVelocities),
+                            velocities, expectedVelocities);
+        validateWithParams2(math::equals(temperatures, expectedTemperatures),
+                            temperatures, expectedTemperatures);
+        counter += 1.0;
+      }
+    }
+    cplInterface.finalize();
+  }
+  else if (utils::Parallel::getProcessRank() == 1){
+    SolverInterface cplInterface("SolverTwo", 0, 1);
+    configureSolverInterface(_pathToTests + "/explicit-mpi-single-non-inc.xml",
+                             cplInterface);
+    int meshID = cplInterface.getMeshID("Test-Square");
+    int forcesID = cplInterface.getDataID("Forces", meshID);
+    int pressuresID = cplInterface.getDataID("Pressures", meshID);
+    int velocitiesID = cplInterface.getDataID("Velocities", meshID);
+    int temperaturesID = cplInterface.getDataID("Temperatures", meshID);
+    std::vector<Vector3d> coords {Vector3d(0.0,0.0,0.0), Vector3d(1.0,0.0,0.0),
+                                  Vector3d(0.0,1.0,0.0), Vector3d(1.0,1.0,0.0)};
+    int size = coords.size();
+    // The vertices are set in reverse order, such that the indices of the buffers are not the identity
+    Eigen::VectorXi ids(size);
+    for (int i=size-1; i >= 0; i--){
+      ids[i] = cplInterface.setMeshVertex(meshID, coords[i].data());
+    }
+    Eigen::VectorXd forces = Eigen::VectorXd::Zero(size*3);
+    Eigen::VectorXd pressures = Eigen::VectorXd::Zero(size);
+    Eigen::VectorXd velocities(size*3);
+    Eigen::VectorXd temperatures(size);
+    cplInterface.setDataBuffer(forcesID, size, ids.data(), forces.data());
+    cplInterface.setDataBuffer(pressuresID, size, ids.data(), pressures.data());
+    cplInterface.setDataBuffer(velocitiesID, size, ids.data(), velocities.data());
+    cplInterface.setDataBuffer(temperaturesID, size, ids.data(), temperatures.data());
+
+    double maxDt = cplInterface.initialize();
+    while (true){
+      // The read buffers already hold the data received by initialize() or advance()
+      for (int i=0; i < size; i++){
+        Vector3d force = forces.segment<3>(i*3);
+        validateWithParams2(math::equals(force, Vector3d::Constant(counter) + coords[i]),
+                            force, coords[i]);
+        validateWithParams2(math::equals(pressures[i], counter + coords[i][0]),
+                            pressures[i], coords[i]);
+      }
+      counter += 1.0;
+      if (not cplInterface.isCouplingOngoing()){
+        break;
+      }
+      for (int i=0; i < size; i++){
+        velocities.segment<3>(i*3) = Vector3d::Constant(counter - 1.0) + coords[i];
+        temperatures[i] = counter - 1.0 + coords[i][0];
+      }
+      maxDt = cplInterface.advance(maxDt);
+      if (not cplInterface.isCouplingOngoing()){
+        break;
+      }
+    }
+    cplInterface.finalize();
+  }
+}
+
 void SolverInterfaceTest:: testExplicitWithSolverGeometry ()
 {
   TRACE();
@@ -87,6 +87,11 @@ private:
    */
   void testExplicitWithBlockDataExchange();
 
+  /**
+   * @brief One solver uses block write/read methods, the other registered data buffers.
+   */
+  void testExplicitWithDataBuffers();
+
   /**
    * @brief Runs a coupled simulation where one solver supplies a geometry.
    *
@@ -40,6 +40,8 @@ void SolverInterfaceTestRemote:: run()
     if ( Par::getProcessRank() <= 2 ){
       Par::setGlobalCommunicator(comm);
       testMethod(testCouplingModeWithOneServer);
+      testMethod(testBatchedRequests);
+      testMethod(testLargeBatchedRequests);
       Par::setGlobalCommunicator(Par::getCommunicatorWorld());
     }
   }
@@ -48,6 +50,7 @@ void SolverInterfaceTestRemote:: run()
     if (Par::getProcessRank() <= 3){
       Par::setGlobalCommunicator(comm);
       testMethod(testCouplingModeParallelWithOneServer);
+      testMethod(testCouplingModeParallelWithThreadedServer);
       Par::setGlobalCommunicator(Par::getCommunicatorWorld());
     }
   }
@@ -211,4 +214,218 @@ void SolverInterfaceTestRemote:: testCouplingModeParallelWithOneServer()
   }
 }
 
+void SolverInterfaceTestRemote:: testCouplingModeParallelWithThreadedServer()
+{
+  TRACE();
+  int rank = utils::Parallel::getProcessRank();
+  std::string configFile = _pathToTests + "cplmode-threads.xml";
+  int verticesPerClient = 3;
+  // Values written by the participants to the vertex at position x in the given timestep
+  auto scalarValue = [](int timestep, double x) {
+    return timestep + x;
+  };
+  auto vectorValue = [](int timestep, double x) {
+    return Eigen::Vector2d(timestep * x, -x);
+  };
+
+  if (rank == 0){
+    SolverInterface interface("ParticipantA", 0, 1);
+    configureSolverInterface(configFile, interface);
+    double dt = interface.initialize();
+    int meshID = interface.getMeshID("MeshB");
+    int scalarDataID = interface.getDataID("ScalarData", meshID);
+    int vectorDataID = interface.getDataID("VectorData", meshID);
+    int vertexCount = interface.getMeshVertexSize(meshID);
+    validateEquals(vertexCount, 2 * verticesPerClient);
+    std::vector<int> ids(vertexCount);
+    for (int i=0; i < vertexCount; i++){
+      ids[i] = i;
+    }
+    std::vector<double> positions(2 * vertexCount);
+    interface.getMeshVertices(meshID, vertexCount, ids.data(), positions.data());
+
+    int timesteps = 0;
+    while (interface.isCouplingOngoing()){
+      timesteps++;
+      for (int i=0; i < vertexCount; i++){
+        interface.writeScalarData(scalarDataID, i, scalarValue(timesteps, positions[2*i]));
+      }
+      dt = interface.advance(dt);
+      int wrongValues = 0;
+      for (int i=0; i < vertexCount; i++){
+        Eigen::Vector2d value;
+        interface.readVectorData(vectorDataID, i, value.data());
+        if (not math::equals(value, vectorValue(timesteps, positions[2*i]))){
+          wrongValues++;
+        }
+      }
+      validateEquals(wrongValues, 0);
+    }
+    interface.finalize();
+    validateEquals(timesteps, 5);
+  }
+  else if ((rank == 1) || (rank == 2)){
+    SolverInterface interface("ParticipantB", rank-1, 2);
+    configureSolverInterface(configFile, interface);
+    int meshID = interface.getMeshID("MeshB");
+    int scalarDataID = interface.getDataID("ScalarData", meshID);
+    int vectorDataID = interface.getDataID("VectorData", meshID);
+    // The server assigns the vertex IDs in the order in which the requests of both clients arrive
+    std::vector<int> ids;
+    std::vector<double> xs;
+    for (int i=0; i < verticesPerClient; i++){
+      double x = 10.0 * rank + i;
+      ids.push_back(interface.setMeshVertex(meshID, Eigen::Vector2d(x, 0.0).data()));
+      xs.push_back(x);
+    }
+    double dt = interface.initialize();
+    validateEquals(interface.getMeshVertexSize(meshID), 2 * verticesPerClient);
+
+    int timesteps = 0;
+    while (interface.isCouplingOngoing()){
+      timesteps++;
+      // Reads and writes of both clients are handled concurrently by the server
+      for (int i=0; i < verticesPerClient; i++){
+        double value = 0.0;
+        interface.readScalarData(scalarDataID, ids[i], value);
+        validateNumericalEquals(value, scalarValue(timesteps, xs[i]));
+        Eigen::Vector2d vector = vectorValue(timesteps, xs[i]);
+        interface.writeVectorData(vectorDataID, ids[i], vector.data());
+      }
+      dt = interface.advance(dt);
+    }
+    interface.finalize();
+    validateEquals(timesteps, 5);
+  }
+  else {
+    assertion(rank == 3, rank);
+    bool isServer = true;
+    impl::SolverInterfaceImpl server("ParticipantB", 0, 1, isServer);
+
+    // Perform manual configuration without overwritting logging config
+    mesh::Mesh::resetGeometryIDsGlobally();
+    mesh::Data::resetDataCount();
+    impl::Participant::resetParticipantCount();
+    config::Configuration config;
+    xml::configure(config.getXMLTag(), configFile);
+    server.configure(config.getSolverInterfaceConfiguration());
+    server.runServer();
+  }
+}
+
+void SolverInterfaceTestRemote:: testBatchedRequests()
+{
+  TRACE();
+  runBatchedRequests(4);
+}
+
+void SolverInterfaceTestRemote:: testLargeBatchedRequests()
+{
+  TRACE();
+  // The written values of one time step exceed the batch size of 1 << 16 entries several times
+  runBatchedRequests(1 << 16);
+}
+
+void SolverInterfaceTestRemote:: runBatchedRequests
+(
+  int vertexCount )
+{
+  TRACE(vertexCount);
+  int rank = utils::Parallel::getProcessRank();
+  std::string configFile = _pathToTests + "cplmode-1.xml";
+  std::vector<int> indices(vertexCount);
+  for (int i=0; i < vertexCount; i++){
+    indices[i] = i;
+  }
+  // Values written by ParticipantB to the vertex in the given timestep
+  auto expectedValue = [](int timestep, int vertex) {
+    return Eigen::Vector2d(timestep + vertex, -vertex);
+  };
+
+  if (rank == 0){
+    SolverInterface interface("ParticipantA", 0, 1);
+    configureSolverInterface(configFile, interface);
+    int meshID = interface.getMeshID("Mesh");
+    int scalarDataID = interface.getDataID("ScalarData", meshID);
+    int vectorDataID = interface.getDataID("VectorData", meshID);
+    std::vector<double> positions(2 * vertexCount);
+    for (int i=0; i < vertexCount; i++){
+      positions[2*i] = i;
+    }
+    std::vector<int> vertexIDs(vertexCount);
+    interface.setMeshVertices(meshID, vertexCount, positions.data(), vertexIDs.data());
+
+    double dt = interface.initialize();
+    std::vector<double> scalarValues(vertexCount, 1.0);
+    std::vector<double> vectorValues(2 * vertexCount);
+    int timesteps = 0;
+    while (interface.isCouplingOngoing()){
+      timesteps++;
+      interface.writeBlockScalarData(scalarDataID, vertexCount, vertexIDs.data(), scalarValues.data());
+      dt = interface.advance(dt);
+      interface.readBlockVectorData(vectorDataID, vertexCount, vertexIDs.data(), vectorValues.data());
+      int wrongValues = 0;
+      for (int i=0; i < vertexCount; i++){
+        if (not math::equals(Eigen::Vector2d(vectorValues[2*i], vectorValues[2*i+1]), expectedValue(timesteps, i))){
+          wrongValues++;
+        }
+      }
+      validateEquals(wrongValues, 0);
+    }
+    interface.finalize();
+    validateEquals(timesteps, 5);
+  }
+  else if (rank == 1){
+    SolverInterface interface("ParticipantB", 0, 1);
+    configureSolverInterface(configFile, interface);
+    double dt = interface.initialize();
+    int meshID = interface.getMeshID("Mesh");
+    int scalarDataID = interface.getDataID("ScalarData", meshID);
+    int vectorDataID = interface.getDataID("VectorData", meshID);
+    validateEquals(interface.getMeshVertexSize(meshID), vertexCount);
+    int half = vertexCount / 2;
+    std::vector<double> blockValues(2 * (vertexCount - half));
+    std::vector<double> scalarValues(vertexCount);
+    int timesteps = 0;
+    while (interface.isCouplingOngoing()){
+      timesteps++;
+      // Queued on the client, first half with single requests, second half with one block request
+      for (int i=0; i < half; i++){
+        Eigen::Vector2d value = expectedValue(timesteps, i);
+        interface.writeVectorData(vectorDataID, i, value.data());
+      }
+      for (int i=half; i < vertexCount; i++){
+        Eigen::Vector2d value = expectedValue(timesteps, i);
+        blockValues[2*(i-half)] = value(0);
+        blockValues[2*(i-half)+1] = value(1);
+      }
+      interface.writeBlockVectorData(vectorDataID, vertexCount - half, &indices[half], blockValues.data());
+
+      // Odd timesteps flush the writes by a read, even timesteps by advance
+      if (timesteps % 2 == 1){
+        interface.readBlockScalarData(scalarDataID, vertexCount, indices.data(), scalarValues.data());
+        validateNumericalEquals(scalarValues.front(), 1.0);
+        validateNumericalEquals(scalarValues.back(), 1.0);
+      }
+      dt = interface.advance(dt);
+    }
+    interface.finalize();
+    validateEquals(timesteps, 5);
+  }
+  else {
+    assertion(rank == 2, rank);
+    bool isServer = true;
+    impl::SolverInterfaceImpl server("ParticipantB", 0, 1, isServer);
+
+    // Perform manual configuration without overwritting logging config
+    mesh::Mesh::resetGeometryIDsGlobally();
+    mesh::Data::resetDataCount();
+    impl::Participant::resetParticipantCount();
+    config::Configuration config;
+    xml::configure(config.getXMLTag(), configFile);
+    server.configure(config.getSolverInterfaceConfiguration());
+    server.runServer();
+  }
+}
+
 }} // namespace precice, tests
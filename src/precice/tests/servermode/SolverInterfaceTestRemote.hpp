@@ -58,6 +58,26 @@ private:
    * @brief Two solvers in coupling mode, one in parallel using a server.
    */
   void testCouplingModeParallelWithOneServer();
+
+  /**
+   * @brief Two solvers in coupling mode, one in parallel using a server with two threads.
+   */
+  void testCouplingModeParallelWithThreadedServer();
+
+  /**
+   * @brief Writes of a server mode client are batched, flushed by a read and by advance.
+   */
+  void testBatchedRequests();
+
+  /**
+   * @brief As testBatchedRequests(), with batches larger than the size that forces a flush.
+   */
+  void testLargeBatchedRequests();
+
+  /**
+   * @brief Runs the batched requests tests with the given number of vertices.
+   */
+  void runBatchedRequests ( int vertexCount );
 };
 
 }} // namespace precice, tests
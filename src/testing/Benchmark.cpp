@@ -0,0 +1,402 @@
+#include "Benchmark.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <numeric>
+#include <sstream>
+#include <vector>
+
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/property_tree/ptree.hpp>
+
+#include "logging/LogConfiguration.hpp"
+#include "utils/Parallel.hpp"
+#include "utils/Petsc.hpp"
+
+namespace precice {
+extern bool testMode;
+}
+
+namespace
+{
+std::atomic<std::size_t> allocations{0};
+}
+
+// Counts all heap allocations of the benchmark executable.
+void* operator new(std::size_t size)
+{
+  allocations.fetch_add(1, std::memory_order_relaxed);
+  if (void* ptr = std::malloc(size == 0 ? 1 : size))
+    return ptr;
+  throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+  std::free(ptr);
+}
+
+namespace precice
+{
+namespace testing
+{
+
+std::size_t allocationCount()
+{
+  return allocations.load(std::memory_order_relaxed);
+}
+
+BenchmarkState::BenchmarkState(long long iterations)
+  : _iterations(iterations),
+    _remaining(iterations)
+{}
+
+bool BenchmarkState::keepRunning()
+{
+  if (not _running and _remaining == _iterations) {
+    resumeTiming();
+  }
+  if (_remaining-- > 0) {
+    return true;
+  }
+  pauseTiming();
+  return false;
+}
+
+void BenchmarkState::pauseTiming()
+{
+  if (_running) {
+    _elapsed += Clock::now() - _start;
+    _allocations += allocationCount() - _allocationsAtStart;
+    _running = false;
+  }
+}
+
+void BenchmarkState::resumeTiming()
+{
+  if (not _running) {
+    _allocationsAtStart = allocationCount();
+    _start = Clock::now();
+    _running = true;
+  }
+}
+
+void BenchmarkState::setItemsProcessed(double items)
+{
+  _items = items;
+}
+
+void BenchmarkState::setCounter(const std::string& name, double value)
+{
+  _counters[name] = value;
+}
+
+void BenchmarkState::skip(const std::string& reason)
+{
+  pauseTiming();
+  _remaining = 0;
+  _skipReason = reason;
+}
+
+double BenchmarkState::seconds() const
+{
+  return std::chrono::duration<double>(_elapsed).count();
+}
+
+namespace
+{
+
+struct Benchmark
+{
+  std::string name;
+  BenchmarkFunction function;
+  long long iterations;
+  int ranks;
+};
+
+std::vector<Benchmark>& registry()
+{
+  static std::vector<Benchmark> benchmarks;
+  return benchmarks;
+}
+
+/// Formats the result of one case as a single line JSON object.
+std::string toJSON(const std::string& name, const BenchmarkState& state)
+{
+  std::ostringstream out;
+  out << std::setprecision(9);
+  double iterations = static_cast<double>(state.iterations());
+  out << "{\"name\": \"" << name << "\"";
+  if (state.skipped()) {
+    out << ", \"skipped\": \"" << state.skipReason() << "\"}";
+    return out.str();
+  }
+  out << ", \"iterations\": " << state.iterations()
+      << ", \"seconds\": " << state.seconds()
+      << ", \"seconds_per_iteration\": " << state.seconds() / iterations
+      << ", \"allocations_per_iteration\": " << state.allocations() / iterations;
+  if (state.itemsProcessed() > 0) {
+    out << ", \"items_per_second\": " << state.itemsProcessed() / state.seconds();
+  }
+  for (const auto& counter : state.counters()) {
+    out << ", \"" << counter.first << "\": " << counter.second;
+  }
+  out << "}";
+  return out.str();
+}
+
+/// Runs a case on the ranks it requires, or skips it if not enough ranks are available.
+BenchmarkState runBenchmark(const Benchmark& benchmark, long long iterations)
+{
+  BenchmarkState state(iterations);
+  if (benchmark.ranks > utils::Parallel::getCommunicatorSize()) {
+    state.skip("requires " + std::to_string(benchmark.ranks) + " ranks");
+    return state;
+  }
+  std::vector<int> ranks(benchmark.ranks);
+  std::iota(ranks.begin(), ranks.end(), 0);
+  utils::Parallel::restrictGlobalCommunicator(ranks);
+  if (utils::Parallel::getProcessRank() < benchmark.ranks) {
+    benchmark.function(state);
+  }
+  utils::Parallel::setGlobalCommunicator(utils::Parallel::getCommunicatorWorld());
+  utils::Parallel::clearGroups();
+  utils::Parallel::synchronizeProcesses();
+  return state;
+}
+
+/// Returns the metrics of a case that are compared against a baseline.
+/**
+ * These are the allocations and all timings normalized per iteration, i.e. seconds_per_iteration
+ * and all counters with "seconds" in their name.
+ */
+std::map<std::string, double> comparedMetrics(const BenchmarkState& state)
+{
+  std::map<std::string, double> metrics;
+  double iterations = static_cast<double>(state.iterations());
+  metrics["seconds_per_iteration"]     = state.seconds() / iterations;
+  metrics["allocations_per_iteration"] = state.allocations() / iterations;
+  for (const auto& counter : state.counters()) {
+    if (counter.first.find("seconds") != std::string::npos) {
+      metrics[counter.first] = counter.second;
+    }
+  }
+  return metrics;
+}
+
+/// Reference results of a case, as read from a baseline file.
+struct Baseline
+{
+  std::map<std::string, double> metrics;
+
+  /// Relative tolerance of this case, overrides the global tolerance if positive.
+  double tolerance = -1.0;
+};
+
+/// Reads a baseline file, i.e. the output of a previous run, one JSON object per line.
+/**
+ * Lines which are not JSON objects are ignored, so that the captured stdout of a run can be used.
+ * A case can be given an individual relative tolerance by adding a "tolerance" entry to its line.
+ */
+std::map<std::string, Baseline> readBaselines(const std::string& filename)
+{
+  std::map<std::string, Baseline> baselines;
+  std::ifstream file(filename);
+  if (not file) {
+    std::cerr << "Baseline file " << filename << " cannot be opened" << std::endl;
+    std::exit(1);
+  }
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.empty() or line[0] != '{') {
+      continue;
+    }
+    std::istringstream lineStream(line);
+    boost::property_tree::ptree tree;
+    boost::property_tree::read_json(lineStream, tree);
+    if (tree.count("skipped") > 0) {
+      continue;
+    }
+    Baseline& baseline = baselines[tree.get<std::string>("name")];
+    for (const auto& entry : tree) {
+      if (entry.first == "tolerance") {
+        baseline.tolerance = entry.second.get_value<double>();
+      }
+      else if (entry.first == "allocations_per_iteration" or
+               (entry.first != "seconds" and entry.first.find("seconds") != std::string::npos)) {
+        baseline.metrics[entry.first] = entry.second.get_value<double>();
+      }
+    }
+  }
+  return baselines;
+}
+
+/// Compares the metrics of a case against its baseline, prints and returns the number of regressions.
+/**
+ * A metric regresses if it exceeds the baseline by more than the relative tolerance. Differences
+ * below 10 microseconds or one allocation are ignored, as they are in the range of the measurement noise.
+ */
+int compareWithBaseline(const std::string& name, const BenchmarkState& state,
+                        const Baseline& baseline, double tolerance)
+{
+  if (baseline.tolerance > 0) {
+    tolerance = baseline.tolerance;
+  }
+  int regressions = 0;
+  for (const auto& metric : comparedMetrics(state)) {
+    auto reference = baseline.metrics.find(metric.first);
+    if (reference == baseline.metrics.end()) {
+      continue;
+    }
+    double noise = metric.first == "allocations_per_iteration" ? 1.0 : 1e-5;
+    double difference = metric.second - reference->second;
+    if (difference > tolerance * reference->second and difference > noise) {
+      std::cerr << "Regression in " << name << ": " << metric.first << " is " << metric.second
+                << ", baseline is " << reference->second << " (+"
+                << std::setprecision(3) << 100.0 * difference / reference->second << "%, tolerance "
+                << 100.0 * tolerance << "%)" << std::setprecision(6) << std::endl;
+      regressions++;
+    }
+  }
+  return regressions;
+}
+
+} // namespace
+
+bool registerBenchmark(const std::string& name, BenchmarkFunction function, long long iterations, int ranks)
+{
+  registry().push_back(Benchmark{name, function, iterations, ranks});
+  return true;
+}
+
+}} // namespace precice, testing
+
+void printUsage()
+{
+  std::cout << "Usage: benchprecice [--filter Substring] [--output File.json] [--scale Factor]\n"
+            << "                    [--repetitions N] [--baseline File.json] [--tolerance Fraction]" << std::endl;
+}
+
+/// Entry point of the benchmark executable
+/**
+ * Runs all registered benchmarks whose name contains the filter string and writes one JSON object
+ * per case to stdout and, if given, to the output file. The scale factor multiplies the number of
+ * iterations of all cases. Cases which require multiple ranks, e.g. communication benchmarks, are
+ * skipped unless the executable is started with enough ranks, e.g. mpirun -np 4 ./benchprecice.
+ *
+ * With repetitions > 1, each case is run several times and the repetition with the median run time
+ * is reported. If a baseline file, i.e. the output file of a previous run, is given, the results are
+ * compared against it and the executable fails if any case regressed by more than the tolerance
+ * or if a case that was run is missing in the baseline.
+ */
+int main(int argc, char* argv[])
+{
+  using namespace precice;
+
+  precice::testMode = true;
+  logging::setupLogging();
+  utils::Parallel::initializeMPI(&argc, &argv);
+  logging::setMPIRank(utils::Parallel::getProcessRank());
+  utils::Petsc::initialize(&argc, &argv);
+
+  std::string filter;
+  std::string outputFile;
+  std::string baselineFile;
+  double scale = 1.0;
+  double tolerance = 0.1;
+  int repetitions = 1;
+  for (int i = 1; i < argc; i++) {
+    std::string arg(argv[i]);
+    if (arg == "--filter" and i + 1 < argc) {
+      filter = argv[++i];
+    }
+    else if (arg == "--output" and i + 1 < argc) {
+      outputFile = argv[++i];
+    }
+    else if (arg == "--scale" and i + 1 < argc) {
+      scale = std::atof(argv[++i]);
+    }
+    else if (arg == "--repetitions" and i + 1 < argc) {
+      repetitions = std::max(1, std::atoi(argv[++i]));
+    }
+    else if (arg == "--baseline" and i + 1 < argc) {
+      baselineFile = argv[++i];
+    }
+    else if (arg == "--tolerance" and i + 1 < argc) {
+      tolerance = std::atof(argv[++i]);
+    }
+    else {
+      printUsage();
+      return 1;
+    }
+  }
+
+  bool isMaster = utils::Parallel::getProcessRank() == 0;
+  std::ofstream output;
+  if (not outputFile.empty() and isMaster) {
+    output.open(outputFile);
+  }
+  std::map<std::string, testing::Baseline> baselines;
+  if (not baselineFile.empty() and isMaster) {
+    baselines = testing::readBaselines(baselineFile);
+  }
+
+  int regressions = 0;
+  int missing = 0;
+  for (const auto& benchmark : testing::registry()) {
+    if (benchmark.name.find(filter) == std::string::npos) {
+      continue;
+    }
+    long long iterations = std::max(1LL, static_cast<long long>(benchmark.iterations * scale));
+    std::vector<testing::BenchmarkState> samples;
+    for (int repetition = 0; repetition < repetitions; repetition++) {
+      samples.push_back(testing::runBenchmark(benchmark, iterations));
+    }
+    std::sort(samples.begin(), samples.end(),
+              [](const testing::BenchmarkState& a, const testing::BenchmarkState& b) { return a.seconds() < b.seconds(); });
+    testing::BenchmarkState& state = samples[samples.size() / 2];
+
+    if (isMaster) {
+      if (repetitions > 1 and not state.skipped()) {
+        state.setCounter("repetitions", repetitions);
+      }
+      std::string result = testing::toJSON(benchmark.name, state);
+      std::cout << result << std::endl;
+      if (output.is_open()) {
+        output << result << std::endl;
+      }
+      if (baselineFile.empty() or state.skipped()) {
+        continue;
+      }
+      auto baseline = baselines.find(benchmark.name);
+      if (baseline == baselines.end()) {
+        std::cerr << "No baseline for " << benchmark.name << " in " << baselineFile << std::endl;
+        missing++;
+      }
+      else {
+        regressions += testing::compareWithBaseline(benchmark.name, state, baseline->second, tolerance);
+      }
+    }
+  }
+
+  if (regressions > 0) {
+    std::cerr << regressions << " metrics regressed compared to the baseline " << baselineFile << std::endl;
+  }
+  if (missing > 0) {
+    std::cerr << missing << " cases are missing in the baseline " << baselineFile << std::endl;
+  }
+
+  utils::Petsc::finalize();
+  utils::Parallel::finalizeMPI();
+  return regressions > 0 or missing > 0 ? 1 : 0;
+}
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <string>
+
+namespace precice
+{
+namespace testing
+{
+
+/// Measurement state handed to a benchmark case.
+/**
+ * The timed region of a case is the loop
+ *
+ *   while (state.keepRunning()) { ... }
+ *
+ * Setup before and teardown after the loop is not measured. The runner reports wall clock time,
+ * number of heap allocations and the user defined counters per iteration.
+ */
+class BenchmarkState
+{
+public:
+  using Clock = std::chrono::steady_clock;
+
+  explicit BenchmarkState(long long iterations);
+
+  /// Returns true as long as iterations are left, starts the timer on first call.
+  bool keepRunning();
+
+  /// Excludes the following code from the measurement, e.g. resetting data between iterations.
+  void pauseTiming();
+
+  /// Includes the following code in the measurement again.
+  void resumeTiming();
+
+  /// Sets the number of items (vertices, bytes, ...) processed in total, used to compute throughput.
+  void setItemsProcessed(double items);
+
+  /// Sets an arbitrary counter that is reported as is.
+  void setCounter(const std::string& name, double value);
+
+  /// Marks the case as skipped, e.g. if a communication backend is unavailable.
+  void skip(const std::string& reason);
+
+  bool skipped() const
+  {
+    return not _skipReason.empty();
+  }
+
+  const std::string& skipReason() const
+  {
+    return _skipReason;
+  }
+
+  long long iterations() const
+  {
+    return _iterations;
+  }
+
+  double seconds() const;
+
+  double itemsProcessed() const
+  {
+    return _items;
+  }
+
+  std::size_t allocations() const
+  {
+    return _allocations;
+  }
+
+  const std::map<std::string, double>& counters() const
+  {
+    return _counters;
+  }
+
+private:
+  long long _iterations;
+
+  long long _remaining;
+
+  bool _running = false;
+
+  Clock::time_point _start;
+
+  Clock::duration _elapsed = Clock::duration::zero();
+
+  std::size_t _allocationsAtStart = 0;
+
+  std::size_t _allocations = 0;
+
+  double _items = 0;
+
+  std::map<std::string, double> _counters;
+
+  std::string _skipReason;
+};
+
+using BenchmarkFunction = std::function<void(BenchmarkState&)>;
+
+/// Registers a benchmark case, returns true to allow static registration.
+/**
+ * The case runs on the first ranks ranks of the global communicator, which is restricted to these
+ * ranks during the case. The case is skipped if fewer ranks are available.
+ *
+ * Serial cases use PRECICE_BENCHMARK. Parallel and parameterized cases are registered by calling
+ * this function from a static initializer, e.g. bool registered = [] { registerBenchmark(...); return true; }();
+ */
+bool registerBenchmark(const std::string& name, BenchmarkFunction function, long long iterations, int ranks = 1);
+
+/// Returns the number of heap allocations done by the process so far.
+std::size_t allocationCount();
+
+} // namespace testing
+} // namespace precice
+
+/// Defines and registers a benchmark case which runs the given number of iterations.
+#define PRECICE_BENCHMARK(name, iterations)                                   \
+  static void name(precice::testing::BenchmarkState&);                        \
+  static bool name##Registered =                                              \
+    precice::testing::registerBenchmark(#name, name, iterations);             \
+  static void name(precice::testing::BenchmarkState& state)
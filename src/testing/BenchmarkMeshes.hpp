@@ -0,0 +1,68 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+#include <Eigen/Core>
+#include "mesh/Edge.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/Triangle.hpp"
+#include "mesh/Vertex.hpp"
+
+namespace precice
+{
+namespace testing
+{
+
+/// Creates a planar, structured surface mesh in 3D with about the given number of vertices.
+/**
+ * The vertices are placed on a square grid of the unit square at height z, shifted by offset in x
+ * and y. If withConnectivity is true, two triangles per grid cell, including their edges, are
+ * created. Data values are not allocated.
+ */
+inline mesh::PtrMesh createGridMesh(
+    const std::string& name,
+    int                vertices,
+    bool               withConnectivity = false,
+    double             offset = 0.0,
+    double             z = 0.0)
+{
+  mesh::PtrMesh mesh(new mesh::Mesh(name, 3, false));
+  int n = std::max(2, static_cast<int>(std::sqrt(static_cast<double>(vertices))));
+  double h = 1.0 / (n - 1);
+
+  std::vector<mesh::Vertex*> grid;
+  grid.reserve(n * n);
+  for (int j = 0; j < n; j++) {
+    for (int i = 0; i < n; i++) {
+      grid.push_back(&mesh->createVertex(Eigen::Vector3d(i * h + offset, j * h + offset, z)));
+    }
+  }
+
+  if (withConnectivity) {
+    auto vertex = [&](int i, int j) -> mesh::Vertex& { return *grid[j * n + i]; };
+    // Horizontal edge (i,j) starts at vertex (i,j), vertical edge (i,j) as well
+    std::vector<mesh::Edge*> horizontal, vertical;
+    horizontal.reserve(n * n);
+    vertical.reserve(n * n);
+    for (int j = 0; j < n; j++) {
+      for (int i = 0; i < n; i++) {
+        horizontal.push_back(i < n - 1 ? &mesh->createEdge(vertex(i, j), vertex(i + 1, j)) : nullptr);
+        vertical.push_back(j < n - 1 ? &mesh->createEdge(vertex(i, j), vertex(i, j + 1)) : nullptr);
+      }
+    }
+    for (int j = 0; j < n - 1; j++) {
+      for (int i = 0; i < n - 1; i++) {
+        mesh::Edge& diagonal = mesh->createEdge(vertex(i + 1, j), vertex(i, j + 1));
+        mesh->createTriangle(*horizontal[j * n + i], diagonal, *vertical[j * n + i]);
+        mesh->createTriangle(*vertical[j * n + i + 1], *horizontal[(j + 1) * n + i], diagonal);
+      }
+    }
+  }
+  mesh->computeState();
+  return mesh;
+}
+
+} // namespace testing
+} // namespace precice
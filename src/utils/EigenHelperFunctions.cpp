@@ -61,6 +61,88 @@ void append(
   v(n) = value;
 }
 
+int constantStride(const int* indices, int size)
+{
+  if (size == 1) {
+    return 1;
+  }
+  int first = indices[0];
+  int stride = indices[1] - first;
+  if (stride <= 0) {
+    return 0;
+  }
+  // No early exit, such that the comparisons are vectorized
+  bool equallySpaced = true;
+  for (int i = 2; i < size; i++) {
+    equallySpaced &= indices[i] == first + i * stride;
+  }
+  return equallySpaced ? stride : 0;
+}
+
+void scatterValues(const double* values, const int* indices, int size, int dimensions,
+                   Eigen::VectorXd& target)
+{
+  if (size == 0) {
+    return;
+  }
+  int stride = constantStride(indices, size);
+  if (stride == 1) {
+    assertion(indices[0] >= 0 and (indices[0] + size) * dimensions <= target.size(),
+              indices[0], size, target.size());
+    target.segment(indices[0] * dimensions, size * dimensions) =
+        Eigen::Map<const Eigen::VectorXd>(values, size * dimensions);
+  }
+  else if (stride > 1) {
+    assertion(indices[0] >= 0 and (indices[size - 1] + 1) * dimensions <= target.size(),
+              indices[0], indices[size - 1], target.size());
+    Eigen::Map<Eigen::MatrixXd, 0, Eigen::OuterStride<>>(
+        target.data() + indices[0] * dimensions, dimensions, size, Eigen::OuterStride<>(stride * dimensions)) =
+        Eigen::Map<const Eigen::MatrixXd>(values, dimensions, size);
+  }
+  else {
+    for (int i = 0; i < size; i++) {
+      int offsetInternal = indices[i] * dimensions;
+      assertion(offsetInternal >= 0 and offsetInternal + dimensions <= target.size(),
+                offsetInternal, target.size());
+      for (int dim = 0; dim < dimensions; dim++) {
+        target[offsetInternal + dim] = values[i * dimensions + dim];
+      }
+    }
+  }
+}
+
+void gatherValues(const Eigen::VectorXd& source, const int* indices, int size, int dimensions,
+                  double* values)
+{
+  if (size == 0) {
+    return;
+  }
+  int stride = constantStride(indices, size);
+  if (stride == 1) {
+    assertion(indices[0] >= 0 and (indices[0] + size) * dimensions <= source.size(),
+              indices[0], size, source.size());
+    Eigen::Map<Eigen::VectorXd>(values, size * dimensions) =
+        source.segment(indices[0] * dimensions, size * dimensions);
+  }
+  else if (stride > 1) {
+    assertion(indices[0] >= 0 and (indices[size - 1] + 1) * dimensions <= source.size(),
+              indices[0], indices[size - 1], source.size());
+    Eigen::Map<Eigen::MatrixXd>(values, dimensions, size) =
+        Eigen::Map<const Eigen::MatrixXd, 0, Eigen::OuterStride<>>(
+            source.data() + indices[0] * dimensions, dimensions, size, Eigen::OuterStride<>(stride * dimensions));
+  }
+  else {
+    for (int i = 0; i < size; i++) {
+      int offsetInternal = indices[i] * dimensions;
+      assertion(offsetInternal >= 0 and offsetInternal + dimensions <= source.size(),
+                offsetInternal, source.size());
+      for (int dim = 0; dim < dimensions; dim++) {
+        values[i * dimensions + dim] = source[offsetInternal + dim];
+      }
+    }
+  }
+}
+
 }}
 
 
@@ -15,6 +15,24 @@ void removeColumnFromMatrix(Eigen::MatrixXd& A, int col);
 
 void append(Eigen::VectorXd& v, double value);
 
+/// Returns the stride of equally spaced, ascending indices, or 0 if they are not equally spaced.
+int constantStride(const int* indices, int size);
+
+/**
+ * @brief Copies values of vertices from a contiguous array into data values.
+ *
+ * The values of vertex i of the array are stored at position indices[i] of the data values.
+ * Equally spaced indices are copied as a block instead of value by value.
+ *
+ * @param[in] dimensions Number of components per vertex.
+ */
+void scatterValues(const double* values, const int* indices, int size, int dimensions,
+                   Eigen::VectorXd& target);
+
+/// Copies values of vertices from data values into a contiguous array, the inverse of scatterValues().
+void gatherValues(const Eigen::VectorXd& source, const int* indices, int size, int dimensions,
+                  double* values);
+
 template<typename Derived1>
 void append(
     Eigen::MatrixXd& A,
@@ -2,6 +2,7 @@
 
 #include "MasterSlave.hpp"
 #include "Parallel.hpp"
+#include "com/Communication.hpp"
 
 #include <algorithm>
 #include <iostream>
@@ -20,6 +21,30 @@ extern bool testMode;
 namespace precice {
 namespace utils {
 
+namespace {
+/// Escapes quotes and backslashes, such that the string can be written as a JSON string value.
+std::string escapeJSON(const std::string & in)
+{
+  std::string out;
+  out.reserve(in.size());
+  for (char c : in) {
+    if (c == '"' or c == '\\')
+      out += '\\';
+    out += c;
+  }
+  return out;
+}
+
+/// Returns whether path is the path of an event with the given name inside the given enclosing path.
+bool isPathOf(const std::string & path, const std::string & enclosing, const std::string & name)
+{
+  return path.size() == enclosing.size() + 1 + name.size()
+         and path.compare(0, enclosing.size(), enclosing) == 0
+         and path[enclosing.size()] == '/'
+         and path.compare(enclosing.size() + 1, name.size(), name) == 0;
+}
+}
+
 logging::Logger Event::_log("utils::Events");
 
 Event::Event(std::string eventName, Clock::duration eventDuration)
@@ -28,6 +53,10 @@ Event::Event(std::string eventName, Clock::duration eventDuration)
     isStarted(false),
     _barrier(false)
 {
+  EventRegistry::enterScope(this);
+  EventRegistry::leaveScope(this);
+  stoptime = Clock::now();
+  starttime = stoptime - duration;
   EventRegistry::put(this);
 }
 
@@ -54,7 +83,11 @@ void Event::start(bool barrier)
   if (barrier)
     Parallel::synchronizeProcesses();
 
+  if (isStarted)
+    return;
+
   isStarted = true;
+  EventRegistry::enterScope(this);
   starttime = Clock::now();
   DEBUG("Started event " << name);
 }
@@ -68,6 +101,7 @@ void Event::stop(bool barrier)
     stoptime = Clock::now();
     isStarted = false;
     duration = Clock::duration(stoptime - starttime);
+    EventRegistry::leaveScope(this);
     EventRegistry::put(this);
     DEBUG("Stopped event " << name);
   }
@@ -78,18 +112,22 @@ Event::Clock::duration Event::getDuration()
   return duration;
 }
 
+const std::string& Event::getPath() const
+{
+  return _path;
+}
+
 // -----------------------------------------------------------------------
 
 
 void EventData::put(Event* event)
 {
-  if (not precice::utils::MasterSlave::_slaveMode) {
-    count++;
-    Event::Clock::duration duration = event->getDuration();
-    total += duration;
-    min = std::min(duration, min);
-    max = std::max(duration, max);
-  }
+  // Slaves accumulate as well, their data is used for the statistics over all ranks.
+  count++;
+  Event::Clock::duration duration = event->getDuration();
+  total += duration;
+  min = std::min(duration, min);
+  max = std::max(duration, max);
 }
 
 
@@ -114,6 +152,11 @@ int EventData::getTotal()
   return std::chrono::duration_cast<std::chrono::milliseconds>(total).count();
 }
 
+Event::Clock::duration EventData::getTotalDuration() const
+{
+  return total;
+}
+
 int EventData::getCount()
 {
   return count;
@@ -126,6 +169,15 @@ int EventData::getTimePercentage(Event::Clock::duration globalDuration)
 
 // -----------------------------------------------------------------------
 
+double RankStatistics::getImbalance() const
+{
+  if (avg <= 0)
+    return 0;
+  return (max / avg - 1.0) * 100;
+}
+
+// -----------------------------------------------------------------------
+
 // Static members need to be initalized like that
 std::map<std::string, EventData> EventRegistry::events;
 Event::Clock::time_point EventRegistry::globalStart;
@@ -133,6 +185,13 @@ Event::Clock::time_point EventRegistry::globalStop;
 std::string EventRegistry::applicationName = "";
 bool EventRegistry::initialized = false;
 std::map<std::string, double> EventRegistry::properties;
+std::map<std::string, EventData> EventRegistry::hierarchy;
+std::vector<std::string> EventRegistry::scopes;
+bool EventRegistry::timelineEnabled = false;
+std::vector<EventRegistry::TimelineEntry> EventRegistry::timeline;
+std::map<std::string, int> EventRegistry::timelinePathIDs;
+std::size_t EventRegistry::timelineOverflow = 0;
+std::map<std::string, RankStatistics> EventRegistry::rankStatistics;
 
 void EventRegistry::initialize(std::string appName)
 {
@@ -145,27 +204,135 @@ void EventRegistry::finalize()
 {
   globalStop = Event::Clock::now();
   initialized = false;
+  reduceRanks();
+}
+
+void EventRegistry::enableTimeline(std::size_t capacity)
+{
+  timeline.clear();
+  timeline.reserve(capacity);
+  timelineEnabled = capacity > 0;
 }
 
 void EventRegistry::clear()
 {
   events.clear();
   properties.clear();
+  hierarchy.clear();
+  scopes.clear();
+  timeline.clear();
+  timelinePathIDs.clear();
+  timelineOverflow = 0;
+  rankStatistics.clear();
 }
 
 void EventRegistry::signal_handler(int signal)
 {
   if (initialized) {
-    finalize();
+    // Do not call finalize, the reduction over all ranks could hang in a crashing program
+    globalStop = Event::Clock::now();
+    initialized = false;
     printAll();
   }
 }
 
 void EventRegistry::put(Event* event)
 {
-  EventData data = events[event->name];
-  data.put(event);
-  events[event->name] = data;
+  events[event->name].put(event);
+  hierarchy[event->_path].put(event);
+
+  if (timelineEnabled) {
+    if (timeline.size() < timeline.capacity()) {
+      // Only new paths insert into the map, the ID is the number of known paths
+      auto pathID = timelinePathIDs.find(event->_path);
+      if (pathID == timelinePathIDs.end())
+        pathID = timelinePathIDs.emplace(event->_path, timelinePathIDs.size()).first;
+      timeline.push_back(TimelineEntry{pathID->second, event->_depth, event->starttime, event->stoptime});
+    }
+    else {
+      timelineOverflow++;
+    }
+  }
+}
+
+void EventRegistry::enterScope(Event* event)
+{
+  event->_depth = scopes.size();
+  // Events are usually restarted within the same enclosing event, the path is then kept
+  if (scopes.empty()) {
+    if (event->_path != event->name)
+      event->_path = event->name;
+  }
+  else if (not isPathOf(event->_path, scopes.back(), event->name)) {
+    event->_path = scopes.back() + "/" + event->name;
+  }
+  scopes.push_back(event->_path);
+}
+
+void EventRegistry::leaveScope(Event* event)
+{
+  // Events are usually stopped in reverse order, but do not rely on it
+  auto scope = std::find(scopes.rbegin(), scopes.rend(), event->_path);
+  if (scope != scopes.rend())
+    scopes.erase(std::next(scope).base());
+}
+
+void EventRegistry::reduceRanks()
+{
+  rankStatistics.clear();
+
+  if (MasterSlave::_slaveMode) {
+    if (MasterSlave::_communication == nullptr or not MasterSlave::_communication->isConnected())
+      return;
+    MasterSlave::_communication->send(static_cast<int>(events.size()), 0);
+    for (auto & e : events) {
+      MasterSlave::_communication->send(e.first, 0);
+      MasterSlave::_communication->send(static_cast<double>(e.second.getTotal()), 0);
+    }
+    return;
+  }
+
+  // Accumulates min, max and the sum, which is divided to get the average
+  auto addRank = [](const std::string & name, double total) {
+    RankStatistics & stats = rankStatistics[name];
+    stats.min = (stats.ranks == 0) ? total : std::min(stats.min, total);
+    stats.max = (stats.ranks == 0) ? total : std::max(stats.max, total);
+    stats.avg += total;
+    stats.ranks++;
+  };
+
+  for (auto & e : events) {
+    addRank(e.first, e.second.getTotal());
+  }
+
+  if (MasterSlave::_masterMode and MasterSlave::_communication != nullptr
+      and MasterSlave::_communication->isConnected()) {
+    for (int rankSlave = 1; rankSlave < MasterSlave::_size; rankSlave++) {
+      int numberOfEvents = 0;
+      MasterSlave::_communication->receive(numberOfEvents, rankSlave);
+      for (int i = 0; i < numberOfEvents; i++) {
+        std::string name;
+        double total = 0;
+        MasterSlave::_communication->receive(name, rankSlave);
+        MasterSlave::_communication->receive(total, rankSlave);
+        addRank(name, total);
+      }
+    }
+  }
+
+  for (auto & stats : rankStatistics) {
+    stats.second.avg /= stats.second.ranks;
+  }
+}
+
+const std::map<std::string, RankStatistics>& EventRegistry::getRankStatistics()
+{
+  return rankStatistics;
+}
+
+const std::map<std::string, EventData>& EventRegistry::getHierarchy()
+{
+  return hierarchy;
 }
 
 void EventRegistry::addProp(std::string property, double value)
@@ -200,6 +367,10 @@ void EventRegistry::print(std::ostream &out, bool terse)
     using std::left; using std::right;
     Event::Clock::duration globalDuration = globalStop - globalStart;
 
+    // Restored after the output, such that the formatting does not leak to the caller
+    std::ios_base::fmtflags flags = out.flags();
+    std::streamsize precision = out.precision();
+
     std::time_t currentTime = std::time(nullptr);
 
     if (not terse) {
@@ -225,6 +396,38 @@ void EventRegistry::print(std::ostream &out, bool terse)
         out << "\n";
       }
 
+      out << "Event hierarchy                      Count   Total[ms]     Avg[ms]      T[%]" << endl;
+      out << "--------------------------------------------------------------------------------" << endl;
+      for (auto & e : hierarchy) {
+        auto depth = std::count(e.first.begin(), e.first.end(), '/');
+        auto name = e.first.substr(e.first.rfind('/') + 1);
+        out << std::string(2 * depth, ' ')
+            << setw(30 - 2 * depth) << left << name << right
+            << setw(12) << e.second.getCount()
+            << setw(12) << e.second.getTotal()
+            << setw(12) << e.second.getAvg()
+            << setw(10) << e.second.getTimePercentage(globalDuration)
+            << "\n";
+      }
+      out << "\n";
+
+      if (MasterSlave::_masterMode and not rankStatistics.empty()) {
+        out << "Event totals over all ranks          Ranks     Min[ms]     Max[ms]     Avg[ms] Imbalance[%]" << endl;
+        out << "-------------------------------------------------------------------------------------------" << endl;
+        for (auto & e : rankStatistics) {
+          out << setw(30) << left << e.first << right
+              << setw(12) << e.second.ranks
+              << setw(12) << e.second.min
+              << setw(12) << e.second.max
+              << setw(12) << std::fixed << setprecision(1) << e.second.avg
+              << setw(13) << e.second.getImbalance()
+              << "\n";
+          out.flags(flags);
+          out.precision(precision);
+        }
+        out << "\n";
+      }
+
       out << "Properties from all Events, accumulated" << "\n";
       out << "---------------------------------------" << "\n";
       for (auto a : properties) {
@@ -257,6 +460,8 @@ void EventRegistry::print(std::ostream &out, bool terse)
     }
 
     out << endl << std::flush;
+    out.flags(flags);
+    out.precision(precision);
   }
 }
 
@@ -273,6 +478,51 @@ void EventRegistry::print(std::string filename, bool terse)
   outfile.close();
 }
 
+void EventRegistry::writeTrace(std::ostream &out)
+{
+  using std::chrono::duration_cast;
+  using std::chrono::microseconds;
+
+  std::vector<const std::string*> paths(timelinePathIDs.size());
+  for (auto & path : timelinePathIDs)
+    paths[path.second] = &path.first;
+
+  int rank = MasterSlave::_masterMode or MasterSlave::_slaveMode ? MasterSlave::_rank : 0;
+
+  const std::string application = escapeJSON(applicationName);
+
+  out << "{\"traceEvents\": [\n";
+  out << "{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": " << rank
+      << ", \"args\": {\"name\": \"" << application << " rank " << rank << "\"}}";
+  for (auto & entry : timeline) {
+    const std::string path = escapeJSON(*paths[entry.pathID]);
+    out << ",\n{\"name\": \"" << path.substr(path.rfind('/') + 1) << "\""
+        << ", \"cat\": \"" << application << "\""
+        << ", \"ph\": \"X\", \"pid\": " << rank << ", \"tid\": 0"
+        << ", \"ts\": " << duration_cast<microseconds>(entry.start - globalStart).count()
+        << ", \"dur\": " << duration_cast<microseconds>(entry.stop - entry.start).count()
+        << ", \"args\": {\"path\": \"" << path << "\", \"depth\": " << entry.depth << "}}";
+  }
+  out << "\n],\n\"displayTimeUnit\": \"ms\",\n"
+      << "\"otherData\": {\"application\": \"" << application << "\", \"rank\": " << rank
+      << ", \"droppedEvents\": " << timelineOverflow << "}}" << std::endl;
+}
+
+void EventRegistry::writeTrace()
+{
+  if (not timelineEnabled)
+    return;
+
+  int rank = MasterSlave::_masterMode or MasterSlave::_slaveMode ? MasterSlave::_rank : 0;
+  std::string filename = "EventTimings-";
+  if (not applicationName.empty())
+    filename += applicationName + "-";
+  filename += std::to_string(rank) + ".json";
+
+  std::ofstream outfile(filename);
+  writeTrace(outfile);
+}
+
 void EventRegistry::printGlobalDuration()
 {
   if (precice::utils::MasterSlave::_slaveMode || precice::testMode)
@@ -1,8 +1,10 @@
 #pragma once
 
 #include <chrono>
+#include <cstddef>
 #include <map>
 #include <string>
+#include <vector>
 #include "logging/Logger.hpp"
 
 namespace precice {
@@ -14,6 +16,8 @@ A property is a a key-value pair with a numerical value that can be used to trac
 like MPI calls in an event. It is intended to be set by the user. */
 class Event
 {
+  friend class EventRegistry;
+
 public:
   /// Default clock type. All other chrono types are derived from it.
   using Clock = std::chrono::steady_clock;
@@ -40,6 +44,9 @@ public:
   /// Gets the duration of the event.
   Clock::duration getDuration();
 
+  /// Gets the hierarchical name of the event, i.e., the names of all enclosing events and its own, separated by "/".
+  const std::string& getPath() const;
+
 private:
   Clock::time_point starttime;
   Clock::time_point stoptime;
@@ -47,6 +54,12 @@ private:
   bool isStarted = false;
   bool _barrier = false;
 
+  /// Hierarchical name, set when the event is started.
+  std::string _path;
+
+  /// Nesting level of the event, 0 for top-level events.
+  int _depth = 0;
+
   static logging::Logger _log;
 };
 
@@ -70,6 +83,9 @@ public:
   /// Get the total duration of all events so far
   int getTotal();
 
+  /// Get the total duration of all events so far with the full precision of the clock
+  Event::Clock::duration getTotalDuration() const;
+
   /// Get the number of all events so far
   int getCount();
 
@@ -85,10 +101,34 @@ private:
 };
 
 
+/// Statistics of the total duration of an event over all ranks of a participant.
+struct RankStatistics
+{
+  /// Number of ranks on which the event occurred.
+  int ranks = 0;
+
+  /// Minimum total duration on a single rank in ms.
+  double min = 0;
+
+  /// Maximum total duration on a single rank in ms.
+  double max = 0;
+
+  /// Average total duration over all ranks on which the event occurred in ms.
+  double avg = 0;
+
+  /// Load imbalance in percent, i.e., how much longer the slowest rank took compared to the average.
+  double getImbalance() const;
+};
+
+
 /// High level object that stores data of all events.
 /** Call EventRegistry::intialize at the beginning of your application and
 EventRegistry::finalize at the end. Event timings will be usuable without calling this
-function at all, but global timings as well as percentages do not work this way.  */
+function at all, but global timings as well as percentages do not work this way.
+
+Events started while another event is running are nested into the running event. Besides the flat
+accumulation by name, the registry accumulates events by their hierarchical path and optionally records
+every single event into a preallocated timeline, which can be exported in the Chrome trace event format. */
 class EventRegistry
 {
 public:
@@ -99,8 +139,19 @@ public:
   static void initialize(std::string appName = "");
 
   /// Sets the global end time
+  /**
+   * If a master-slave communication is set up, the durations of all events are gathered on the
+   * master and reduced to RankStatistics. This requires the communication to be still connected.
+   */
   static void finalize();
 
+  /// Enables recording of each single event into a timeline.
+  /**
+   * The timeline buffer is allocated here for the given number of events. If the buffer is full,
+   * further events are counted, but not recorded.
+   */
+  static void enableTimeline(std::size_t capacity);
+
   /// Clears the registry. needed for tests
   static void clear();
 
@@ -110,6 +161,21 @@ public:
   /// Records the event.
   static void put(Event* event);
 
+  /// Opens a new scope for a starting event, sets path and depth of the event.
+  static void enterScope(Event* event);
+
+  /// Closes the scope of a stopping event.
+  static void leaveScope(Event* event);
+
+  /// Gathers the event durations of all ranks on the master, see finalize().
+  static void reduceRanks();
+
+  /// Returns the statistics over all ranks, only available on the master after finalize().
+  static const std::map<std::string, RankStatistics>& getRankStatistics();
+
+  /// Returns the data of all events accumulated by their hierarchical path, e.g. "advance/map".
+  static const std::map<std::string, EventData>& getHierarchy();
+
   /// Adds a value to the global property store.
   /** An existing value is added. */ 
   static void addProp(std::string property, double value);
@@ -133,12 +199,47 @@ public:
 
   static void printGlobalDuration();
 
+  /// Writes the recorded timeline in the Chrome trace event format (chrome://tracing, Perfetto).
+  static void writeTrace(std::ostream &out);
+
+  /// Writes the timeline to EventTimings-AppName-Rank.json, if the timeline is enabled.
+  static void writeTrace();
+
 private:
+  /// One recorded event of the timeline.
+  struct TimelineEntry
+  {
+    /// Index into timelineNames.
+    int pathID;
+    int depth;
+    Event::Clock::time_point start;
+    Event::Clock::time_point stop;
+  };
+
   static bool initialized;
   static Event::Clock::time_point globalStart;
   static Event::Clock::time_point globalStop;
   static std::map<std::string, EventData> events;
 
+  /// Events accumulated by their hierarchical path.
+  static std::map<std::string, EventData> hierarchy;
+
+  /// Paths of all running events, the innermost running event is at the back.
+  static std::vector<std::string> scopes;
+
+  static bool timelineEnabled;
+
+  /// Preallocated buffer for the timeline.
+  static std::vector<TimelineEntry> timeline;
+
+  /// Maps the paths used in the timeline to their IDs.
+  static std::map<std::string, int> timelinePathIDs;
+
+  /// Number of events not recorded, because the timeline was full.
+  static std::size_t timelineOverflow;
+
+  static std::map<std::string, RankStatistics> rankStatistics;
+
   /// Map of additional properties that can be set by the user.
   static std::map<std::string, double> properties;
 
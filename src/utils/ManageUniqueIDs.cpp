@@ -1,39 +1,51 @@
 #include "utils/ManageUniqueIDs.hpp"
+#include "utils/assertion.hpp"
 
 namespace precice {
 namespace utils {
 
 ManageUniqueIDs:: ManageUniqueIDs ()
 :
-   _ids (),
+   _used (),
    _lowerLimit (0)
 {}
 
 int ManageUniqueIDs:: getFreeID ()
 {
-   bool notFound = true;
-   while (notFound) {
-      if (_ids.count(_lowerLimit) == 0) {
-         notFound = false;
-      }
+   while (_lowerLimit < static_cast<int>(_used.size()) && _used[_lowerLimit]) {
       _lowerLimit++;
    }
-   _ids.insert(_lowerLimit - 1);
+   if (_lowerLimit == static_cast<int>(_used.size())) {
+      _used.push_back(true);
+   }
+   else {
+      _used[_lowerLimit] = true;
+   }
+   _lowerLimit++;
    return _lowerLimit - 1;
 }
 
 bool ManageUniqueIDs:: insertID ( int id )
 {
-   if (_ids.count(id) != 0)
+   assertion(id >= 0, id);
+   if (id >= static_cast<int>(_used.size())) {
+      _used.resize(id + 1, false);
+   }
+   else if (_used[id]) {
       return false;
-   else
-      _ids.insert (id);
+   }
+   _used[id] = true;
    return true;
 }
 
+void ManageUniqueIDs:: reserveCapacity ( int count )
+{
+   _used.reserve(_used.size() + count);
+}
+
 void ManageUniqueIDs:: resetIDs ()
 {
-   _ids.clear ();
+   _used.clear ();
    _lowerLimit = 0;
 }
 
@@ -1,13 +1,16 @@
 #ifndef PRECICE_UTILS_MANAGEUNIQUEIDS_HPP_
 #define PRECICE_UTILS_MANAGEUNIQUEIDS_HPP_
 
-#include <set>
+#include <vector>
 
 namespace precice {
 namespace utils {
 
 /**
  * @brief Manages a set of unique IDs.
+ *
+ * IDs are non-negative and dense in practice, hence the used IDs are stored as one bit per
+ * ID, from zero to the highest used ID.
  */
 class ManageUniqueIDs
 {
@@ -31,6 +34,13 @@ public:
     */
    bool insertID ( int id );
 
+   /**
+    * @brief Reserves storage for the given number of further IDs, no IDs are taken.
+    *
+    * Avoids repeated reallocations when many IDs are obtained, e.g. while building a mesh.
+    */
+   void reserveCapacity ( int count );
+
    /**
     * @brief Resets all retrieved and inserted IDs.
     */
@@ -38,8 +48,8 @@ public:
 
 private:
 
-   // @brief Stores all used IDs.
-   std::set<int> _ids;
+   // @brief Marks all used IDs.
+   std::vector<bool> _used;
 
    // @brief Marks next ID to be given, from lower to higher values.
    int _lowerLimit;
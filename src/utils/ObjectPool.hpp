@@ -0,0 +1,112 @@
+#pragma once
+
+#include <algorithm>
+#include <boost/noncopyable.hpp>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace precice {
+namespace utils {
+
+/// Owns objects of one type, which are placed consecutively into slabs of growing size.
+/**
+ * Objects are created by create() and live until clear() is called or the pool is destroyed.
+ * There is no release of single objects. clear() destroys all objects but keeps the slabs, such
+ * that a pool which is filled and cleared repeatedly, e.g. by a temporary mesh, allocates only
+ * while growing beyond its previous size.
+ */
+template<typename T>
+class ObjectPool : private boost::noncopyable
+{
+public:
+  ObjectPool() = default;
+
+  ~ObjectPool()
+  {
+    clear();
+    for (Slab& slab : _slabs) {
+      ::operator delete(slab.memory);
+    }
+  }
+
+  /// Constructs a new object from the given arguments and returns a pointer to it.
+  template<typename... ARGS>
+  T* create(ARGS&&... args)
+  {
+    while (_current < _slabs.size() && _slabs[_current].size == _slabs[_current].capacity) {
+      _current++;
+    }
+    if (_current == _slabs.size()) {
+      std::size_t capacity = _slabs.empty() ? MIN_SLAB_SIZE
+                                            : std::min(2 * _slabs.back().capacity, MAX_SLAB_SIZE);
+      _slabs.push_back(Slab{static_cast<char*>(::operator new(capacity * sizeof(T))), capacity, 0});
+    }
+    Slab& slab = _slabs[_current];
+    T* object = new (slab.memory + slab.size * sizeof(T)) T(std::forward<ARGS>(args)...);
+    slab.size++;
+    _size++;
+    return object;
+  }
+
+  /// Destroys all objects, the memory is kept for objects created afterwards.
+  void clear()
+  {
+    for (Slab& slab : _slabs) {
+      if (not std::is_trivially_destructible<T>::value) {
+        for (std::size_t i = 0; i < slab.size; i++) {
+          reinterpret_cast<T*>(slab.memory + i * sizeof(T))->~T();
+        }
+      }
+      slab.size = 0;
+    }
+    _current = 0;
+    _size = 0;
+  }
+
+  /// Returns the number of living objects.
+  std::size_t size() const
+  {
+    return _size;
+  }
+
+  /// Returns the number of objects that fit into the allocated slabs.
+  std::size_t capacity() const
+  {
+    std::size_t capacity = 0;
+    for (const Slab& slab : _slabs) {
+      capacity += slab.capacity;
+    }
+    return capacity;
+  }
+
+private:
+  /// Number of objects in the first slab.
+  static constexpr std::size_t MIN_SLAB_SIZE = 16;
+
+  /// Number of objects after which slabs stop growing.
+  static constexpr std::size_t MAX_SLAB_SIZE = 16384;
+
+  struct Slab {
+    char* memory;
+    std::size_t capacity;
+    std::size_t size;
+  };
+
+  std::vector<Slab> _slabs;
+
+  /// Index of the first slab which may have space left.
+  std::size_t _current = 0;
+
+  std::size_t _size = 0;
+};
+
+template<typename T>
+constexpr std::size_t ObjectPool<T>::MIN_SLAB_SIZE;
+
+template<typename T>
+constexpr std::size_t ObjectPool<T>::MAX_SLAB_SIZE;
+
+}} // namespace precice, utils
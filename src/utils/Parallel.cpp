@@ -209,6 +209,18 @@ void Parallel::synchronizeProcesses()
 #endif // not PRECICE_NO_MPI
 }
 
+void Parallel::broadcast(std::string &content)
+{
+#ifndef PRECICE_NO_MPI
+  TRACE();
+  assertion(_isInitialized);
+  int length = content.size();
+  MPI_Bcast(&length, 1, MPI_INT, 0, _globalCommunicator);
+  content.resize(length);
+  MPI_Bcast(&content[0], length, MPI_CHAR, 0, _globalCommunicator);
+#endif // not PRECICE_NO_MPI
+}
+
 void Parallel::synchronizeLocalProcesses()
 {
 #ifndef PRECICE_NO_MPI
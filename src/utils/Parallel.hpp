@@ -80,6 +80,9 @@ public:
   /// Synchronizes all processes.
   static void synchronizeProcesses();
 
+  /// Broadcasts a string from the process with rank 0 to all processes of the communicator.
+  static void broadcast(std::string &content);
+
   /**
    * @brief Synchronizes all local processes.
    *
@@ -0,0 +1,29 @@
+#include "Threads.hpp"
+#include <cstdlib>
+#include "utils/Parallel.hpp"
+
+namespace precice {
+namespace utils {
+
+namespace {
+int threadCountOverride = 0;
+}
+
+int getThreadCount()
+{
+  if (threadCountOverride > 0) {
+    return threadCountOverride;
+  }
+  if (const char* threads = std::getenv("PRECICE_NUM_THREADS")) {
+    return std::max(1, std::atoi(threads));
+  }
+  int hardwareThreads = static_cast<int>(std::thread::hardware_concurrency());
+  return std::max(1, hardwareThreads / std::max(1, Parallel::getCommunicatorSize()));
+}
+
+void setThreadCount(int threads)
+{
+  threadCountOverride = threads;
+}
+
+}} // namespace precice, utils
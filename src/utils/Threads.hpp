@@ -0,0 +1,58 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace precice {
+namespace utils {
+
+/// Returns the number of threads used by parallelFor() on this process.
+/**
+ * Is given by the environment variable PRECICE_NUM_THREADS. Otherwise, the hardware threads of
+ * the node are divided among the processes of the global communicator, assuming that they share
+ * one node.
+ */
+int getThreadCount();
+
+/// Overrides the number of threads used by parallelFor(), a value of 0 restores the default.
+void setThreadCount(int threads);
+
+/// Calls function(i) for all i in [begin, end), distributed in contiguous blocks over threads.
+/**
+ * Each thread handles at least grainSize indices, such that short loops are executed by the
+ * calling thread only. The function has to be safe to call concurrently for different indices.
+ */
+template<typename FUNCTION_T>
+void parallelFor(size_t begin, size_t end, size_t grainSize, FUNCTION_T function)
+{
+  if (end <= begin) {
+    return;
+  }
+  size_t size = end - begin;
+  size_t blocks = std::min<size_t>(getThreadCount(), size / std::max<size_t>(grainSize, 1));
+  if (blocks <= 1) {
+    for (size_t i = begin; i < end; i++) {
+      function(i);
+    }
+    return;
+  }
+  auto runBlock = [&](size_t block) {
+    size_t blockEnd = begin + size * (block + 1) / blocks;
+    for (size_t i = begin + size * block / blocks; i < blockEnd; i++) {
+      function(i);
+    }
+  };
+  std::vector<std::thread> threads;
+  threads.reserve(blocks - 1);
+  for (size_t block = 1; block < blocks; block++) {
+    threads.emplace_back(runBlock, block);
+  }
+  runBlock(0);
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+}
+
+}} // namespace precice, utils
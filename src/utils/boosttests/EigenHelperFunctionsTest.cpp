@@ -0,0 +1,47 @@
+#include <Eigen/Core>
+#include <vector>
+#include "testing/Testing.hpp"
+#include "utils/EigenHelperFunctions.hpp"
+
+using namespace precice::utils;
+
+BOOST_AUTO_TEST_SUITE(UtilsTests)
+
+BOOST_AUTO_TEST_CASE(ConstantStride)
+{
+  std::vector<int> contiguous {3, 4, 5, 6};
+  BOOST_TEST(constantStride(contiguous.data(), 4) == 1);
+  std::vector<int> strided {1, 4, 7};
+  BOOST_TEST(constantStride(strided.data(), 3) == 3);
+  std::vector<int> unordered {0, 2, 1};
+  BOOST_TEST(constantStride(unordered.data(), 3) == 0);
+  std::vector<int> descending {2, 1, 0};
+  BOOST_TEST(constantStride(descending.data(), 3) == 0);
+  BOOST_TEST(constantStride(unordered.data(), 1) == 1);
+}
+
+BOOST_AUTO_TEST_CASE(ScatterGatherValues)
+{
+  const int dimensions = 2;
+  std::vector<double> values {1, 2, 3, 4, 5, 6};
+
+  // Contiguous, strided and arbitrary indices give the same result as a plain loop
+  for (std::vector<int> indices : {std::vector<int>{1, 2, 3}, std::vector<int>{0, 2, 4},
+                                   std::vector<int>{4, 0, 3}}) {
+    Eigen::VectorXd target = Eigen::VectorXd::Zero(5 * dimensions);
+    scatterValues(values.data(), indices.data(), 3, dimensions, target);
+    Eigen::VectorXd expected = Eigen::VectorXd::Zero(5 * dimensions);
+    for (int i = 0; i < 3; i++) {
+      for (int dim = 0; dim < dimensions; dim++) {
+        expected[indices[i] * dimensions + dim] = values[i * dimensions + dim];
+      }
+    }
+    BOOST_TEST(target == expected);
+
+    std::vector<double> gathered(values.size(), 0.0);
+    gatherValues(target, indices.data(), 3, dimensions, gathered.data());
+    BOOST_TEST(gathered == values, boost::test_tools::per_element());
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
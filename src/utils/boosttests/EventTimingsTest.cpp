@@ -0,0 +1,125 @@
+#include "testing/Testing.hpp"
+#include "utils/EventTimings.hpp"
+#include "utils/MasterSlave.hpp"
+
+#include <sstream>
+
+using namespace precice::utils;
+
+BOOST_AUTO_TEST_SUITE(UtilsTests)
+BOOST_AUTO_TEST_SUITE(EventTimingsTests)
+
+BOOST_AUTO_TEST_CASE(NestedEvents, * precice::testing::OnMaster())
+{
+  EventRegistry::clear();
+  {
+    Event outer("outer");
+    BOOST_TEST(outer.getPath() == "outer");
+    {
+      Event inner("inner");
+      BOOST_TEST(inner.getPath() == "outer/inner");
+    }
+    Event sibling("sibling", false, false);
+    sibling.start();
+    BOOST_TEST(sibling.getPath() == "outer/sibling");
+  }
+  Event after("after");
+  BOOST_TEST(after.getPath() == "after");
+  EventRegistry::clear();
+}
+
+BOOST_AUTO_TEST_CASE(RestartedEvents, * precice::testing::OnMaster())
+{
+  EventRegistry::clear();
+  // A restarted event takes the path of its current enclosing event
+  Event restarted("restarted", false, false);
+  restarted.start();
+  restarted.stop();
+  BOOST_TEST(restarted.getPath() == "restarted");
+  {
+    Event outer("outer");
+    for (int i = 0; i < 2; i++) {
+      restarted.start();
+      BOOST_TEST(restarted.getPath() == "outer/restarted");
+      restarted.stop();
+    }
+    Event inner("inner");
+    restarted.start();
+    BOOST_TEST(restarted.getPath() == "outer/inner/restarted");
+    restarted.stop();
+  }
+  restarted.start();
+  BOOST_TEST(restarted.getPath() == "restarted");
+  restarted.stop();
+  EventRegistry::clear();
+}
+
+BOOST_AUTO_TEST_CASE(Timeline, * precice::testing::OnMaster())
+{
+  EventRegistry::clear();
+  EventRegistry::enableTimeline(2);
+  {
+    Event outer("outer");
+    Event inner("inner");
+  }
+  Event dropped("dropped");
+  dropped.stop();
+
+  std::ostringstream trace;
+  EventRegistry::writeTrace(trace);
+  BOOST_TEST(trace.str().find("\"path\": \"outer/inner\", \"depth\": 1") != std::string::npos);
+  BOOST_TEST(trace.str().find("\"path\": \"outer\", \"depth\": 0") != std::string::npos);
+  BOOST_TEST(trace.str().find("\"droppedEvents\": 1") != std::string::npos);
+
+  EventRegistry::enableTimeline(0);
+  EventRegistry::clear();
+}
+
+BOOST_AUTO_TEST_CASE(TimelineEscaping, * precice::testing::OnMaster())
+{
+  EventRegistry::clear();
+  EventRegistry::enableTimeline(1);
+  {
+    Event e("say \"hi\"\\");
+  }
+
+  std::ostringstream trace;
+  EventRegistry::writeTrace(trace);
+  BOOST_TEST(trace.str().find("\"name\": \"say \\\"hi\\\"\\\\\"") != std::string::npos);
+
+  EventRegistry::enableTimeline(0);
+  EventRegistry::clear();
+}
+
+BOOST_AUTO_TEST_CASE(PrintKeepsFormatting, * precice::testing::OnMaster())
+{
+  EventRegistry::clear();
+  Event e("event", std::chrono::milliseconds(10));
+  EventRegistry::reduceRanks();
+
+  // Also prints the rank statistics, which use a fixed precision
+  MasterSlave::_masterMode = true;
+  std::ostringstream out;
+  out.precision(3);
+  EventRegistry::print(out);
+  MasterSlave::_masterMode = false;
+  BOOST_TEST(out.precision() == 3);
+  BOOST_TEST((out.flags() & std::ios_base::floatfield) == 0);
+  EventRegistry::clear();
+}
+
+BOOST_AUTO_TEST_CASE(RankStatisticsSerial, * precice::testing::OnMaster())
+{
+  EventRegistry::clear();
+  Event e("event", std::chrono::milliseconds(10));
+  EventRegistry::reduceRanks();
+  auto & stats = EventRegistry::getRankStatistics().at("event");
+  BOOST_TEST(stats.ranks == 1);
+  BOOST_TEST(stats.min == 10);
+  BOOST_TEST(stats.max == 10);
+  BOOST_TEST(stats.getImbalance() == 0);
+  EventRegistry::clear();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
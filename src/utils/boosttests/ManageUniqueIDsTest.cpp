@@ -16,6 +16,18 @@ BOOST_AUTO_TEST_CASE(UniqueIDs)
   BOOST_TEST(success);
   id = uniqueIDs.getFreeID();
   BOOST_TEST(id == 3);
+  BOOST_TEST(not uniqueIDs.insertID(1));
+
+  // IDs above the used ones can be inserted and are skipped afterwards
+  BOOST_TEST(uniqueIDs.insertID(5));
+  uniqueIDs.reserveCapacity(10);
+  BOOST_TEST(uniqueIDs.getFreeID() == 4);
+  BOOST_TEST(uniqueIDs.getFreeID() == 6);
+
+  uniqueIDs.resetIDs();
+  BOOST_TEST(uniqueIDs.getFreeID() == 0);
+  BOOST_TEST(uniqueIDs.insertID(1));
+  BOOST_TEST(uniqueIDs.getFreeID() == 2);
 }
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,56 @@
+#include "testing/Testing.hpp"
+#include "utils/ObjectPool.hpp"
+
+using namespace precice;
+
+BOOST_AUTO_TEST_SUITE(UtilsTests)
+
+namespace
+{
+struct Counted {
+  Counted(int value, int& living)
+      : value(value), living(living)
+  {
+    living++;
+  }
+
+  ~Counted()
+  {
+    living--;
+  }
+
+  int  value;
+  int& living;
+};
+} // namespace
+
+BOOST_AUTO_TEST_CASE(ObjectPool)
+{
+  int living = 0;
+  {
+    utils::ObjectPool<Counted> pool;
+    std::vector<Counted*> objects;
+    for (int i = 0; i < 100; i++) {
+      objects.push_back(pool.create(i, living));
+    }
+    BOOST_TEST(pool.size() == 100);
+    BOOST_TEST(living == 100);
+    for (int i = 0; i < 100; i++) {
+      BOOST_TEST(objects[i]->value == i);
+    }
+
+    // Cleared memory is reused
+    size_t capacity = pool.capacity();
+    pool.clear();
+    BOOST_TEST(pool.size() == 0);
+    BOOST_TEST(living == 0);
+    for (int i = 0; i < 100; i++) {
+      pool.create(i, living);
+    }
+    BOOST_TEST(pool.capacity() == capacity);
+    BOOST_TEST(living == 100);
+  }
+  BOOST_TEST(living == 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
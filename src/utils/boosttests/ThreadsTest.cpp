@@ -0,0 +1,43 @@
+#include <atomic>
+#include <vector>
+#include "testing/Testing.hpp"
+#include "utils/Threads.hpp"
+
+using namespace precice::utils;
+
+BOOST_AUTO_TEST_SUITE(UtilsTests)
+
+BOOST_AUTO_TEST_CASE(ParallelFor)
+{
+  setThreadCount(4);
+  BOOST_TEST(getThreadCount() == 4);
+
+  // Every index is visited once, also if the range is not divisible by the number of threads
+  std::vector<int> visits(1001, 0);
+  std::atomic<int> calls(0);
+  parallelFor(1, visits.size(), 10, [&](size_t i) {
+    visits[i]++;
+    calls++;
+  });
+  BOOST_TEST(calls == 1000);
+  BOOST_TEST(visits[0] == 0);
+  for (size_t i = 1; i < visits.size(); i++) {
+    BOOST_TEST(visits[i] == 1);
+  }
+
+  // Ranges shorter than the grain size run on the calling thread
+  std::thread::id caller = std::this_thread::get_id();
+  bool onCaller = true;
+  parallelFor(0, 5, 10, [&](size_t) {
+    onCaller = onCaller && std::this_thread::get_id() == caller;
+  });
+  BOOST_TEST(onCaller);
+
+  parallelFor(3, 3, 1, [&](size_t) { calls++; });
+  BOOST_TEST(calls == 1000);
+
+  setThreadCount(0);
+  BOOST_TEST(getThreadCount() >= 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -63,7 +63,23 @@ ConfigParser::ConfigParser(const std::string &filePath, precice::xml::XMLTag *pX
 {
   m_pXmlTag = pXmlTag;
   readXmlFile(filePath);
+  connectRootTag();
+}
 
+ConfigParser::ConfigParser(const std::string &filePath)
+{
+  readXmlFile(filePath);
+}
+
+ConfigParser::ConfigParser(precice::xml::XMLTag *pXmlTag, const std::string &content)
+{
+  m_pXmlTag = pXmlTag;
+  readXmlContent(content);
+  connectRootTag();
+}
+
+void ConfigParser::connectRootTag()
+{
   std::vector<XMLTag *> DefTags;
   DefTags.push_back(m_pXmlTag);
 
@@ -77,11 +93,6 @@ ConfigParser::ConfigParser(const std::string &filePath, precice::xml::XMLTag *pX
   }
 }
 
-ConfigParser::ConfigParser(const std::string &filePath)
-{
-  readXmlFile(filePath);
-}
-
 ConfigParser::~ConfigParser()
 {
   while (!m_AllTags.empty()) {
@@ -107,6 +118,18 @@ void ConfigParser::GenericErrorFunc(void *ctx, const char *msg, ...)
 }
 
 int ConfigParser::readXmlFile(std::string const &filePath)
+{
+  std::ifstream ifs(filePath);
+  if (not ifs) {
+    ERROR("File open error: " << filePath);
+  }
+
+  std::string content{std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>()};
+
+  return readXmlContent(content);
+}
+
+int ConfigParser::readXmlContent(std::string const &content)
 {
   xmlGenericErrorFunc handler = (xmlGenericErrorFunc) ConfigParser::GenericErrorFunc;
   initGenericErrorDefaultFunc(&handler);
@@ -120,13 +143,6 @@ int ConfigParser::readXmlFile(std::string const &filePath)
   SAXHandler.endElementNs   = OnEndElementNs;
   SAXHandler.characters     = OnCharacters;
 
-  std::ifstream ifs(filePath);
-  if (not ifs) {
-    ERROR("File open error: " << filePath);
-  }
-
-  std::string content{std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>()};
-
   xmlParserCtxtPtr ctxt = xmlCreatePushParserCtxt(&SAXHandler, static_cast<void*>(this),
                                                   content.c_str(), content.size(), nullptr);
 
@@ -32,6 +32,9 @@ public:
 private:
   static precice::logging::Logger _log;
 
+  /// Connects the parsed tags to the predefined root tag m_pXmlTag
+  void connectRootTag();
+
   std::vector<CTag *> m_AllTags;
   std::vector<CTag *> m_CurrentTags;
 
@@ -46,12 +49,18 @@ public:
   /// Parser ctor without Callbacks
   ConfigParser(const std::string &filePath);
 
+  /// Parser ctor for Callback init, parses the given content of a configuration file
+  ConfigParser(XMLTag *pXmlTag, const std::string &content);
+
   /// Removes all used tags
   ~ConfigParser();
 
   /// Reads the xml file
   int readXmlFile(std::string const &filePath);
 
+  /// Parses the content of an xml file
+  int readXmlContent(std::string const &content);
+
   /// Returns the root tag
   CTag *getRootTag();
 
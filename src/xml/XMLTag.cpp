@@ -602,6 +602,21 @@ void configure(
   root.addSubtag(tag);
 }
 
+void configureFromContent(
+    XMLTag &           tag,
+    const std::string &configurationContent)
+{
+  logging::Logger _log("xml");
+  TRACE(tag.getFullName());
+
+  NoPListener nopListener;
+  XMLTag      root(nopListener, "", XMLTag::OCCUR_ONCE);
+
+  precice::xml::ConfigParser p(&tag, configurationContent);
+
+  root.addSubtag(tag);
+}
+
 std::string XMLTag::getOccurrenceString(Occurrence occurrence) const
 {
   if (occurrence == OCCUR_ARBITRARY) {
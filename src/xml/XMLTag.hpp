@@ -250,6 +250,11 @@ void configure(
     XMLTag &           tag,
     const std::string &configurationFilename);
 
+/// Configures the given configuration from the content of a configuration file.
+void configureFromContent(
+    XMLTag &           tag,
+    const std::string &configurationContent);
+
 }} // namespace precice, xml
 
 /**
@@ -69,4 +69,22 @@ BOOST_AUTO_TEST_CASE(VectorAttributes)
   BOOST_TEST(cb.eigenVectorXd(2) == 1.0);
 }
 
+BOOST_AUTO_TEST_CASE(ConfigureFromContent)
+{
+  std::string content("<configuration><test-eigen-vectorxd-attributes value=\"4.0; 5.0; 6.0\"/></configuration>");
+
+  CallbackHost cb;
+  XMLTag       rootTag(cb, "configuration", XMLTag::OCCUR_ONCE);
+  XMLTag       testTagEigenXd(cb, "test-eigen-vectorxd-attributes", XMLTag::OCCUR_ONCE);
+
+  XMLAttribute<Eigen::VectorXd> attrEigenXd("value");
+  testTagEigenXd.addAttribute(attrEigenXd);
+  rootTag.addSubtag(testTagEigenXd);
+
+  configureFromContent(rootTag, content);
+  BOOST_TEST(cb.eigenVectorXd(0) == 4.0);
+  BOOST_TEST(cb.eigenVectorXd(1) == 5.0);
+  BOOST_TEST(cb.eigenVectorXd(2) == 6.0);
+}
+
 BOOST_AUTO_TEST_SUITE_END()